@@ -79,11 +79,21 @@ PSEUDOMODULES += event_timeout_ztimer
 PSEUDOMODULES += evtimer_mbox
 PSEUDOMODULES += fatfs_vfs_format
 PSEUDOMODULES += fdcan
+PSEUDOMODULES += fib_trie
 PSEUDOMODULES += fmt_%
 PSEUDOMODULES += gcoap_forward_proxy
 PSEUDOMODULES += gcoap_forward_proxy_thread
 PSEUDOMODULES += gcoap_fileserver
 PSEUDOMODULES += gcoap_dtls
+## @addtogroup net_gcoap
+## @{
+## Enable hash indexes of the request memos and Observe registrations
+PSEUDOMODULES += gcoap_memo_index
+## Allow several observers per resource and send notifications to all of them
+PSEUDOMODULES += gcoap_obs_fanout
+## Forward proxied requests from a pool of worker threads
+PSEUDOMODULES += gcoap_forward_proxy_workers
+## @}
 ## @addtogroup net_gcoap_dns
 ## @{
 ## Enable @ref net_gcoap_dns
@@ -219,6 +229,15 @@ PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_congure
 ## @{
 PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_congure_abe
 ## @}
+## @defgroup net_gnrc_sixlowpan_frag_sfr_congure_lq gnrc_sixlowpan_frag_sfr_congure_lq: Link-quality adaptive
+## @brief  Congestion control for SFR that adapts window and inter-frame gap to the link to the next hop
+##
+## Extends @ref net_gnrc_sixlowpan_frag_sfr_congure_sfr by deriving the upper bound of the window and
+## the inter-frame gap for each datagram from the ETX and RSSI of the next hop as recorded by
+## `netstats_neighbor`.
+## @{
+PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_congure_lq
+## @}
 ## @defgroup net_gnrc_sixlowpan_frag_sfr_congure_reno gnrc_sixlowpan_frag_sfr_congure_reno: TCP Reno
 ## @brief  Congestion control for SFR using the [TCP Reno congestion control algorithm](@ref sys_congure_reno)
 ## @{
@@ -241,6 +260,71 @@ PSEUDOMODULES += gnrc_sixlowpan_nd_border_router
 PSEUDOMODULES += gnrc_sixlowpan_router_default
 PSEUDOMODULES += gnrc_sock_async
 PSEUDOMODULES += gnrc_sock_check_reuse
+##
+## @addtogroup net_gnrc_tcp_congure
+## @{
+##
+PSEUDOMODULES += gnrc_tcp_congure
+## @defgroup net_gnrc_tcp_congure_abe gnrc_tcp_congure_abe: TCP Reno with ABE
+## @brief  Congestion control for GNRC TCP using the [TCP Reno congestion control algorithm with ABE](@ref sys_congure_abe)
+##
+## Provides an Alternative Backoff with Explicit Content Notification (ABE) to TCP-Reno-based congestion
+## control
+## @{
+PSEUDOMODULES += gnrc_tcp_congure_abe
+## @}
+## @defgroup net_gnrc_tcp_congure_reno gnrc_tcp_congure_reno: TCP Reno
+## @brief  Congestion control for GNRC TCP using the [TCP Reno congestion control algorithm](@ref sys_congure_reno)
+## @{
+PSEUDOMODULES += gnrc_tcp_congure_reno
+## @}
+## @defgroup net_gnrc_tcp_congure_quic gnrc_tcp_congure_quic: QUIC CC
+## @brief  Congestion control for GNRC TCP using the [congestion control algorithm of QUIC](@ref sys_congure_quic)
+## @{
+PSEUDOMODULES += gnrc_tcp_congure_quic
+## @}
+## @}
+## @defgroup net_gnrc_tcp_backlog gnrc_tcp_backlog: TCP SYN backlog
+## @ingroup net_gnrc_tcp
+## @{
+## Answer connection requests to listening ports from a backlog and hand
+## completed connections to listening TCBs as they become available
+PSEUDOMODULES += gnrc_tcp_backlog
+## @}
+## @defgroup net_gnrc_tcp_rcvbuf_autotune gnrc_tcp_rcvbuf_autotune: TCP receive buffer auto-tuning
+## @ingroup net_gnrc_tcp
+## @{
+## Grow receive buffers of connections the peer keeps filling and shrink
+## receive buffers of idle connections when the receive buffer pool runs short
+PSEUDOMODULES += gnrc_tcp_rcvbuf_autotune
+## @}
+## @defgroup net_gnrc_tcp_sack gnrc_tcp_sack: TCP selective acknowledgments
+## @ingroup net_gnrc_tcp
+## @{
+## Resend segments reported missing by SACK blocks of the peer (RFC 2018, RFC 6675)
+PSEUDOMODULES += gnrc_tcp_sack
+## @}
+## @defgroup net_gnrc_tcp_syncookies gnrc_tcp_syncookies: TCP SYN cookies
+## @ingroup net_gnrc_tcp
+## @{
+## Answer connection requests with SYN cookies once the SYN backlog is full
+## (RFC 4987)
+PSEUDOMODULES += gnrc_tcp_syncookies
+## @}
+## @defgroup net_gnrc_tcp_timestamps gnrc_tcp_timestamps: TCP timestamps
+## @ingroup net_gnrc_tcp
+## @{
+## Measure round trip times via the TCP timestamps option and reject old
+## duplicate segments (RFC 7323)
+PSEUDOMODULES += gnrc_tcp_timestamps
+## @}
+## @defgroup net_gnrc_tcp_wnd_scale gnrc_tcp_wnd_scale: TCP window scaling
+## @ingroup net_gnrc_tcp
+## @{
+## Announce receive windows larger than 64 KiB and accept scaled windows of
+## the peer (RFC 7323)
+PSEUDOMODULES += gnrc_tcp_wnd_scale
+## @}
 PSEUDOMODULES += gnrc_txtsnd
 PSEUDOMODULES += ieee802154_security
 PSEUDOMODULES += ieee802154_submac
@@ -400,6 +484,7 @@ PSEUDOMODULES += shell_cmd_cord_ep
 PSEUDOMODULES += shell_cmd_coreclk
 PSEUDOMODULES += shell_cmd_cryptoauthlib
 PSEUDOMODULES += shell_cmd_dfplayer
+PSEUDOMODULES += shell_cmd_dns_cache
 PSEUDOMODULES += shell_cmd_fib
 PSEUDOMODULES += shell_cmd_genfile
 PSEUDOMODULES += shell_cmd_gnrc_icmpv6_echo
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_hashes_siphash
+ * @{
+ *
+ * @file
+ * @brief       Implementation of the SipHash-2-4 keyed hash function
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "byteorder.h"
+#include "hashes/siphash.h"
+
+static inline uint64_t _rotl(uint64_t x, unsigned b)
+{
+    return (x << b) | (x >> (64 - b));
+}
+
+static void _rounds(uint64_t *v, unsigned n)
+{
+    while (n--) {
+        v[0] += v[1];
+        v[1] = _rotl(v[1], 13);
+        v[1] ^= v[0];
+        v[0] = _rotl(v[0], 32);
+        v[2] += v[3];
+        v[3] = _rotl(v[3], 16);
+        v[3] ^= v[2];
+        v[0] += v[3];
+        v[3] = _rotl(v[3], 21);
+        v[3] ^= v[0];
+        v[2] += v[1];
+        v[1] = _rotl(v[1], 17);
+        v[1] ^= v[2];
+        v[2] = _rotl(v[2], 32);
+    }
+}
+
+static void _compress(uint64_t *v, uint64_t m)
+{
+    v[3] ^= m;
+    _rounds(v, 2);
+    v[0] ^= m;
+}
+
+void siphash_init(siphash_context_t *ctx, const uint8_t *key)
+{
+    uint64_t k0 = byteorder_lebuftohll(key);
+    uint64_t k1 = byteorder_lebuftohll(key + 8);
+
+    ctx->v[0] = k0 ^ 0x736f6d6570736575ULL;
+    ctx->v[1] = k1 ^ 0x646f72616e646f6dULL;
+    ctx->v[2] = k0 ^ 0x6c7967656e657261ULL;
+    ctx->v[3] = k1 ^ 0x7465646279746573ULL;
+    ctx->buf_len = 0;
+    ctx->len = 0;
+}
+
+void siphash_update(siphash_context_t *ctx, const void *data, size_t len)
+{
+    const uint8_t *in = data;
+
+    ctx->len += len;
+    if (ctx->buf_len) {
+        size_t fill = sizeof(ctx->buf) - ctx->buf_len;
+
+        if (len < fill) {
+            memcpy(&ctx->buf[ctx->buf_len], in, len);
+            ctx->buf_len += len;
+            return;
+        }
+        memcpy(&ctx->buf[ctx->buf_len], in, fill);
+        _compress(ctx->v, byteorder_lebuftohll(ctx->buf));
+        in += fill;
+        len -= fill;
+        ctx->buf_len = 0;
+    }
+    for (; len >= sizeof(ctx->buf); in += sizeof(ctx->buf), len -= sizeof(ctx->buf)) {
+        _compress(ctx->v, byteorder_lebuftohll(in));
+    }
+    memcpy(ctx->buf, in, len);
+    ctx->buf_len = len;
+}
+
+void siphash_final(siphash_context_t *ctx, void *digest)
+{
+    uint64_t b = (uint64_t)ctx->len << 56;
+
+    for (unsigned i = 0; i < ctx->buf_len; i++) {
+        b |= (uint64_t)ctx->buf[i] << (8 * i);
+    }
+    _compress(ctx->v, b);
+    ctx->v[2] ^= 0xff;
+    _rounds(ctx->v, 4);
+    byteorder_htolebufll(digest, ctx->v[0] ^ ctx->v[1] ^ ctx->v[2] ^ ctx->v[3]);
+}
+
+void siphash(void *digest, const uint8_t *key, const void *data, size_t len)
+{
+    siphash_context_t ctx;
+
+    siphash_init(&ctx, key);
+    siphash_update(&ctx, data, len);
+    siphash_final(&ctx, digest);
+}
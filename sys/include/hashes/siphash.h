@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_hashes_siphash SipHash
+ * @ingroup     sys_hashes_keyed
+ * @brief       Implementation of the SipHash-2-4 keyed hash function
+ *
+ * SipHash is a pseudorandom function for short messages, designed to keep
+ * hash tables indexed by data under control of an attacker safe from
+ * collision attacks. It is much faster than a cryptographic hash function, but
+ * its 64 bit output is not meant as a message authentication code for data
+ * that needs to be secure in the long term.
+ *
+ * See https://cr.yp.to/siphash/siphash-20120918.pdf
+ *
+ * @{
+ *
+ * @file
+ * @brief       SipHash-2-4 interface definition
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Length of a SipHash key in byte
+ */
+#define SIPHASH_KEY_LENGTH      (16U)
+
+/**
+ * @brief   Length of a SipHash-2-4 digest in byte
+ */
+#define SIPHASH_DIGEST_LENGTH   (8U)
+
+/**
+ * @brief   SipHash calculation context
+ */
+typedef struct {
+    uint64_t v[4];      /**< internal state */
+    uint8_t buf[8];     /**< bytes not processed yet */
+    uint8_t buf_len;    /**< number of bytes in @ref buf */
+    uint8_t len;        /**< overall number of bytes processed, modulo 256 */
+} siphash_context_t;
+
+/**
+ * @brief   Initializes a SipHash calculation context
+ *
+ * @param[out] ctx  The context to initialize
+ * @param[in]  key  The key of @ref SIPHASH_KEY_LENGTH bytes
+ */
+void siphash_init(siphash_context_t *ctx, const uint8_t *key);
+
+/**
+ * @brief   Adds data to the hash
+ *
+ * @param[in,out] ctx   The context
+ * @param[in]     data  Input data
+ * @param[in]     len   Length of @p data
+ */
+void siphash_update(siphash_context_t *ctx, const void *data, size_t len);
+
+/**
+ * @brief   Finalizes the hash
+ *
+ * @param[in,out] ctx       The context
+ * @param[out]    digest    Result location of @ref SIPHASH_DIGEST_LENGTH
+ *                          bytes, the 64 bit result in little endian
+ */
+void siphash_final(siphash_context_t *ctx, void *digest);
+
+/**
+ * @brief   Calculates the SipHash-2-4 of the given data
+ *
+ * @param[out] digest   Result location of @ref SIPHASH_DIGEST_LENGTH bytes
+ * @param[in]  key      The key of @ref SIPHASH_KEY_LENGTH bytes
+ * @param[in]  data     Input data
+ * @param[in]  len      Length of @p data
+ */
+void siphash(void *digest, const uint8_t *key, const void *data, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -34,10 +34,19 @@ extern "C" {
  * @{
  */
 #define DNS_TYPE_A              (1)
+#define DNS_TYPE_SOA            (6)
 #define DNS_TYPE_AAAA           (28)
 #define DNS_CLASS_IN            (1)
 /** @} */
 
+/**
+ * @name    Response codes
+ * @{
+ */
+#define DNS_RCODE_NO_ERROR      (0)     /**< no error */
+#define DNS_RCODE_NAME_ERROR    (3)     /**< domain name does not exist */
+/** @} */
+
 /**
  * @name    Field lengths
  * @{
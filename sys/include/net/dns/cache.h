@@ -21,6 +21,19 @@
  *
  * This implements a simple DNS cache for A and AAAA entries.
  *
+ * Entries are identified by a hash of the domain name and stored in an
+ * open-addressing hash table, so a lookup only probes the entries after the
+ * slot of its hash. Expired entries are removed when an entry is added.
+ *
+ * Negative answers, i.e. that a name does not exist or has no address of a
+ * family, are cached as well (see dns_cache_add_negative()), for the time
+ * derived from the SOA record of the answer as in
+ * [RFC 2308](https://tools.ietf.org/html/rfc2308).
+ *
+ * With @ref CONFIG_DNS_CACHE_STALE_TTL, expired addresses are kept for a
+ * while, so they can be served with dns_cache_query_stale() when the DNS
+ * server is unreachable, as in [RFC 8767](https://tools.ietf.org/html/rfc8767).
+ *
  * The cache eviction strategy is based on the remaining time to live
  * of the cache entries, so the first entry to expire will be evicted.
  *
@@ -61,6 +74,27 @@ extern "C" {
 #define CONFIG_DNS_CACHE_AAAA   IS_USED(MODULE_IPV6)
 #endif
 
+/**
+ * @brief   Time in seconds an expired address is kept to be served stale
+ *
+ * 0 disables serving stale addresses.
+ */
+#ifndef CONFIG_DNS_CACHE_STALE_TTL
+#define CONFIG_DNS_CACHE_STALE_TTL  0
+#endif
+
+/**
+ * @brief   Cache statistics
+ */
+typedef struct {
+    uint32_t hits;          /**< lookups that found an address */
+    uint32_t negative_hits; /**< lookups that found a negative answer */
+    uint32_t stale_hits;    /**< stale lookups that found an expired address */
+    uint32_t misses;        /**< lookups that found nothing */
+    uint32_t evictions;     /**< entries replaced to make room for others */
+    uint32_t expirations;   /**< expired entries removed */
+} dns_cache_stats_t;
+
 #if IS_USED(MODULE_DNS_CACHE) || DOXYGEN
 /**
  * @brief Get IP address for a DNS name from the DNS cache
@@ -70,10 +104,26 @@ extern "C" {
  * @param[in]   family          Either AF_INET, AF_INET6 or AF_UNSPEC
  *
  * @return      the size of the resolved address on success
- * @return      <= 0 otherwise
+ * @return      -ENXIO if the name is cached as having no such address
+ * @return      0 otherwise
  */
 int dns_cache_query(const char *domain_name, void *addr_out, int family);
 
+/**
+ * @brief Get an expired IP address for a DNS name from the DNS cache
+ *
+ * To be used when the DNS server can not be reached. An address is served
+ * stale for up to @ref CONFIG_DNS_CACHE_STALE_TTL seconds after it expired.
+ *
+ * @param[in]   domain_name     DNS name to resolve into address
+ * @param[out]  addr_out        buffer to write result into
+ * @param[in]   family          Either AF_INET, AF_INET6 or AF_UNSPEC
+ *
+ * @return      the size of the resolved address on success
+ * @return      0 otherwise
+ */
+int dns_cache_query_stale(const char *domain_name, void *addr_out, int family);
+
 /**
  * @brief Add an IP address for a DNS name to the DNS cache
  *
@@ -83,6 +133,30 @@ int dns_cache_query(const char *domain_name, void *addr_out, int family);
  * @param[in]   ttl             lifetime of the entry in seconds
  */
 void dns_cache_add(const char *domain_name, const void *addr, int addr_len, uint32_t ttl);
+
+/**
+ * @brief Add a negative answer for a DNS name to the DNS cache
+ *
+ * @param[in]   domain_name     DNS name that could not be resolved
+ * @param[in]   family          Either AF_INET or AF_INET6 if the name has no
+ *                              such address, AF_UNSPEC if it has none at all
+ * @param[in]   ttl             lifetime of the entry in seconds
+ */
+void dns_cache_add_negative(const char *domain_name, int family, uint32_t ttl);
+
+/**
+ * @brief   Returns the number of cached entries
+ *
+ * @return  Number of cached entries, including those kept to be served stale
+ */
+unsigned dns_cache_used_count(void);
+
+/**
+ * @brief   Gets the statistics of the cache
+ *
+ * @param[out] stats    The statistics
+ */
+void dns_cache_stats_get(dns_cache_stats_t *stats);
 #else
 static inline int dns_cache_query(const char *domain_name, void *addr_out, int family)
 {
@@ -92,6 +166,23 @@ static inline int dns_cache_query(const char *domain_name, void *addr_out, int f
     return 0;
 }
 
+static inline int dns_cache_query_stale(const char *domain_name, void *addr_out,
+                                        int family)
+{
+    (void)domain_name;
+    (void)addr_out;
+    (void)family;
+    return 0;
+}
+
+static inline void dns_cache_add_negative(const char *domain_name, int family,
+                                          uint32_t ttl)
+{
+    (void)domain_name;
+    (void)family;
+    (void)ttl;
+}
+
 static inline void dns_cache_add(const char *domain_name, const void *addr,
                                  int addr_len, uint32_t ttl)
 {
@@ -15,6 +15,12 @@
  *
  * This module is unused by RIOT's networking stacks, see @ref net_gnrc_ipv6_nib_ft
  * instead.
+ *
+ * By default, look-ups in a single hop table scan all entries. With the
+ * `fib_trie` module, a table can be indexed by a prefix tree instead, so exact
+ * and longest-prefix matches take time linear in the address length rather
+ * than in the number of entries. To do so, point fib_table_t::trie to an array
+ * of @ref FIB_TRIE_NODES_NUMOF(size) nodes before calling @ref fib_init().
  * @{
  *
  * @file
@@ -20,6 +20,7 @@
 
 #include <stdint.h>
 
+#include "modules.h"
 #include "sched.h"
 #include "universal_address.h"
 #include "mutex.h"
@@ -91,6 +92,31 @@ typedef struct {
     size_t entry_pool_size;
 } fib_sr_meta_t;
 
+#if IS_USED(MODULE_FIB_TRIE) || defined(DOXYGEN)
+/**
+ * @brief Node of the prefix tree indexing the entries of a single hop table
+ *
+ * The key of a node is the size of the address in bytes, followed by the
+ * address itself, so addresses of different sizes never share a prefix.
+ */
+typedef struct fib_trie_node {
+    /** sub-trees, selected by the first bit following the key */
+    struct fib_trie_node *child[2];
+    /** next entry node with the same key */
+    struct fib_trie_node *next;
+    /** size of the address in bytes, followed by the address */
+    uint8_t key[UNIVERSAL_ADDRESS_SIZE + 1];
+    /** number of significant bits in `key` */
+    uint8_t len;
+} fib_trie_node_t;
+
+/**
+ * @brief Number of prefix tree nodes needed for a single hop table with
+ *        @p size entries
+ */
+#define FIB_TRIE_NODES_NUMOF(size)  (2 * (size))
+#endif
+
 /**
 * @brief FIB table type for single hop entries
 */
@@ -132,6 +158,16 @@ typedef struct {
     *   e.g. when the unreachable destination is covered by the prefix
     */
     universal_address_container_t* prefix_rp[FIB_MAX_REGISTERED_RP];
+#if IS_USED(MODULE_FIB_TRIE) || defined(DOXYGEN)
+    /** array of FIB_TRIE_NODES_NUMOF(size) nodes to index a single hop table
+    *   with a prefix tree, so look-ups do not need to scan all entries.
+    *   Set to NULL before calling fib_init() to search the table linearly.
+    *   Only available with module `fib_trie`.
+    */
+    fib_trie_node_t *trie;
+    /** root of the prefix tree */
+    fib_trie_node_t *trie_root;
+#endif
 } fib_table_t;
 
 #ifdef __cplusplus
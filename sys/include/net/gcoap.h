@@ -93,6 +93,17 @@
  * If no payload, call only gcoap_response() to write the full response. If you
  * need to add Options, follow the first three steps in the list above instead.
  *
+ ### Sending a large payload ###
+ *
+ * The response is built in the buffer of the request, so it is limited to
+ * #CONFIG_GCOAP_PDU_BUF_SIZE. A payload that already is in memory, e.g. a
+ * constant representation in flash, does not need to be copied into that
+ * buffer. Instead of writing it to the _payload_ pointer, attach it with
+ * coap_payload_add_snip(), or with coap_blockwise_put_snip() for a block of
+ * it. gcoap sends the snips after the response in the buffer. The handler
+ * still returns only the length in the buffer. The snips, and the data they
+ * point to, must not be on the stack of the handler.
+ *
  * ### Resource list creation ###
  *
  * gcoap allows customization of the function that provides the list of registered
@@ -157,7 +168,9 @@
  * A CoAP client may register for Observe notifications for any resource that
  * an application has registered with gcoap. An application does not need to
  * take any action to support Observe client registration. However, gcoap
- * limits registration for a given resource to a _single_ observer.
+ * limits registration for a given resource to a _single_ observer, unless
+ * the `gcoap_obs_fanout` module is used (see "Notifying many observers"
+ * below).
  *
  * It is [suggested](https://tools.ietf.org/html/rfc7641#section-6) that a
  * server adds the 'obs' attribute to resources that are useful for observation
@@ -193,6 +206,22 @@
  * Finally, call gcoap_obs_send() for the resource, with the sum of the
  * metadata length and payload length for the representation.
  *
+ * ### Notifying many observers ###
+ *
+ * With `USEMODULE += gcoap_obs_fanout`, any number of endpoints may observe
+ * a resource, up to CONFIG_GCOAP_OBS_REGISTRATIONS_MAX registrations in total.
+ * A notification still is created only once, as described above:
+ * gcoap_obs_init() writes the header for the first observer of the resource.
+ * gcoap_obs_send_all() then sends the notification to every observer. Only
+ * the header is rewritten for each of them, with the token of its registration
+ * and a message ID of its own. The options and the payload are passed to the
+ * sock layer unchanged, as second part of the vector that is sent. The
+ * Observe value is the same in all notifications of a round. With this module,
+ * gcoap_obs_send() notifies all observers as well.
+ *
+ * Use the `gcoap_memo_index` module together with this module, so lookups
+ * of a registration don't need to scan all registrations.
+ *
  * ### Other considerations ###
  *
  * By default, the value for the Observe option in a notification is three
@@ -237,7 +266,8 @@
  * - Add the payload using the `coap_blockwise_put_xxx()` functions. The slicer
  *   knows the current position in the overall body of the response. It writes
  *   only the portion of the body specified by the block number and block size
- *   in the slicer.
+ *   in the slicer. coap_blockwise_put_snip() attaches the portion instead of
+ *   copying it, see _Sending a large payload_ above.
  * - Finally, use coap_block2_finish() to finalize the block option with the
  *   proper value for the _more_ parameter.
  *
@@ -368,6 +398,24 @@
  * times out. We track the response with an entry in the
  * `_coap_state.open_reqs` array.
  *
+ * ### Looking up memos ###
+ *
+ * By default, gcoap searches the request memos linearly for every incoming
+ * response, and the Observe registrations for every incoming request and
+ * every notification. That is the best choice for the few memos of a typical
+ * node. A proxy or a collector with many requests in flight and many
+ * observers should use the module `gcoap_memo_index` instead. It keeps hash
+ * indexes of the request memos, keyed by message ID and by token, and of
+ * the Observe registrations, keyed by resource and by token. These lookups
+ * then take constant time on average. @ref CONFIG_GCOAP_MEMO_INDEX_BUCKETS
+ * sets the number of buckets of each index.
+ *
+ * With `gcoap_memo_index`, request memos are also taken from a
+ * @ref sys_memarray "memarray" pool. Initially, this pool holds
+ * @ref CONFIG_GCOAP_REQ_WAITING_MAX memos. An application can add memory for
+ * more memos at runtime with gcoap_req_memo_pool_extend(), for example when
+ * the number of peers is only known after boot.
+ *
  * ## Implementation Status ##
  * gcoap includes server and client capability. Available features include:
  *
@@ -585,6 +633,16 @@ extern "C" {
 #define CONFIG_GCOAP_OBS_REGISTRATIONS_MAX     (2)
 #endif
 
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Number of buckets of each memo index
+ *
+ * Only used with module `gcoap_memo_index`. Must be a power of two.
+ */
+#ifndef CONFIG_GCOAP_MEMO_INDEX_BUCKETS
+#define CONFIG_GCOAP_MEMO_INDEX_BUCKETS         (16)
+#endif
+
 /**
  * @name    States for the memo used to track Observe registrations
  * @{
@@ -852,12 +910,26 @@ struct gcoap_request_memo {
      */
     uint8_t cache_key[CONFIG_NANOCOAP_CACHE_KEY_LENGTH];
 #endif
+#if IS_USED(MODULE_GCOAP_MEMO_INDEX) || DOXYGEN
+    /**
+     * @brief   Next memo with the same message ID hash
+     *
+     * @note    Only available with module `gcoap_memo_index`
+     */
+    gcoap_request_memo_t *mid_next;
+    /**
+     * @brief   Next memo with the same token hash
+     *
+     * @note    Only available with module `gcoap_memo_index`
+     */
+    gcoap_request_memo_t *token_next;
+#endif
 };
 
 /**
  * @brief   Memo for Observe registration and notifications
  */
-typedef struct {
+typedef struct gcoap_observe_memo {
     sock_udp_ep_t *observer;            /**< Client endpoint; unused if null */
     sock_udp_ep_t *notifier;            /**< Local endpoint to send notifications */
     const coap_resource_t *resource;    /**< Entity being observed */
@@ -865,6 +937,20 @@ typedef struct {
     uint16_t last_msgid;                /**< Message ID of last notification */
     unsigned token_len;                 /**< Actual length of token attribute */
     gcoap_socket_t socket;              /**< Transport type to observer */
+#if IS_USED(MODULE_GCOAP_MEMO_INDEX) || DOXYGEN
+    /**
+     * @brief   Next registration with the same resource hash
+     *
+     * @note    Only available with module `gcoap_memo_index`
+     */
+    struct gcoap_observe_memo *resource_next;
+    /**
+     * @brief   Next registration with the same token hash
+     *
+     * @note    Only available with module `gcoap_memo_index`
+     */
+    struct gcoap_observe_memo *token_next;
+#endif
 } gcoap_observe_memo_t;
 
 /**
@@ -1083,7 +1169,9 @@ int gcoap_obs_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
  * @brief   Sends a buffer containing a CoAP Observe notification to the
  *          observer registered for a resource
  *
- * Assumes a single observer for a resource.
+ * Assumes a single observer for a resource. With the `gcoap_obs_fanout`
+ * module, the notification is sent to all observers of the resource, as with
+ * gcoap_obs_send_all().
  *
  * @param[in] buf Buffer containing the PDU
  * @param[in] len Length of the buffer
@@ -1095,6 +1183,27 @@ int gcoap_obs_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
 size_t gcoap_obs_send(const uint8_t *buf, size_t len,
                       const coap_resource_t *resource);
 
+/**
+ * @brief   Sends a buffer containing a CoAP Observe notification to all
+ *          observers registered for a resource
+ *
+ * The notification must have been initialized with gcoap_obs_init(). For
+ * each observer, only the message ID and the token in the header are
+ * changed. Options and payload are shared by all notifications.
+ *
+ * More than one observer can only be registered for a resource with the
+ * `gcoap_obs_fanout` module.
+ *
+ * @param[in] buf Buffer containing the PDU
+ * @param[in] len Length of the buffer
+ * @param[in] resource Resource to send
+ *
+ * @return  number of observers the notification was sent to
+ * @return  -EINVAL if @p len is shorter than the header in @p buf
+ */
+int gcoap_obs_send_all(const uint8_t *buf, size_t len,
+                       const coap_resource_t *resource);
+
 /**
  * @brief   Forgets (invalidates) an existing observe request.
  *
@@ -1131,9 +1240,26 @@ int gcoap_obs_req_forget(const sock_udp_ep_t *remote, const uint8_t *token,
  *
  * Useful for monitoring.
  *
- * @return  count of unanswered requests
+ * @return  count of unanswered requests, which can exceed 255 once
+ *          @ref gcoap_req_memo_pool_extend() added memos
+ */
+unsigned gcoap_op_state(void);
+
+/**
+ * @brief   Adds memory for request memos
+ *
+ * Each memo in @p memos allows one more request to wait for its response at
+ * the same time. The memory is owned by gcoap afterwards and can't be
+ * returned.
+ *
+ * @note    Only available with module `gcoap_memo_index`
+ *
+ * @pre     gcoap_init() was called
+ *
+ * @param[in] memos     memory for the memos
+ * @param[in] numof     number of memos in @p memos, must not be 0
  */
-uint8_t gcoap_op_state(void);
+void gcoap_req_memo_pool_extend(gcoap_request_memo_t *memos, size_t numof);
 
 /**
  * @brief   Get the resource list, currently only `CoRE Link Format`
@@ -107,7 +107,9 @@ extern "C" {
  * @return  -ENOMSG, if CoAP response did not contain a DNS response.
  * @return  -ENOTRECOVERABLE, on gCoAP-internal error.
  * @return  -ENOTSUP, if credential can not be added for to client.
- * @return  -ETIMEDOUT, if CoAP request timed out.
+ * @return  -ENXIO, if the domain name has no address of @p family.
+ * @return  -ETIMEDOUT, if CoAP request timed out and no stale address is
+ *          cached (see @ref dns_cache_query_stale()).
  */
 int gcoap_dns_query(const char *domain_name, void *addr_out, int family);
 
@@ -17,6 +17,30 @@
  *          RFC 7252
  *      </a>
  *
+ * ## Request coalescing ##
+ *
+ * A GET that is identical to one still waiting for the response of the
+ * server is not forwarded again. Identical means same server, same options
+ * and same payload. Both clients get the response to the first request, each
+ * with its own token and message ID. Every client request has a buffer of
+ * @ref CONFIG_GCOAP_PDU_BUF_SIZE for this. Requests are not coalesced with
+ * `gcoap_forward_proxy_thread`, which changes them while they are sent.
+ *
+ * ## Worker pool ##
+ *
+ * By default, the gcoap thread forwards the requests and receives the
+ * responses of the servers itself. With the `gcoap_forward_proxy_workers`
+ * module, @ref CONFIG_GCOAP_FORWARD_PROXY_WORKERS threads exchange the
+ * forward requests with the servers instead, each over its own socket. The
+ * gcoap thread hands them the requests through a queue of
+ * @ref CONFIG_GCOAP_FORWARD_PROXY_QUEUE_SIZE and sends the responses to the
+ * clients.
+ *
+ * Each worker keeps up to @ref CONFIG_GCOAP_FORWARD_PROXY_WORKER_EXCHANGES
+ * exchanges in flight and retransmits confirmable requests itself, so the
+ * workers need no request memos of gcoap. Stale cache entries are validated
+ * with their ETag like without the workers.
+ *
  * @{
  *
  * @file
@@ -46,6 +70,45 @@ extern "C" {
 #ifndef CONFIG_GCOAP_FORWARD_PROXY_EMPTY_ACK_MS
 #define CONFIG_GCOAP_FORWARD_PROXY_EMPTY_ACK_MS     ((CONFIG_COAP_ACK_TIMEOUT_MS / 4) * 3)
 #endif
+
+/**
+ * @brief Maximum number of client requests the forward proxy handles at once
+ *
+ * Without `gcoap_forward_proxy_workers` every forwarded request occupies a
+ * request memo. Only coalesced requests go beyond
+ * @ref CONFIG_GCOAP_REQ_WAITING_MAX then.
+ */
+#ifndef CONFIG_GCOAP_FORWARD_PROXY_CLIENTS_MAX
+#define CONFIG_GCOAP_FORWARD_PROXY_CLIENTS_MAX      CONFIG_GCOAP_REQ_WAITING_MAX
+#endif
+
+/**
+ * @brief Number of forward proxy workers
+ *
+ * Only used with `gcoap_forward_proxy_workers`.
+ */
+#ifndef CONFIG_GCOAP_FORWARD_PROXY_WORKERS
+#define CONFIG_GCOAP_FORWARD_PROXY_WORKERS          (2)
+#endif
+
+/**
+ * @brief Number of exchanges a forward proxy worker keeps in flight
+ *
+ * Only used with `gcoap_forward_proxy_workers`.
+ */
+#ifndef CONFIG_GCOAP_FORWARD_PROXY_WORKER_EXCHANGES
+#define CONFIG_GCOAP_FORWARD_PROXY_WORKER_EXCHANGES (4)
+#endif
+
+/**
+ * @brief Number of forward requests waiting for a free worker
+ *
+ * Only used with `gcoap_forward_proxy_workers`. Must be a power of two.
+ * Further requests are answered with 5.03 Service Unavailable.
+ */
+#ifndef CONFIG_GCOAP_FORWARD_PROXY_QUEUE_SIZE
+#define CONFIG_GCOAP_FORWARD_PROXY_QUEUE_SIZE       (4)
+#endif
 /** @} */
 
 /**
@@ -64,6 +127,8 @@ void gcoap_forward_proxy_init(void);
  * @return    -ENOTSUP       if the forward proxy is not compiled in
  * @return    -ENOENT        if @p pkt does not contain a Proxy-Uri option
  * @return    -EINVAL        if Proxy-Uri is malformed
+ * @return    -ENOMEM        if too many client requests are pending
+ * @return    -EAGAIN        if all forward proxy workers are busy
  */
 int gcoap_forward_proxy_request_process(coap_pkt_t *pkt,
                                         const sock_udp_ep_t *client, const sock_udp_ep_t *local);
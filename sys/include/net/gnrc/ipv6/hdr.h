@@ -28,6 +28,21 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Initializes an IPv6 header for sending in place.
+ *
+ * @details Initializes version field with 6, traffic class, flow label, and
+ *          hop limit with 0, and next header with @ref PROTNUM_RESERVED.
+ *
+ * @param[out] hdr      The header to initialize.
+ * @param[in] src       Source address for the header. Can be NULL if not
+ *                      known or required.
+ * @param[in] dst       Destination address for the header. Can be NULL if not
+ *                      known or required.
+ */
+void gnrc_ipv6_hdr_init(ipv6_hdr_t *hdr, const ipv6_addr_t *src,
+                        const ipv6_addr_t *dst);
+
 /**
  * @brief   Builds an IPv6 header for sending and adds it to the packet buffer.
  *
@@ -36,6 +36,7 @@
 #include "net/gnrc/ipv6/nib/nc.h"
 #include "net/gnrc/netif.h"
 #include "net/gnrc/pkt.h"
+#include "net/netstats.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -358,6 +359,22 @@ int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
                                       gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
                                       gnrc_ipv6_nib_nc_t *nce);
 
+#if ((CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF > 0) && \
+     IS_USED(MODULE_NETSTATS_IPV6)) || defined(DOXYGEN)
+/**
+ * @brief   Gets the hit/miss statistics of the next-hop route cache used by
+ *          @ref gnrc_ipv6_nib_get_next_hop_l2addr()
+ *
+ * @pre `stats != NULL`
+ *
+ * @param[out] stats    The current statistics of the route cache.
+ *
+ * @note    Only available with @ref CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF > 0
+ *          and module `netstats_ipv6`.
+ */
+void gnrc_ipv6_nib_route_cache_stats(netstats_cache_t *stats);
+#endif
+
 /**
  * @brief   Handles a received ICMPv6 packet
  *
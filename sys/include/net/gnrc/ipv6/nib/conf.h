@@ -309,6 +309,21 @@ extern "C" {
 #  define CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF            (8)
 #endif
 
+/**
+ * @brief   Number of entries in the next-hop route cache
+ *
+ * The route cache remembers the resolved next hop (interface and link-layer
+ * address) of recently used destinations, so
+ * @ref gnrc_ipv6_nib_get_next_hop_l2addr() does not need to go through
+ * neighbor cache, prefix list and forwarding table for every packet of a flow.
+ * The cache is invalidated as a whole whenever the NIB changes.
+ *
+ * Set to 0 to disable the route cache.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF
+#  define CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF     (0)
+#endif
+
 #if CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C || defined(DOXYGEN)
 /**
  * @brief   Number of authoritative border router entries in NIB
@@ -72,6 +72,32 @@ typedef enum {
 } gnrc_netreg_type_t;
 #endif
 
+/**
+ * @defgroup net_gnrc_netreg_conf   GNRC network protocol registry compile configurations
+ * @ingroup  net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Number of hash buckets per protocol type in the registry (as
+ *          exponent of 2^n).
+ *
+ *          Entries are distributed over the buckets of their protocol type by
+ *          their gnrc_netreg_entry_t::demux_ctx, so a look-up only needs to
+ *          search the entries in a single bucket. With the default of 0 all
+ *          entries of a type share a single list. Increase this if a thread
+ *          registers for many demultiplexing contexts, e.g. many UDP ports.
+ *          Every bucket costs one pointer per protocol type.
+ */
+#ifndef CONFIG_GNRC_NETREG_BUCKETS_EXP
+#define CONFIG_GNRC_NETREG_BUCKETS_EXP  (0U)
+#endif
+/** @} */
+
+/**
+ * @brief   Number of hash buckets per protocol type in the registry
+ */
+#define GNRC_NETREG_BUCKETS_NUMOF       (1U << CONFIG_GNRC_NETREG_BUCKETS_EXP)
+
 /**
  * @brief   Demux context value to get all packets of a certain type.
  *
@@ -343,6 +369,9 @@ static inline void gnrc_netreg_entry_init_cb(gnrc_netreg_entry_t *entry,
  * @warning Call gnrc_netreg_unregister() *before* you leave the context you
  *          allocated @p entry in. Otherwise it might get overwritten.
  *
+ * @warning gnrc_netreg_entry_t::demux_ctx of @p entry must not be changed
+ *          until it is unregistered again.
+ *
  * @pre The calling thread must provide a [message queue](@ref msg_init_queue)
  *      when using @ref GNRC_NETREG_TYPE_DEFAULT for gnrc_netreg_entry_t::type
  *      of @p entry.
@@ -111,6 +111,35 @@ void gnrc_pktbuf_init(void);
 gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
                                 gnrc_nettype_t type);
 
+/**
+ * @brief   Adds several new gnrc_pktsnip_t in front of @p next to the packet
+ *          buffer.
+ *
+ * Other than calling @ref gnrc_pktbuf_add() for each snip, this allocates
+ * the snips and their data in one go. Where the packet buffer implementation
+ * allows it, this is one allocation for the whole packet, so a sender can
+ * get all headers and the payload of a packet at once and write them in
+ * place. The data of the new snips is not initialized.
+ *
+ * @warning **Do not** change the fields of the gnrc_pktsnip_t created by this
+ *          function externally. This will most likely create memory leaks or
+ *          not allowed memory access.
+ *
+ * @param[in] next      Next gnrc_pktsnip_t of the last new snip. Leave NULL if
+ *                      you want to create a new packet.
+ * @param[in] sizes     Data lengths of the new snips, from the first to the
+ *                      last snip. A length of 0 results in a snip with its
+ *                      gnrc_pktsnip::data field set to NULL.
+ * @param[in] types     Protocol types of the new snips, from the first to the
+ *                      last snip.
+ * @param[in] num       Number of new snips. Must not be 0.
+ *
+ * @return  Pointer to the first of the new snips.
+ * @return  NULL, if no space is left in the packet buffer.
+ */
+gnrc_pktsnip_t *gnrc_pktbuf_add_snips(gnrc_pktsnip_t *next, const size_t *sizes,
+                                      const gnrc_nettype_t *types, unsigned num);
+
 /**
  * @brief   Marks the first @p size bytes in a received packet with a new
  *          packet snip that is appended to the packet.
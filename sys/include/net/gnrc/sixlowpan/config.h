@@ -125,6 +125,20 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER              (0U)
 #endif
 
+/**
+ * @brief   Number of buckets of the reassembly buffer's look-up index
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_rb](@ref net_gnrc_sixlowpan_frag_rb) module
+ *
+ * Entries are hashed by their source and destination link-layer address and
+ * their datagram tag, so a fragment only has to be compared against the
+ * entries in its bucket. With 1 all entries in use share a single bucket.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE
+#define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE   (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE)
+#endif
+
 /**
  * @brief   Registration lifetime in minutes for the address registration option
  *
@@ -143,6 +157,24 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_ND_AR_LTIME          (15U)
 #endif
 
+/**
+ * @brief   Number of entries in the IPHC compressed header cache
+ *
+ * The cache remembers the compressed IPv6 header of recently sent flows, so
+ * subsequent packets with the same uncompressed IPv6 header (apart from the
+ * payload length) to the same link-layer destination do not need to go
+ * through context look-up and address compression again. The contexts used
+ * by a cached header are validated on every hit.
+ *
+ * Set to 0 to disable the cache.
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_iphc](@ref net_gnrc_sixlowpan_iphc) module.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE
+#define CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE      (0U)
+#endif
+
 /**
  * @brief   Size of the virtual reassembly buffer
  *
@@ -388,6 +420,17 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_SFR_ECN_FQUEUE_DEN        2U
 #endif
 
+/**
+ * @brief   Average RSSI in abs([dBm]) above which a link is considered weak
+ *
+ * When `gnrc_sixlowpan_frag_sfr_congure_lq` is compiled in, the window is
+ * halved and the inter-frame gap is doubled for datagrams to a next hop whose
+ * average RSSI is weaker than `-CONFIG_GNRC_SIXLOWPAN_SFR_LQ_RSSI_WEAK` dBm.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_SFR_LQ_RSSI_WEAK
+#define CONFIG_GNRC_SIXLOWPAN_SFR_LQ_RSSI_WEAK          85U
+#endif
+
 /**
  * @brief   Deactivate automatic handling of ARQ timer
  *
@@ -96,6 +96,21 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_lookup_addr(const ipv6_addr_t *addr);
  */
 gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_lookup_id(uint8_t id);
 
+/**
+ * @brief   Gets context by ID for decompression
+ *
+ * Other than gnrc_sixlowpan_ctx_lookup_id(), this neither updates the lifetime
+ * of the context nor takes the lock of the context buffer, as the lifetime
+ * only restricts the use of a context for compression. This makes it cheap
+ * enough for the per-frame look-up when decompressing IPHC headers.
+ *
+ * @param[in] id    A context ID.
+ *
+ * @return  The context associated with @p id.
+ * @return  NULL if there is no such context.
+ */
+const gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_lookup_id_decomp(uint8_t id);
+
 /**
  * @brief   Updates (or adds if currently not registered) a context
  *
@@ -113,6 +113,15 @@ typedef struct {
     int8_t offset_diff;                         /**< offset change due to
                                                  *   recompression */
 #endif /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) */
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS) || defined(DOXYGEN)
+    /**
+     * @brief   Time in microseconds of arrival of the first received fragment
+     *
+     * @note    Only available with module `gnrc_sixlowpan_frag_stats`
+     *          compiled in.
+     */
+    uint32_t created;
+#endif /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS) */
 } gnrc_sixlowpan_frag_rb_t;
 
 /**
@@ -21,6 +21,7 @@
  * - @ref net_gnrc_sixlowpan_frag_sfr_congure_quic
  * - @ref net_gnrc_sixlowpan_frag_sfr_congure_reno
  * - @ref net_gnrc_sixlowpan_frag_sfr_congure_abe
+ * - @ref net_gnrc_sixlowpan_frag_sfr_congure_lq
  * @{
  *
  * @file
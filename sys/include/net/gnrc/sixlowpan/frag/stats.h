@@ -20,6 +20,8 @@
  * @author  Martine Lenders <m.lenders@fu-berlin.de>
  */
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -36,6 +38,17 @@ typedef struct {
                              *   no @ref gnrc_sixlowpan_frag_fb_t available */
     unsigned datagrams;     /**< reassembled datagrams */
     unsigned fragments;     /**< total fragments of reassembled fragments */
+    unsigned rbuf_timeouts; /**< datagrams dropped from the reassembly
+                             *   buffer since they timed out */
+    unsigned rbuf_drops;    /**< datagrams dropped from the reassembly
+                             *   buffer due to invalid or overlapping
+                             *   fragments or lack of resources */
+    uint32_t reass_time_max;    /**< longest time in microseconds between the
+                                 *   first fragment of a datagram and its
+                                 *   completion */
+    uint64_t reass_time_sum;    /**< sum of the times in microseconds between
+                                 *   the first fragment and the completion of
+                                 *   all reassembled datagrams */
 #if defined(MODULE_GNRC_SIXLOWPAN_FRAG_VRB) || DOXYGEN
     unsigned vrb_full;      /**< counts the number of events where the virtual
                              *   reassembly buffer is full */
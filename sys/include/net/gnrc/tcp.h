@@ -128,6 +128,34 @@ void gnrc_tcp_tcb_init(gnrc_tcp_tcb_t *tcb);
  */
 void gnrc_tcp_tcb_queue_init(gnrc_tcp_tcb_queue_t *queue);
 
+/**
+ * @brief Set the receive buffer size of a TCB.
+ *
+ * The receive buffer is allocated from a pool of
+ * @ref CONFIG_GNRC_TCP_RCV_BUF_POOL_SIZE bytes shared by all connections when
+ * the connection is opened with gnrc_tcp_open() or gnrc_tcp_listen(). Use this
+ * function to give connections with different needs different receive windows.
+ * Without a call to this function, @ref GNRC_TCP_RCV_BUF_SIZE is used.
+ *
+ * With module `gnrc_tcp_rcvbuf_autotune`, @p size is the upper bound: The
+ * receive buffer starts with at most @ref GNRC_TCP_RCV_BUF_SIZE bytes and
+ * doubles each time the peer fills it, while receive buffers of idle
+ * connections shrink to one MSS if the pool runs short on memory. A window
+ * already offered to the peer is never taken back: such a buffer shrinks
+ * once the peer used up the window beyond one MSS.
+ *
+ * @pre gnrc_tcp_tcb_init() must have been successfully called.
+ * @pre @p tcb must not be NULL.
+ *
+ * @param[in,out] tcb    TCB to set the receive buffer size of.
+ * @param[in]     size   Receive buffer size in bytes.
+ *
+ * @return   0 on success.
+ * @return   -EINVAL if @p size is zero or exceeds the receive buffer pool.
+ * @return   -EISCONN if @p tcb is already in use.
+ */
+int gnrc_tcp_tcb_set_rcv_buf_size(gnrc_tcp_tcb_t *tcb, size_t size);
+
 /**
  * @brief Opens a connection.
  *
@@ -212,7 +240,10 @@ int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
  * @pre @p tcb must not be NULL.
  * @pre @p data must not be NULL.
  *
- * @note Blocks until up to @p len bytes were transmitted or an error occurred.
+ * @note Blocks until up to @p len bytes were queued for transmission or an error
+ *       occurred. Queued data is retransmitted until it is acknowledged by the
+ *       peer, up to @ref CONFIG_GNRC_TCP_SND_QUEUE_SIZE segments can be
+ *       unacknowledged at the same time.
  *
  * @param[in,out] tcb                        TCB holding the connection information.
  * @param[in]     data                       Pointer to the data that should be transmitted.
@@ -224,7 +255,7 @@ int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
  *                                           causing the function to block until some data was
  *                                           transmitted or and error occurred.
  *
- * @return   The number of successfully transmitted bytes.
+ * @return   The number of bytes queued for transmission.
  * @return   -ENOTCONN if connection is not established.
  * @return   -ECONNRESET if connection was reset by the peer.
  * @return   -ECONNABORTED if the connection was aborted.
@@ -267,6 +298,47 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
 ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
                       const uint32_t user_timeout_duration_ms);
 
+/**
+ * @brief Access received data in place, without copying it.
+ *
+ * Behaves like gnrc_tcp_recv(), but instead of copying the received data, @p data
+ * is set to the received data within the receive buffer of @p tcb. The data stays
+ * in the receive buffer until it is released with gnrc_tcp_recv_buf_consume().
+ *
+ * @pre gnrc_tcp_tcb_init() must have been successfully called.
+ * @pre @p tcb must not be NULL.
+ * @pre @p data must not be NULL.
+ *
+ * @note @p data remains valid until gnrc_tcp_recv_buf_consume(), gnrc_tcp_recv()
+ *       or gnrc_tcp_close() is called on @p tcb.
+ *
+ * @param[in,out] tcb                        TCB holding the connection information.
+ * @param[out]    data                       Set to the oldest received byte.
+ * @param[in]     max_len                    Maximum amount of bytes to access.
+ * @param[in]     user_timeout_duration_ms   Timeout for receive in milliseconds,
+ *                                           see gnrc_tcp_recv().
+ *
+ * @return   The number of contiguous bytes at @p data. May be less than the
+ *           amount of received data, if the data wraps around the end of the
+ *           receive buffer.
+ * @return   Any value returned by gnrc_tcp_recv() on errors.
+ */
+ssize_t gnrc_tcp_recv_buf(gnrc_tcp_tcb_t *tcb, void **data, const size_t max_len,
+                          const uint32_t user_timeout_duration_ms);
+
+/**
+ * @brief Release data accessed with gnrc_tcp_recv_buf().
+ *
+ * Frees the space in the receive buffer and announces it to the peer.
+ *
+ * @pre gnrc_tcp_tcb_init() must have been successfully called.
+ * @pre @p tcb must not be NULL.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     len   Number of bytes to release, as returned by gnrc_tcp_recv_buf().
+ */
+void gnrc_tcp_recv_buf_consume(gnrc_tcp_tcb_t *tcb, size_t len);
+
 /**
  * @brief Close a TCP connection.
  *
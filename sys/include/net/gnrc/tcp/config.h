@@ -93,13 +93,57 @@ extern "C" {
 /**
  * @brief Number of preallocated receive buffers.
  *
- * This value determines how many parallel TCP connections can be active at the
- * same time.
+ * The default receive buffer pool holds this many receive buffers of the
+ * default size, see @ref CONFIG_GNRC_TCP_RCV_BUF_POOL_SIZE. Connections with
+ * smaller receive buffers fit more of them into the pool, see
+ * @ref CONFIG_GNRC_TCP_CONNECTIONS_MAX.
  */
 #ifndef CONFIG_GNRC_TCP_RCV_BUFFERS
 #define CONFIG_GNRC_TCP_RCV_BUFFERS (1U)
 #endif
 
+/**
+ * @brief Maximum number of connections open at the same time with congestion
+ *        control.
+ *
+ * With module `gnrc_tcp_congure`, every open connection takes a CongURE state
+ * from a pool of this size. The receive buffers don't limit the number of
+ * connections to @ref CONFIG_GNRC_TCP_RCV_BUFFERS: connections with smaller
+ * receive buffers, see gnrc_tcp_tcb_set_rcv_buf_size(), or with module
+ * `gnrc_tcp_rcvbuf_autotune` fit more of them into the pool. Raise this value
+ * accordingly.
+ */
+#ifndef CONFIG_GNRC_TCP_CONNECTIONS_MAX
+#define CONFIG_GNRC_TCP_CONNECTIONS_MAX (CONFIG_GNRC_TCP_RCV_BUFFERS)
+#endif
+
+/**
+ * @brief Number of data segments that can be unacknowledged at the same time.
+ *
+ * @note Unacknowledged segments stay in the packet buffer, so each connection
+ *       occupies up to CONFIG_GNRC_TCP_SND_QUEUE_SIZE * CONFIG_GNRC_TCP_MSS
+ *       bytes of it. The data in flight is further bounded by the window of
+ *       the peer and, with module `gnrc_tcp_congure`, the congestion window.
+ *       Make sure CONFIG_GNRC_PKTBUF_SIZE leaves room for incoming
+ *       acknowledgments, otherwise the connection stalls.
+ */
+#ifndef CONFIG_GNRC_TCP_SND_QUEUE_SIZE
+#define CONFIG_GNRC_TCP_SND_QUEUE_SIZE (1U)
+#endif
+
+/**
+ * @brief Number of connection requests held by the SYN backlog.
+ *
+ * With module `gnrc_tcp_backlog`, connection requests to a listening port are
+ * answered by the backlog until a TCB of the port is available, so a server
+ * can accept bursts of connections with few TCBs. With module
+ * `gnrc_tcp_syncookies`, further requests are answered with SYN cookies once
+ * the backlog is full.
+ */
+#ifndef CONFIG_GNRC_TCP_BACKLOG_SIZE
+#define CONFIG_GNRC_TCP_BACKLOG_SIZE (4U)
+#endif
+
 /**
  * @brief Default receive buffer size
  */
@@ -107,6 +151,32 @@ extern "C" {
 #define GNRC_TCP_RCV_BUF_SIZE (CONFIG_GNRC_TCP_DEFAULT_WINDOW)
 #endif
 
+/**
+ * @brief Allocation granularity of the receive buffer pool in bytes.
+ *
+ * Each receive buffer occupies a multiple of this size within
+ * @ref CONFIG_GNRC_TCP_RCV_BUF_POOL_SIZE. Smaller values waste less memory per
+ * connection at the cost of a larger allocation bitmap.
+ */
+#ifndef CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE
+#define CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE (64U)
+#endif
+
+/**
+ * @brief Size of the memory pool shared by all receive buffers in bytes.
+ *
+ * The size of a receive buffer can be chosen per connection with
+ * gnrc_tcp_tcb_set_rcv_buf_size(). By default, the pool holds
+ * @ref CONFIG_GNRC_TCP_RCV_BUFFERS buffers of size @ref GNRC_TCP_RCV_BUF_SIZE.
+ */
+#ifndef CONFIG_GNRC_TCP_RCV_BUF_POOL_SIZE
+#define CONFIG_GNRC_TCP_RCV_BUF_POOL_SIZE (CONFIG_GNRC_TCP_RCV_BUFFERS * \
+                                           ((GNRC_TCP_RCV_BUF_SIZE + \
+                                             CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE - 1) / \
+                                            CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE) * \
+                                           CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE)
+#endif
+
 /**
  * @brief Lower bound for RTO in milliseconds. Default is 1 sec (see RFC 6298)
  *
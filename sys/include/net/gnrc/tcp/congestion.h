@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#pragma once
+
+/**
+ * @defgroup net_gnrc_tcp_congure Congestion control for GNRC TCP
+ * @ingroup  net_gnrc_tcp
+ * @brief    Congestion control for GNRC TCP using the @ref sys_congure
+ *
+ * When included, this module bounds the amount of data GNRC TCP keeps in
+ * flight by a congestion window in addition to the window advertised by the
+ * peer. The flavor of congestion control can be selected using the following
+ * sub-modules:
+ *
+ * - @ref net_gnrc_tcp_congure_reno (the default)
+ * - @ref net_gnrc_tcp_congure_abe
+ * - @ref net_gnrc_tcp_congure_quic
+ *
+ * Only segments carrying payload are reported to CongURE, SYN and FIN are
+ * always sent.
+ *
+ * @{
+ *
+ * @file
+ * @brief   CongURE definitions for @ref net_gnrc_tcp
+ */
+
+#include "congure.h"
+#include "modules.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   The user-defined window unit for CongURE is one byte with TCP
+ */
+#define GNRC_TCP_CONGURE_UNIT   (1U)
+
+#if IS_USED(MODULE_GNRC_TCP_CONGURE) || DOXYGEN
+/**
+ * @brief   Retrieve CongURE state object from a pool of free objects
+ *
+ * Needs to be defined for each CongURE implementation `congure_x` e.g. as
+ * a sub-module `gnrc_tcp_congure_x` and call the respective
+ * `congure_x_snd_setup` function when a free object is available. As such,
+ * congure_snd_t::driver == NULL can be used as an identifier if a state object
+ * is free.
+ *
+ * The pool of objects has to have an initial size of at least
+ * @ref CONFIG_GNRC_TCP_CONNECTIONS_MAX, as every open connection holds a
+ * CongURE state object. The window unit is @ref GNRC_TCP_CONGURE_UNIT.
+ *
+ * @note    May be called concurrently from different threads.
+ *
+ * @return  A CongURE state object on success
+ * @return  NULL, if no free CongURE state object is available (including when
+ *          module `gnrc_tcp_congure` is not included).
+ */
+congure_snd_t *gnrc_tcp_congure_snd_get(void);
+#else
+static inline congure_snd_t *gnrc_tcp_congure_snd_get(void)
+{
+    return NULL;
+}
+#endif
+
+/**
+ * @brief   Frees the CongURE state object
+ *
+ * This makes a CongURE state object retrievable with
+ * @ref gnrc_tcp_congure_snd_get again.
+ *
+ * @param[in] c     A CongURE state object. May be NULL.
+ */
+static inline void gnrc_tcp_congure_snd_free(congure_snd_t *c)
+{
+    if (c != NULL) {
+        c->driver = NULL;
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -19,6 +19,7 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "ringbuffer.h"
 #include "mutex.h"
@@ -33,10 +34,41 @@
 #include "net/gnrc/ipv6.h"
 #endif
 
+#ifdef MODULE_GNRC_TCP_CONGURE
+#include "congure.h"
+#endif
+
+#if defined(SOCK_HAS_ASYNC) && defined(MODULE_SOCK_TCP)
+/* The asynchronous sock types include the GNRC sock types, which in turn refer
+ * to the TCB types: declare them up front */
+typedef struct sock_tcp gnrc_tcp_tcb_t;
+typedef struct sock_tcp_queue gnrc_tcp_tcb_queue_t;
+#include "net/sock/async/types.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief Size of the retransmission queue of a TCB.
+ *
+ * @note One entry more than @ref CONFIG_GNRC_TCP_SND_QUEUE_SIZE, so a SYN or
+ *       FIN can always be queued behind outstanding data.
+ */
+#define GNRC_TCP_RTX_QUEUE_SIZE (CONFIG_GNRC_TCP_SND_QUEUE_SIZE + 1)
+
+/**
+ * @brief Entry of the retransmission queue of a TCB.
+ */
+typedef struct {
+    gnrc_pktsnip_t *pkt; /**< Unacknowledged segment */
+    uint32_t send_time;  /**< Timer value of the last transmission */
+    uint8_t resends;     /**< Number of retransmissions of this segment */
+    bool in_flight;      /**< Segment is accounted for by congestion control */
+    bool sacked;         /**< Segment was selectively acknowledged by the peer */
+} gnrc_tcp_rtx_entry_t;
+
 /**
  * @brief Transmission control block of GNRC TCP.
  */
@@ -53,28 +85,47 @@ typedef struct sock_tcp {
     uint8_t status;        /**< A connections status flags */
     uint32_t snd_una;      /**< Send unacknowledged */
     uint32_t snd_nxt;      /**< Send next */
-    uint16_t snd_wnd;      /**< Send window */
+    uint32_t snd_wnd;      /**< Send window */
     uint32_t snd_wl1;      /**< SeqNo. from last window update */
     uint32_t snd_wl2;      /**< AckNo. from last window update */
     uint32_t rcv_nxt;      /**< Receive next */
-    uint16_t rcv_wnd;      /**< Receive window */
+    uint32_t rcv_wnd;      /**< Receive window */
     uint32_t iss;          /**< Initial sequence sumber */
     uint32_t irs;          /**< Initial received sequence number */
     uint16_t mss;          /**< The peers MSS */
-    uint32_t rtt_start;    /**< Timer value for rtt estimation */
     int32_t rtt_var;       /**< Round trip time variance */
     int32_t srtt;          /**< Smoothed round trip time */
     int32_t rto;           /**< Retransmission timeout duration */
     uint8_t retries;       /**< Number of retransmissions */
+    uint8_t dup_acks;      /**< Number of consecutive duplicate ACKs */
+    uint8_t rtx_len;       /**< Number of segments in the retransmission queue */
+    uint32_t recover;      /**< snd_nxt at the start of the last loss recovery */
+    uint32_t high_rxt;     /**< End of the last segment resent during loss recovery */
+    uint8_t options;       /**< Options negotiated with the peer */
+    uint8_t snd_wnd_scale; /**< Shift count for windows received from the peer */
+    uint8_t rcv_wnd_scale; /**< Shift count for windows sent to the peer */
+    uint32_t ts_recent;    /**< Timestamp to echo to the peer */
     evtimer_msg_event_t event_retransmit; /**< Retransmission event */
     evtimer_msg_event_t event_timeout;    /**< Timeout event */
     evtimer_mbox_event_t event_misc;      /**< General purpose event */
-    gnrc_pktsnip_t *pkt_retransmit;       /**< Pointer to packet in "retransmit queue" */
+    gnrc_tcp_rtx_entry_t rtx[GNRC_TCP_RTX_QUEUE_SIZE]; /**< Retransmission queue, oldest first */
+#if defined(MODULE_GNRC_TCP_CONGURE) || defined(DOXYGEN)
+    congure_snd_t *congure;  /**< Congestion control state */
+#endif
     mbox_t *mbox;            /**< TCB mbox for synchronization */
     uint8_t *rcv_buf_raw;    /**< Pointer to the receive buffer */
+    uint32_t rcv_buf_limit;  /**< Maximum receive buffer size, zero for the default */
     ringbuffer_t rcv_buf;    /**< Receive buffer data structure */
     mutex_t fsm_lock;        /**< Mutex for FSM access synchronization */
     mutex_t function_lock;   /**< Mutex for function call synchronization */
+#if (defined(SOCK_HAS_ASYNC) && defined(MODULE_SOCK_TCP)) || defined(DOXYGEN)
+    struct sock_tcp_queue *queue; /**< Listening queue the TCB belongs to */
+    sock_tcp_cb_t async_cb;       /**< Asynchronous event callback */
+    void *async_cb_arg;           /**< Argument of gnrc_tcp_tcb_t::async_cb */
+#if defined(SOCK_HAS_ASYNC_CTX) || defined(DOXYGEN)
+    sock_async_ctx_t async_ctx;   /**< Asynchronous event context */
+#endif
+#endif
     struct sock_tcp *next;   /**< Pointer next TCB */
 } gnrc_tcp_tcb_t;
 
@@ -85,6 +136,13 @@ typedef struct sock_tcp_queue {
     mutex_t lock;         /**< Mutex for access synchronization */
     gnrc_tcp_tcb_t *tcbs; /**< Pointer to TCB sequence */
     size_t tcbs_len;      /**< Number of TCBs behind member tcbs */
+#if (defined(SOCK_HAS_ASYNC) && defined(MODULE_SOCK_TCP)) || defined(DOXYGEN)
+    sock_tcp_queue_cb_t async_cb; /**< Asynchronous event callback */
+    void *async_cb_arg;           /**< Argument of gnrc_tcp_tcb_queue_t::async_cb */
+#if defined(SOCK_HAS_ASYNC_CTX) || defined(DOXYGEN)
+    sock_async_ctx_t async_ctx;   /**< Asynchronous event context */
+#endif
+#endif
 } gnrc_tcp_tcb_queue_t;
 
 /**
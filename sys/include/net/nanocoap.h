@@ -1195,6 +1195,27 @@ void coap_block_slicer_init(coap_block_slicer_t *slicer, size_t blknum,
 size_t coap_blockwise_put_bytes(coap_block_slicer_t *slicer, uint8_t *bufpos,
                                 const void *c, size_t len);
 
+/**
+ * @brief Add a byte array to a block2 reply without copying it.
+ *
+ * Like coap_blockwise_put_bytes(), but instead of copying the part of @p c
+ * within the current block, @p snip is set to point to it and is attached to
+ * @p pkt with coap_payload_add_snip(). Nothing is attached if no part of @p c
+ * is within the block.
+ *
+ * @param[in]   slicer      slicer to use
+ * @param[out]  pkt         packet to attach @p snip to
+ * @param[out]  snip        snip to use for the part of @p c within the block,
+ *                          must stay valid until the packet was sent
+ * @param[in]   c           byte array to reference, must stay valid until the
+ *                          packet was sent
+ * @param[in]   len         length of the byte array
+ *
+ * @returns     Number of bytes attached to @p pkt
+ */
+size_t coap_blockwise_put_snip(coap_block_slicer_t *slicer, coap_pkt_t *pkt,
+                               iolist_t *snip, const void *c, size_t len);
+
 /**
  * @brief Add a single character to a block2 reply.
  *
@@ -2283,6 +2304,27 @@ static inline void coap_payload_advance_bytes(coap_pkt_t *pkt, size_t len)
     pkt->payload_len -= len;
 }
 
+/**
+ * @brief   Attach a payload buffer to the CoAP packet without copying it.
+ *
+ * @pre     @ref coap_opt_finish must have been called before with
+ *               the @ref COAP_OPT_FINISH_PAYLOAD option.
+ *
+ * @p snip is appended to @ref coap_pkt_t::snips and is sent after the payload
+ * in the packet buffer. This way a large representation can be sent from
+ * where it already is, e.g. from flash, without a packet buffer to hold it.
+ *
+ * Once a snip was attached, no more payload must be written to the packet
+ * buffer. The length of the packet still only covers the packet buffer, a
+ * resource handler returns it as usual.
+ *
+ * @param[in,out]   pkt     pkt to add payload to
+ * @param[in]       snip    payload snip, it and the data it points to must
+ *                          stay valid until the packet was sent, so neither
+ *                          may be on the stack of a resource handler
+ */
+void coap_payload_add_snip(coap_pkt_t *pkt, iolist_t *snip);
+
 /**
  * @brief   Add payload data to the CoAP request.
  *
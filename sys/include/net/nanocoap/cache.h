@@ -13,6 +13,20 @@
  * @ingroup     net_nanocoap
  * @brief       A cache implementation for nanocoap response messages
  *
+ * Cache entries are found by their cache key in a hash table of
+ * @ref CONFIG_NANOCOAP_CACHE_BUCKETS buckets. The cached responses share a
+ * buffer of @ref CONFIG_NANOCOAP_CACHE_SIZE bytes, so the number of responses
+ * that fit into the cache depends on their size, up to
+ * @ref CONFIG_NANOCOAP_CACHE_ENTRIES responses. When there is not enough
+ * space for a new response, least recently used entries are replaced, stale
+ * entries first.
+ *
+ * Entries expire after their Max-Age. On every access, the cache checks if the
+ * earliest Max-Age of its entries has passed, and if so removes all stale
+ * entries in a single sweep. Stale entries with an ETag are kept, so they can
+ * still be validated (see [RFC 7252, section 5.6.2]
+ * (https://datatracker.ietf.org/doc/html/rfc7252#section-5.6.2)).
+ *
  * @{
  *
  * @file
@@ -27,6 +41,7 @@
 #include "clist.h"
 #include "net/nanocoap.h"
 #include "hashes/sha256.h"
+#include "hashes/siphash.h"
 #include "ztimer.h"
 
 #ifdef __cplusplus
@@ -42,22 +57,57 @@ extern "C" {
 
 /**
  * @brief The length of the cache key in bytes.
+ *
+ * Must not exceed @ref SIPHASH_DIGEST_LENGTH with
+ * @ref CONFIG_NANOCOAP_CACHE_KEY_SIPHASH.
  */
 #ifndef CONFIG_NANOCOAP_CACHE_KEY_LENGTH
 #define CONFIG_NANOCOAP_CACHE_KEY_LENGTH       (8)
 #endif
 
+#ifdef DOXYGEN
 /**
- * @brief Size of the buffer to store responses in the cache.
+ * @brief Derive cache keys with SipHash instead of SHA-256 (disabled per
+ *        default)
+ *
+ * SHA-256 over the options of every request is expensive on small MCUs, e.g.
+ * for a forward proxy that looks up every request in the cache. SipHash-2-4
+ * is much cheaper and still keeps remote endpoints from forging colliding
+ * cache keys, as its key is drawn randomly in nanocoap_cache_init(). The
+ * cache key then is at most @ref SIPHASH_DIGEST_LENGTH bytes long, so cache
+ * keys differ from those of other nodes and between reboots.
+ */
+#define CONFIG_NANOCOAP_CACHE_KEY_SIPHASH
+#endif
+
+/**
+ * @brief Maximum size of a response stored in the cache.
  */
 #ifndef CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE
 #define CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE    (128)
 #endif
 
+/**
+ * @brief Size of the buffer all responses in the cache are stored in.
+ */
+#ifndef CONFIG_NANOCOAP_CACHE_SIZE
+#define CONFIG_NANOCOAP_CACHE_SIZE             (CONFIG_NANOCOAP_CACHE_ENTRIES * \
+                                                CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE)
+#endif
+
+/**
+ * @brief Number of buckets of the hash table to look up cache entries.
+ *
+ * Must be a power of two.
+ */
+#ifndef CONFIG_NANOCOAP_CACHE_BUCKETS
+#define CONFIG_NANOCOAP_CACHE_BUCKETS          (8)
+#endif
+
 /**
  * @brief   Cache container that holds a @p coap_pkt_t struct.
  */
-typedef struct {
+typedef struct nanocoap_cache_entry {
     /**
      * @brief needed for clist_t, must be the first struct member!
      */
@@ -74,9 +124,17 @@ typedef struct {
     coap_pkt_t response_pkt;
 
     /**
-     * @brief buffer to hold the response message.
+     * @brief the response message in the buffer of the cache.
+     *
+     * The response may be moved within the buffer when other entries are
+     * removed from the cache, so don't keep pointers into it.
+     */
+    uint8_t *response_buf;
+
+    /**
+     * @brief next entry in the same bucket of the hash table
      */
-    uint8_t response_buf[CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE];
+    struct nanocoap_cache_entry *bucket_next;
 
     size_t response_len; /**< length of the message in @p response */
 
@@ -92,6 +150,16 @@ typedef struct {
     uint32_t max_age;
 } nanocoap_cache_entry_t;
 
+/**
+ * @brief   Cache statistics
+ */
+typedef struct {
+    uint32_t hits;          /**< lookups that found an entry, fresh or stale */
+    uint32_t misses;        /**< lookups that found no entry */
+    uint32_t evictions;     /**< entries replaced to make room for others */
+    uint32_t expirations;   /**< stale entries removed by the expiry sweep */
+} nanocoap_cache_stats_t;
+
 /**
  * @brief Typedef for the cache replacement strategy on full cache list.
  *
@@ -136,6 +204,20 @@ size_t nanocoap_cache_used_count(void);
  */
 size_t nanocoap_cache_free_count(void);
 
+/**
+ * @brief   Returns the number of bytes used by cached responses.
+ *
+ * @return  Number of bytes of @ref CONFIG_NANOCOAP_CACHE_SIZE in use
+ */
+size_t nanocoap_cache_used_bytes(void);
+
+/**
+ * @brief   Gets the statistics of the cache since nanocoap_cache_init().
+ *
+ * @param[out] stats    The statistics
+ */
+void nanocoap_cache_stats_get(nanocoap_cache_stats_t *stats);
+
 /**
  * @brief   Determines if a response is cacheable and modifies the cache
  *          as reflected in RFC7252, Section 5.9.
@@ -215,7 +297,8 @@ int nanocoap_cache_del(const nanocoap_cache_entry_t *ce);
  * @brief   Generates a cache key based on the request @p req.
  *
  * @param[in] req           The request to generate the cache key from
- * @param[out] cache_key    The generated cache key
+ * @param[out] cache_key    The generated cache key, @p cache_key must hold
+ *                          SHA256_DIGEST_LENGTH bytes
  */
 void nanocoap_cache_key_generate(const coap_pkt_t *req, uint8_t *cache_key);
 
@@ -223,7 +306,8 @@ void nanocoap_cache_key_generate(const coap_pkt_t *req, uint8_t *cache_key);
  * @brief   Generates a cache key based on only the options in @p req
  *
  * @param[in] req           The request to generate the cache key from
- * @param[out] cache_key    The generated cache key of SHA256_DIGEST_LENGTH bytes
+ * @param[out] cache_key    The generated cache key, @p cache_key must hold
+ *                          SHA256_DIGEST_LENGTH bytes
  */
 void nanocoap_cache_key_options_generate(const coap_pkt_t *req, void *cache_key);
 
@@ -235,7 +319,8 @@ void nanocoap_cache_key_options_generate(const coap_pkt_t *req, void *cache_key)
  * blockwise transfer with each other.
  *
  * @param[in] req           The request to generate the cache key from
- * @param[out] cache_key    The generated cache key of SHA256_DIGEST_LENGTH bytes
+ * @param[out] cache_key    The generated cache key, @p cache_key must hold
+ *                          SHA256_DIGEST_LENGTH bytes
  */
 void nanocoap_cache_key_blockreq_options_generate(const coap_pkt_t *req, void *cache_key);
 
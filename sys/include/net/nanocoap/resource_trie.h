@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#pragma once
+
+/**
+ * @defgroup    net_nanocoap_resource_trie nanoCoAP resource index
+ * @ingroup     net_nanocoap
+ * @brief       Radix trie to look up the resource for a request path
+ *
+ * Without this module, @ref coap_tree_handler() and the default request
+ * matcher of @ref net_gcoap compare the request path with every resource of
+ * the resource array in turn. With `USEMODULE += nanocoap_resource_trie`,
+ * resource arrays are indexed in a radix trie over the characters of the
+ * resource paths instead, so the look-up only depends on the length of the
+ * request path.
+ *
+ * gcoap indexes the resources of a listener when it is registered, nanocoap
+ * indexes a resource array when it is first passed to
+ * @ref coap_tree_handler(). The result of a look-up is the same as with the
+ * linear search: the first resource of the array that matches the path
+ * (as in @ref coap_match_path()) and the method of the request. Resource
+ * arrays thus don't need to be sorted for the index.
+ *
+ * The index is kept in static pools. If they are exhausted, the remaining
+ * resource arrays are searched linearly.
+ *
+ * @{
+ *
+ * @file
+ * @brief       nanoCoAP resource index API
+ */
+
+#include <stddef.h>
+
+#include "net/nanocoap.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Maximum number of resource arrays to index
+ */
+#ifndef CONFIG_NANOCOAP_RESOURCE_TRIE_ARRAYS
+#define CONFIG_NANOCOAP_RESOURCE_TRIE_ARRAYS    (4)
+#endif
+
+/**
+ * @brief   Maximum number of resources to index over all resource arrays
+ */
+#ifndef CONFIG_NANOCOAP_RESOURCE_TRIE_RESOURCES
+#define CONFIG_NANOCOAP_RESOURCE_TRIE_RESOURCES (32)
+#endif
+
+/**
+ * @brief   Maximum number of trie nodes over all resource arrays
+ *
+ * An array with `n` resources needs at most `2 * n` nodes.
+ */
+#ifndef CONFIG_NANOCOAP_RESOURCE_TRIE_NODES
+#define CONFIG_NANOCOAP_RESOURCE_TRIE_NODES     (2 * CONFIG_NANOCOAP_RESOURCE_TRIE_RESOURCES)
+#endif
+
+/**
+ * @brief   Indexes a resource array
+ *
+ * Indexing an array a second time has no effect. The resource array and the
+ * paths of its resources must not change after they were indexed.
+ *
+ * @param[in] resources         the resource array
+ * @param[in] resources_numof   number of resources in @p resources
+ *
+ * @retval  0           on success
+ * @retval  -ENOMEM     if the pools of the index are exhausted. The array is
+ *                      not indexed then.
+ * @retval  -EINVAL     if a resource path is too long to be indexed
+ */
+int coap_resource_trie_add(const coap_resource_t *resources,
+                           size_t resources_numof);
+
+/**
+ * @brief   Looks up the resource for a request in an indexed resource array
+ *
+ * @param[in] resources         the resource array
+ * @param[in] resources_numof   number of resources in @p resources
+ * @param[in] uri               the path of the request
+ * @param[in] method_flag       the method of the request as flag
+ *                              (see @ref coap_method2flag())
+ * @param[out] resource         the resource found
+ *
+ * @retval  0           if a resource was found
+ * @retval  -ENOENT     if no resource matches @p uri
+ * @retval  -ENOTSUP    if resources match @p uri, but not @p method_flag
+ * @retval  -ENXIO      if @p resources is not indexed
+ */
+int coap_resource_trie_find(const coap_resource_t *resources,
+                            size_t resources_numof, const char *uri,
+                            coap_method_flags_t method_flag,
+                            const coap_resource_t **resource);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
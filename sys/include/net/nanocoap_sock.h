@@ -189,6 +189,32 @@ extern "C" {
 #define CONFIG_NANOCOAP_SOCK_BLOCK_TOKEN        (0)
 #endif
 
+/**
+ * @brief   Maximum number of block requests a pipelined block-wise GET
+ *          keeps in flight
+ *
+ * This sizes the request state kept on the stack of
+ * @ref nanocoap_sock_get_blockwise_pipelined, larger windows requested from
+ * that function are capped at this value.
+ */
+#ifndef CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW_MAX
+#define CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW_MAX   (8U)
+#endif
+
+/**
+ * @brief   Number of block requests in flight for block-wise GETs that
+ *          re-assemble into a buffer or file
+ *
+ * Used by @ref nanocoap_get_blockwise_to_buf,
+ * @ref nanocoap_get_blockwise_url_to_buf and the `nanocoap_vfs` download
+ * functions. Those re-assemble blocks by their offset, so they can process
+ * blocks out of order. With a value of 1 (the default) blocks are fetched one
+ * after another.
+ */
+#ifndef CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW
+#define CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW       (1U)
+#endif
+
 /**
  * @brief   Event priority for nanoCoAP sock events (e.g. used by `nanocoap_sock_observe`)
  */
@@ -850,6 +876,37 @@ int nanocoap_sock_get_blockwise(nanocoap_sock_t *sock, const char *path,
                                 coap_blksize_t blksize,
                                 coap_blockwise_cb_t callback, void *arg);
 
+/**
+ * @brief    Performs a pipelined blockwise coap get request on a socket.
+ *
+ * Like @ref nanocoap_sock_get_blockwise, but keeps up to @p window block
+ * requests in flight instead of waiting for each block before requesting the
+ * next one. This hides the round-trip time on multi-hop paths.
+ *
+ * Responses are matched to requests by their token and each request is
+ * retransmitted on its own, so blocks may be handed to @p callback out of
+ * order. @p callback must thus place each block by its offset (as e.g.
+ * @ref nanocoap_get_blockwise_to_buf does). Each block of the resource is
+ * passed to @p callback exactly once.
+ *
+ * @pre The server must answer with the block size given in @p blksize.
+ *
+ * @param[in]   sock       socket to use for the request
+ * @param[in]   path       pointer to source path
+ * @param[in]   blksize    sender suggested SZX for the COAP block request
+ * @param[in]   window     number of block requests to keep in flight,
+ *                         capped at @ref CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW_MAX
+ * @param[in]   callback   callback to be executed on each received block
+ * @param[in]   arg        optional function arguments
+ *
+ * @returns      0         on success
+ * @returns     -ETIMEDOUT if a block request was not answered
+ * @returns     <0         on any other error
+ */
+int nanocoap_sock_get_blockwise_pipelined(nanocoap_sock_t *sock, const char *path,
+                                          coap_blksize_t blksize, unsigned window,
+                                          coap_blockwise_cb_t callback, void *arg);
+
 /**
  * @brief    Performs a blockwise coap get request to the specified url, store
  *           the response in a buffer.
@@ -69,6 +69,14 @@ typedef struct {
     uint32_t rx_bytes;          /**< received bytes */
 } netstats_t;
 
+/**
+ * @brief       Statistics of a lookup cache
+ */
+typedef struct {
+    uint32_t hits;              /**< lookups served from the cache */
+    uint32_t misses;            /**< lookups that needed a full look-up */
+} netstats_cache_t;
+
 /**
  * @brief       Stats per peer struct
  */
@@ -85,6 +85,7 @@ extern "C" {
  *
  * This function will synchronously try to resolve a DNS A or AAAA record by contacting
  * the DNS server specified in the global variable @ref sock_dns_server.
+ * See @ref net_sock_dns_async to resolve names without blocking.
  *
  * By supplying AF_INET, AF_INET6 or AF_UNSPEC in @p family requesting of A
  * records (IPv4), AAAA records (IPv6) or both can be selected.
@@ -100,6 +101,7 @@ extern "C" {
  * @param[in]   family          Either AF_INET, AF_INET6 or AF_UNSPEC
  *
  * @return      the size of the resolved address on success
+ * @return      -ENXIO if the domain name has no address of @p family
  * @return      < 0 otherwise
  */
 int sock_dns_query(const char *domain_name, void *addr_out, int family);
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#pragma once
+
+/**
+ * @defgroup    net_sock_dns_async  Asynchronous DNS sock API
+ * @ingroup     net_sock_dns
+ *
+ * @brief       Asynchronous sock DNS client
+ *
+ * Unlike @ref sock_dns_query(), the resolver does not block the calling
+ * thread. It sends its queries to the DNS server in @ref sock_dns_server and
+ * handles the replies and timeouts in the event thread of
+ * @ref CONFIG_SOCK_DNS_ASYNC_EVENT_PRIO, where it also calls the callbacks of
+ * the requests.
+ *
+ * - Queries for different names are in flight at the same time, up to
+ *   @ref CONFIG_SOCK_DNS_ASYNC_QUERIES_NUMOF.
+ * - A request for `AF_UNSPEC` sends the A and the AAAA query at the same time,
+ *   each in its own message. An IPv6 address is preferred: an IPv4 address is
+ *   only reported once the AAAA query failed.
+ * - A request for a name and address family that is already being resolved
+ *   does not send another query, but waits for the reply to the first one.
+ * - With the @ref net_dns_cache, a request is answered from the cache if
+ *   possible, the addresses and negative replies are stored in the cache, and
+ *   an expired address is reported if the server does not answer.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static void _resolved(void *arg, int res, const void *addr)
+ * {
+ *     if (res == sizeof(ipv6_addr_t)) {
+ *         ipv6_addr_print(addr);
+ *     }
+ * }
+ *
+ * static sock_dns_async_req_t req;
+ *
+ * sock_dns_query_async(&req, "example.org", AF_INET6, _resolved, NULL);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief   Asynchronous DNS sock definitions
+ */
+
+#include "event/thread.h"
+#include "net/sock/dns.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup    net_sock_dns_async_conf Asynchronous DNS compile-time configuration
+ * @ingroup     config
+ * @{
+ */
+/**
+ * @brief   Maximum number of queries in flight at the same time
+ *
+ * A request for `AF_UNSPEC` takes one query, even though it sends two
+ * messages. Requests that wait for the same query do not count.
+ */
+#ifndef CONFIG_SOCK_DNS_ASYNC_QUERIES_NUMOF
+#define CONFIG_SOCK_DNS_ASYNC_QUERIES_NUMOF (4U)
+#endif
+
+/**
+ * @brief   Timeout for a reply from the DNS server in milliseconds
+ *
+ * Unanswered messages are retransmitted @ref SOCK_DNS_RETRIES times in total.
+ */
+#ifndef CONFIG_SOCK_DNS_ASYNC_TIMEOUT_MS
+#define CONFIG_SOCK_DNS_ASYNC_TIMEOUT_MS    (1000U)
+#endif
+
+/**
+ * @brief   Event queue that handles the replies and calls the callbacks
+ */
+#ifndef CONFIG_SOCK_DNS_ASYNC_EVENT_PRIO
+#define CONFIG_SOCK_DNS_ASYNC_EVENT_PRIO    EVENT_PRIO_MEDIUM
+#endif
+/** @} */
+
+/**
+ * @brief   Callback for a resolved name
+ *
+ * @param[in] arg   The argument given to @ref sock_dns_query_async()
+ * @param[in] res   The size of the address on success, -ENXIO if the name has
+ *                  no address of the requested family, -ETIMEDOUT if the
+ *                  server did not answer, or another negative errno value
+ * @param[in] addr  The address if @p res > 0. Only valid during the callback.
+ */
+typedef void (*sock_dns_async_cb_t)(void *arg, int res, const void *addr);
+
+/**
+ * @brief   Request type
+ */
+typedef struct sock_dns_async_req sock_dns_async_req_t;
+
+/**
+ * @brief   Asynchronous DNS request
+ *
+ * @note    The members are private, the object must stay valid until the
+ *          callback was called or the request was cancelled.
+ */
+struct sock_dns_async_req {
+    sock_dns_async_req_t *next;     /**< next request waiting for the query */
+    sock_dns_async_cb_t cb;         /**< callback */
+    void *arg;                      /**< callback argument */
+};
+
+/**
+ * @brief   Resolve a DNS name asynchronously
+ *
+ * If the name is in the @ref net_dns_cache, @p cb is called before this
+ * function returns.
+ *
+ * @param[out]  req         Request object, to be kept until @p cb is called
+ * @param[in]   domain_name DNS name to resolve, copied by the resolver
+ * @param[in]   family      Either AF_INET, AF_INET6 or AF_UNSPEC
+ * @param[in]   cb          Callback for the result
+ * @param[in]   arg         Argument for @p cb
+ *
+ * @return      0 if @p cb was or will be called
+ * @return      -ECONNREFUSED if no DNS server is configured
+ * @return      -ENOSPC if @p domain_name is too long
+ * @return      -EAFNOSUPPORT if @p family is not supported
+ * @return      -ENOBUFS if @ref CONFIG_SOCK_DNS_ASYNC_QUERIES_NUMOF queries
+ *              are already in flight
+ * @return      < 0 if the query could not be sent
+ */
+int sock_dns_query_async(sock_dns_async_req_t *req, const char *domain_name,
+                         int family, sock_dns_async_cb_t cb, void *arg);
+
+/**
+ * @brief   Cancel a request
+ *
+ * The callback of @p req will not be called after this function returned.
+ * The query is not aborted, its reply is still stored in the cache.
+ *
+ * @note    This function must not be called from the callback.
+ *
+ * @param[in]   req     The request to cancel
+ */
+void sock_dns_async_cancel(sock_dns_async_req_t *req);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
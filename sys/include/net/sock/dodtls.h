@@ -91,6 +91,7 @@ extern "C" {
  * @return      -ENOSPC, when the length of @p domain_name is greater than @ref
  *              SOCK_DODTLS_MAX_NAME_LEN.
  * @return      -EBADSG, when the DNS reply is not parseable.
+ * @return      -ENXIO, when the domain name has no address of @p family.
  */
 int sock_dodtls_query(const char *domain_name, void *addr_out, int family);
 
@@ -375,6 +375,26 @@ typedef struct {
     sock_aux_flags_t flags; /**< Flags used request information */
 } sock_udp_aux_tx_t;
 
+/**
+ * @brief   A UDP message received with @ref sock_udp_recv_many()
+ */
+typedef struct {
+    void *data;                 /**< buffer to store the payload in */
+    /**
+     * @brief   Length of sock_udp_msg_t::data
+     *
+     * The space available at sock_udp_msg_t::data on input and the length of
+     * the received payload on output.
+     */
+    size_t len;
+    /**
+     * @brief   Remote end point of the message
+     *
+     * May be `NULL`, if it is not required by the application.
+     */
+    sock_udp_ep_t *remote;
+} sock_udp_msg_t;
+
 /**
  * @brief   Creates a new UDP sock object
  *
@@ -799,6 +819,171 @@ static inline ssize_t sock_udp_sendv(sock_udp_t *sock,
     return sock_udp_sendv_aux(sock, snips, remote, NULL);
 }
 
+/**
+ * @brief   Receives a batch of UDP messages from remote end points
+ *
+ * Waits for the first message like @ref sock_udp_recv() and then takes the
+ * messages already received by the sock without waiting any further, until
+ * @p num messages are received.
+ *
+ * @pre `(sock != NULL) && (msgs != NULL) && (num > 0)`
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[in,out] msgs  The messages to receive into. sock_udp_msg_t::len of
+ *                      each received message is set to the length of its
+ *                      payload.
+ * @param[in] num       Number of elements in @p msgs.
+ * @param[in] timeout   Timeout for the first message in microseconds.
+ *                      If 0 and no data is available, the function returns
+ *                      immediately.
+ *                      May be @ref SOCK_NO_TIMEOUT for no timeout (wait until
+ *                      data is available).
+ *
+ * @experimental    This function is quite new, not implemented for all stacks
+ *                  yet, and may be subject to sudden API changes. Do not use in
+ *                  production if this is unacceptable.
+ *
+ * @note    A message that does not fit into its buffer ends the batch. It is
+ *          dropped, as with @ref sock_udp_recv().
+ *
+ * @return  The number of messages received on success.
+ * @return  Any error @ref sock_udp_recv() returns for the first message.
+ */
+int sock_udp_recv_many(sock_udp_t *sock, sock_udp_msg_t *msgs, unsigned num,
+                       uint32_t timeout);
+
+/**
+ * @brief   Provides stack-internal buffer space to write a UDP message to be
+ *          sent into
+ *
+ * The stack reserves the room for the headers of the message along with the
+ * buffer space, so the message can be sent with @ref sock_udp_send_buf_aux()
+ * without copying it or allocating headers for it.
+ *
+ * @pre `(data != NULL) && (buf_ctx != NULL)`
+ *
+ * @param[out] data     Pointer to a stack-internal buffer space of @p len
+ *                      bytes to write the payload into.
+ * @param[out] buf_ctx  Stack-internal buffer context. Must be handed to either
+ *                      @ref sock_udp_send_buf_aux() or
+ *                      @ref sock_udp_send_buf_free().
+ * @param[in] len       Maximum length of the payload.
+ *
+ * @experimental    This function is quite new, not implemented for all stacks
+ *                  yet, and may be subject to sudden API changes. Do not use in
+ *                  production if this is unacceptable.
+ *
+ * @return  0 on success.
+ * @return  -ENOMEM, if no memory was available for @p len bytes of payload.
+ */
+int sock_udp_send_buf_alloc(void **data, void **buf_ctx, size_t len);
+
+/**
+ * @brief   Sends a UDP message written into buffer space provided by
+ *          @ref sock_udp_send_buf_alloc() to remote end point
+ *
+ * @pre `((sock != NULL || remote != NULL)) && (buf_ctx != NULL)`
+ *
+ * @param[in] sock      A UDP sock object. May be `NULL`.
+ *                      A sensible local end point should be selected by the
+ *                      implementation in that case.
+ * @param[in] buf_ctx   Stack-internal buffer context as provided by
+ *                      @ref sock_udp_send_buf_alloc(). It is released by this
+ *                      function, even on error.
+ * @param[in] len       Length of the payload written to the buffer space.
+ *                      Must not exceed the length it was allocated with.
+ * @param[in] remote    Remote end point for the sent data.
+ *                      May be `NULL`, if @p sock has a remote end point.
+ *                      sock_udp_ep_t::family may be AF_UNSPEC, if local
+ *                      end point of @p sock provides this information.
+ *                      sock_udp_ep_t::port may not be 0.
+ * @param[out] aux      Auxiliary data about the transmission.
+ *                      May be `NULL`, if it is not required by the application.
+ *
+ * @experimental    This function is quite new, not implemented for all stacks
+ *                  yet, and may be subject to sudden API changes. Do not use in
+ *                  production if this is unacceptable.
+ *
+ * @return  The number of bytes sent on success.
+ * @return  -EADDRINUSE, if `sock` has no local end-point or was `NULL` and the
+ *          pool of available ephemeral ports is depleted.
+ * @return  -EAFNOSUPPORT, if `remote != NULL` and sock_udp_ep_t::family of
+ *          @p remote is != AF_UNSPEC and not supported.
+ * @return  -EHOSTUNREACH, if @p remote or remote end point of @p sock is not
+ *          reachable.
+ * @return  -EINVAL, if sock_udp_ep_t::addr of @p remote is an invalid address.
+ * @return  -EINVAL, if sock_udp_ep_t::netif of @p remote is not a valid
+ *          interface or contradicts the given local interface (i.e.
+ *          neither the local end point of `sock` nor remote are assigned to
+ *          `SOCK_ADDR_ANY_NETIF` but are nevertheless different.
+ * @return  -EINVAL, if sock_udp_ep_t::port of @p remote is 0.
+ * @return  -ENOMEM, if no memory was available to send the message.
+ * @return  -ENOTCONN, if `remote == NULL`, but @p sock has no remote end point.
+ */
+ssize_t sock_udp_send_buf_aux(sock_udp_t *sock, void *buf_ctx, size_t len,
+                              const sock_udp_ep_t *remote,
+                              sock_udp_aux_tx_t *aux);
+
+/**
+ * @brief   Sends a UDP message written into buffer space provided by
+ *          @ref sock_udp_send_buf_alloc() to remote end point
+ *
+ * @pre `((sock != NULL || remote != NULL)) && (buf_ctx != NULL)`
+ *
+ * @param[in] sock      A UDP sock object. May be `NULL`.
+ *                      A sensible local end point should be selected by the
+ *                      implementation in that case.
+ * @param[in] buf_ctx   Stack-internal buffer context as provided by
+ *                      @ref sock_udp_send_buf_alloc(). It is released by this
+ *                      function, even on error.
+ * @param[in] len       Length of the payload written to the buffer space.
+ *                      Must not exceed the length it was allocated with.
+ * @param[in] remote    Remote end point for the sent data.
+ *                      May be `NULL`, if @p sock has a remote end point.
+ *                      sock_udp_ep_t::family may be AF_UNSPEC, if local
+ *                      end point of @p sock provides this information.
+ *                      sock_udp_ep_t::port may not be 0.
+ *
+ * @experimental    This function is quite new, not implemented for all stacks
+ *                  yet, and may be subject to sudden API changes. Do not use in
+ *                  production if this is unacceptable.
+ *
+ * @return  The number of bytes sent on success.
+ * @return  -EADDRINUSE, if `sock` has no local end-point or was `NULL` and the
+ *          pool of available ephemeral ports is depleted.
+ * @return  -EAFNOSUPPORT, if `remote != NULL` and sock_udp_ep_t::family of
+ *          @p remote is != AF_UNSPEC and not supported.
+ * @return  -EHOSTUNREACH, if @p remote or remote end point of @p sock is not
+ *          reachable.
+ * @return  -EINVAL, if sock_udp_ep_t::addr of @p remote is an invalid address.
+ * @return  -EINVAL, if sock_udp_ep_t::netif of @p remote is not a valid
+ *          interface or contradicts the given local interface (i.e.
+ *          neither the local end point of `sock` nor remote are assigned to
+ *          `SOCK_ADDR_ANY_NETIF` but are nevertheless different.
+ * @return  -EINVAL, if sock_udp_ep_t::port of @p remote is 0.
+ * @return  -ENOMEM, if no memory was available to send the message.
+ * @return  -ENOTCONN, if `remote == NULL`, but @p sock has no remote end point.
+ */
+static inline ssize_t sock_udp_send_buf(sock_udp_t *sock, void *buf_ctx,
+                                        size_t len,
+                                        const sock_udp_ep_t *remote)
+{
+    return sock_udp_send_buf_aux(sock, buf_ctx, len, remote, NULL);
+}
+
+/**
+ * @brief   Releases buffer space provided by @ref sock_udp_send_buf_alloc()
+ *          without sending it
+ *
+ * @param[in] buf_ctx   Stack-internal buffer context as provided by
+ *                      @ref sock_udp_send_buf_alloc().
+ *
+ * @experimental    This function is quite new, not implemented for all stacks
+ *                  yet, and may be subject to sudden API changes. Do not use in
+ *                  production if this is unacceptable.
+ */
+void sock_udp_send_buf_free(void *buf_ctx);
+
 /**
  * @brief   Checks if the IP address of an endpoint is multicast
  *
@@ -39,17 +39,25 @@ extern "C" {
  * @brief TCP Option "Kind"-field defines.
  * @{
  */
-#define TCP_OPTION_KIND_EOL (0x00)  /**< "End of List"-Option */
-#define TCP_OPTION_KIND_NOP (0x01)  /**< "No Operation"-Option */
-#define TCP_OPTION_KIND_MSS (0x02)  /**< "Maximum Segment Size"-Option */
+#define TCP_OPTION_KIND_EOL       (0x00)  /**< "End of List"-Option */
+#define TCP_OPTION_KIND_NOP       (0x01)  /**< "No Operation"-Option */
+#define TCP_OPTION_KIND_MSS       (0x02)  /**< "Maximum Segment Size"-Option */
+#define TCP_OPTION_KIND_WS        (0x03)  /**< "Window Scale"-Option */
+#define TCP_OPTION_KIND_SACK_PERM (0x04)  /**< "SACK Permitted"-Option */
+#define TCP_OPTION_KIND_SACK      (0x05)  /**< "SACK"-Option */
+#define TCP_OPTION_KIND_TS        (0x08)  /**< "Timestamps"-Option */
 /** @} */
 
 /**
  * @brief TCP option "length"-field values.
  * @{
  */
-#define TCP_OPTION_LENGTH_MIN (2U)    /**< Minimum option field size in bytes */
-#define TCP_OPTION_LENGTH_MSS (0x04)  /**< MSS Option Size always 4 */
+#define TCP_OPTION_LENGTH_MIN        (2U)    /**< Minimum option field size in bytes */
+#define TCP_OPTION_LENGTH_MSS        (0x04)  /**< MSS Option Size always 4 */
+#define TCP_OPTION_LENGTH_WS         (0x03)  /**< Window Scale Option Size always 3 */
+#define TCP_OPTION_LENGTH_SACK_PERM  (0x02)  /**< SACK Permitted Option Size always 2 */
+#define TCP_OPTION_LENGTH_SACK_BLOCK (0x08)  /**< Size of each block in a SACK Option */
+#define TCP_OPTION_LENGTH_TS         (0x0A)  /**< Timestamps Option Size always 10 */
 /** @} */
 
 /**
@@ -15,7 +15,8 @@
  * @}
  */
 
-#include "bitfield.h"
+#include <errno.h>
+
 #include "checksum/fletcher32.h"
 #include "mutex.h"
 #include "net/af.h"
@@ -28,9 +29,15 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/* the type of an entry is the length of its address, or the length of the
+ * address it lacks for a negative entry (0 for all addresses) */
+#define TYPE_EMPTY      (0U)
+#define TYPE_NEGATIVE   (0x80U)
+
 static struct dns_cache_entry {
     uint32_t hash;
     uint32_t expires;
+    uint8_t type;
     union {
 #if IS_ACTIVE(CONFIG_DNS_CACHE_A)
         ipv4_addr_t v4;
@@ -41,58 +48,39 @@ static struct dns_cache_entry {
     } addr;
 } cache[CONFIG_DNS_CACHE_SIZE];
 static mutex_t cache_mutex = MUTEX_INIT;
+static dns_cache_stats_t cache_stats;
 
-#if IS_ACTIVE(CONFIG_DNS_CACHE_A) && IS_ACTIVE(CONFIG_DNS_CACHE_AAAA)
-BITFIELD(cache_is_v6, CONFIG_DNS_CACHE_SIZE);
-
-static inline uint8_t _get_len(unsigned idx)
+static inline bool _is_empty(unsigned idx)
 {
-    return bf_isset(cache_is_v6, idx) ? 16 : 4;
+    return cache[idx].type == TYPE_EMPTY;
 }
-#elif IS_ACTIVE(CONFIG_DNS_CACHE_A)
-static inline uint8_t _get_len(unsigned idx)
+
+static inline bool _is_negative(unsigned idx)
 {
-    (void)idx;
-    return 4;
+    return cache[idx].type & TYPE_NEGATIVE;
 }
-#elif IS_ACTIVE(CONFIG_DNS_CACHE_AAAA)
+
 static inline uint8_t _get_len(unsigned idx)
 {
-    (void)idx;
-    return 16;
+    return cache[idx].type & ~TYPE_NEGATIVE;
 }
-#endif
 
-static void _set_len(unsigned idx, uint8_t len)
+/* negative entries are never served stale */
+static bool _is_expired(unsigned idx, uint32_t now, bool stale)
 {
-#if IS_ACTIVE(CONFIG_DNS_CACHE_A) && IS_ACTIVE(CONFIG_DNS_CACHE_AAAA)
-    if (len == 16) {
-        bf_set(cache_is_v6, idx);
-    } else {
-        bf_unset(cache_is_v6, idx);
-    }
-#else
-    (void)idx;
-    (void)len;
-#endif
+    uint32_t grace = (stale && !_is_negative(idx)) ? CONFIG_DNS_CACHE_STALE_TTL : 0;
+
+    return (int32_t)(now - cache[idx].expires) > (int32_t)grace;
 }
 
-static bool _is_empty(unsigned idx)
+static inline unsigned _home(uint32_t hash)
 {
-    const uint8_t len = _get_len(idx);
-    const uint8_t *addr = (void *)&cache[idx].addr;
-    for (unsigned i = 0; i < len; ++i) {
-        if (addr[i]) {
-            return false;
-        }
-    }
-
-    return true;
+    return hash % CONFIG_DNS_CACHE_SIZE;
 }
 
-static void _set_empty(unsigned idx)
+static inline unsigned _next(unsigned idx)
 {
-    memset(&cache[idx].addr, 0, _get_len(idx));
+    return (idx + 1) % CONFIG_DNS_CACHE_SIZE;
 }
 
 static uint8_t _addr_len(int family)
@@ -103,7 +91,7 @@ static uint8_t _addr_len(int family)
         return sizeof(ipv4_addr_t);
 #endif
 #if IS_ACTIVE(CONFIG_DNS_CACHE_AAAA)
-   case AF_INET6:
+    case AF_INET6:
         return sizeof(ipv6_addr_t);
 #endif
     case AF_UNSPEC:
@@ -118,90 +106,223 @@ static uint32_t _hash(const void *data, size_t len)
     return fletcher32(data, (len + 1) / 2);
 }
 
-int dns_cache_query(const char *domain_name, void *addr_out, int family)
+static int _find(uint32_t hash, uint8_t type)
+{
+    unsigned idx = _home(hash);
+
+    for (unsigned n = 0; (n < CONFIG_DNS_CACHE_SIZE) && !_is_empty(idx); n++) {
+        if ((cache[idx].hash == hash) && (cache[idx].type == type)) {
+            return idx;
+        }
+        idx = _next(idx);
+    }
+    return -1;
+}
+
+/* moves the following entries of the probe sequence back into the gap, so a
+ * lookup can stop at the first empty slot */
+static void _remove(unsigned idx)
+{
+    unsigned next = idx;
+
+    while (((next = _next(next)) != idx) && !_is_empty(next)) {
+        unsigned home = _home(cache[next].hash);
+
+        /* the entry stays if its slot is cyclically within (idx, next] */
+        if ((idx < next) ? ((idx < home) && (home <= next))
+                         : ((idx < home) || (home <= next))) {
+            continue;
+        }
+        cache[idx] = cache[next];
+        idx = next;
+    }
+    cache[idx].type = TYPE_EMPTY;
+}
+
+static void _sweep(uint32_t now)
+{
+    for (unsigned i = 0; i < CONFIG_DNS_CACHE_SIZE; i++) {
+        /* _remove() may move another expired entry into the slot */
+        while (!_is_empty(i) && _is_expired(i, now, true)) {
+            DEBUG("dns_cache[%u] expired\n", i);
+            _remove(i);
+            cache_stats.expirations++;
+        }
+    }
+}
+
+static int _query(const char *domain_name, void *addr_out, int family, bool stale)
 {
     int res = 0;
     uint32_t now = ztimer_now(ZTIMER_MSEC) / MS_PER_SEC;
     uint32_t hash = _hash(domain_name, strlen(domain_name));
     uint8_t addr_len = _addr_len(family);
+    unsigned idx = _home(hash);
 
     mutex_lock(&cache_mutex);
-    for (unsigned i = 0; i < CONFIG_DNS_CACHE_SIZE; ++i) {
-        /* empty slot */
-        if (_is_empty(i)) {
+    for (unsigned n = 0; (n < CONFIG_DNS_CACHE_SIZE) && !_is_empty(idx); n++) {
+        unsigned i = idx;
+
+        idx = _next(idx);
+        if ((cache[i].hash != hash) || _is_expired(i, now, stale)) {
             continue;
         }
-        /* TTL expired - invalidate slot */
-        if (now > cache[i].expires) {
-            DEBUG("dns_cache[%u] expired\n", i);
-            _set_empty(i);
+        if (_is_negative(i)) {
+            /* an address of the name is still preferred */
+            if (!stale && (!_get_len(i) || (_get_len(i) == addr_len))) {
+                DEBUG("dns_cache[%u] negative hit\n", i);
+                res = -ENXIO;
+            }
             continue;
         }
-        /* check if hash and length match */
-        if (cache[i].hash == hash && (!addr_len || addr_len == _get_len(i))) {
+        if (!addr_len || (addr_len == _get_len(i))) {
             DEBUG("dns_cache[%u] hit\n", i);
             memcpy(addr_out, &cache[i].addr, _get_len(i));
             res = _get_len(i);
             break;
         }
     }
-    if (res == 0) {
+    if (stale) {
+        cache_stats.stale_hits += (res > 0);
+    }
+    else if (res > 0) {
+        cache_stats.hits++;
+    }
+    else if (res < 0) {
+        cache_stats.negative_hits++;
+    }
+    else {
         DEBUG("dns_cache miss\n");
+        cache_stats.misses++;
     }
     mutex_unlock(&cache_mutex);
     return res;
 }
 
-static void _add_entry(uint8_t i, uint32_t hash, const void *addr_out,
-                       int addr_len, uint32_t expires)
+int dns_cache_query(const char *domain_name, void *addr_out, int family)
+{
+    return _query(domain_name, addr_out, family, false);
+}
+
+int dns_cache_query_stale(const char *domain_name, void *addr_out, int family)
+{
+    if (!CONFIG_DNS_CACHE_STALE_TTL) {
+        return 0;
+    }
+    return _query(domain_name, addr_out, family, true);
+}
+
+static void _add_entry(unsigned i, uint32_t hash, uint8_t type,
+                       const void *addr_out, uint32_t expires)
 {
     DEBUG("dns_cache[%u] add cache entry\n", i);
     cache[i].hash = hash;
+    cache[i].type = type;
     cache[i].expires = expires;
-    memcpy(&cache[i].addr, addr_out, addr_len);
-    _set_len(i, addr_len);
+    if (addr_out) {
+        memcpy(&cache[i].addr, addr_out, type);
+    }
 }
 
-void dns_cache_add(const char *domain_name, const void *addr_out,
-                        int addr_len, uint32_t ttl)
+static void _add(uint32_t hash, uint8_t type, const void *addr_out, uint32_t ttl)
 {
     uint32_t now = ztimer_now(ZTIMER_MSEC) / MS_PER_SEC;
-    uint32_t hash = _hash(domain_name, strlen(domain_name));
-    uint32_t oldest = ttl;
-    int idx = -1;
-
-    assert(addr_len == 4 || addr_len == 16);
-    DEBUG("dns_cache: lifetime of %s is %"PRIu32" s\n", domain_name, ttl);
+    int32_t oldest = ttl;
+    int idx;
 
     mutex_lock(&cache_mutex);
-    /* iterate even if TTL = 0 just in case we need to expire */
-    for (unsigned i = 0; i < CONFIG_DNS_CACHE_SIZE; ++i) {
-        if (ttl && (now > cache[i].expires || _is_empty(i))) {
-            _add_entry(i, hash, addr_out, addr_len, now + ttl);
-            goto exit;
+    _sweep(now);
+
+    if (!(type & TYPE_NEGATIVE)) {
+        /* the name has an address after all */
+        if ((idx = _find(hash, TYPE_NEGATIVE | type)) >= 0) {
+            _remove(idx);
         }
-        if (cache[i].hash == hash && _get_len(i) == addr_len) {
-            DEBUG("dns_cache[%u] update ttl\n", i);
-            if (ttl) {
-                cache[i].expires = now + ttl;
-            }
-            else {
-                /* put one second into past so that it is immediately expired */
-                cache[i].expires = now - 1;
-            }
-            goto exit;
+        if ((idx = _find(hash, TYPE_NEGATIVE)) >= 0) {
+            _remove(idx);
         }
-        uint32_t _ttl = cache[i].expires - now;
-        if (_ttl < oldest) {
-            oldest = _ttl;
-            idx = i;
+    }
+    if ((idx = _find(hash, type)) >= 0) {
+        if (ttl) {
+            DEBUG("dns_cache[%d] update entry\n", idx);
+            _add_entry(idx, hash, type, addr_out, now + ttl);
+        }
+        else {
+            _remove(idx);
         }
+        goto exit;
+    }
+    if (!ttl) {
+        goto exit;
     }
 
-    if (ttl && idx >= 0) {
+    if (dns_cache_used_count() == CONFIG_DNS_CACHE_SIZE) {
+        /* do not evict an entry that would outlive the new one */
+        idx = -1;
+        for (unsigned i = 0; i < CONFIG_DNS_CACHE_SIZE; ++i) {
+            /* negative for entries kept to be served stale */
+            int32_t _ttl = cache[i].expires - now;
+            if (_ttl < oldest) {
+                oldest = _ttl;
+                idx = i;
+            }
+        }
+        if (idx < 0) {
+            goto exit;
+        }
         DEBUG("dns_cache: evict first entry to expire\n");
-        _add_entry(idx, hash, addr_out, addr_len, now + ttl);
+        _remove(idx);
+        cache_stats.evictions++;
+    }
+
+    idx = _home(hash);
+    while (!_is_empty(idx)) {
+        idx = _next(idx);
     }
+    _add_entry(idx, hash, type, addr_out, now + ttl);
 exit:
     mutex_unlock(&cache_mutex);
 }
+
+void dns_cache_add(const char *domain_name, const void *addr_out,
+                        int addr_len, uint32_t ttl)
+{
+    assert(addr_len == 4 || addr_len == 16);
+    DEBUG("dns_cache: lifetime of %s is %"PRIu32" s\n", domain_name, ttl);
+
+    if ((addr_len != _addr_len(AF_INET)) && (addr_len != _addr_len(AF_INET6))) {
+        return;
+    }
+
+    _add(_hash(domain_name, strlen(domain_name)), addr_len, addr_out, ttl);
+}
+
+void dns_cache_add_negative(const char *domain_name, int family, uint32_t ttl)
+{
+    uint8_t addr_len = _addr_len(family);
+
+    if (addr_len == 255) {
+        return;
+    }
+    DEBUG("dns_cache: %s has no address for %"PRIu32" s\n", domain_name, ttl);
+
+    _add(_hash(domain_name, strlen(domain_name)), TYPE_NEGATIVE | addr_len,
+         NULL, ttl);
+}
+
+unsigned dns_cache_used_count(void)
+{
+    unsigned count = 0;
+
+    for (unsigned i = 0; i < CONFIG_DNS_CACHE_SIZE; ++i) {
+        count += !_is_empty(i);
+    }
+    return count;
+}
+
+void dns_cache_stats_get(dns_cache_stats_t *stats)
+{
+    mutex_lock(&cache_mutex);
+    *stats = cache_stats;
+    mutex_unlock(&cache_mutex);
+}
@@ -29,6 +29,9 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/* two root names and five 32 bit fields */
+#define SOA_MIN_LENGTH      (2U + 5U * 4U)
+
 static ssize_t _enc_domain_name(uint8_t *out, const char *domain_name)
 {
     /*
@@ -103,6 +106,64 @@ static ssize_t _skip_hostname(const uint8_t *buf, size_t len,
     return res + 1;
 }
 
+/*
+ * A reply without the requested address is a negative answer if the name
+ * does not exist or has no such address. Its TTL is the lesser of the TTL
+ * and the MINIMUM field of the SOA record in the authority section, see
+ * RFC 2308, section 5. Without SOA record it must not be cached.
+ */
+static int _parse_negative(const uint8_t *buf, size_t len,
+                           const uint8_t *bufpos, uint32_t *ttl)
+{
+    const uint8_t *buflim = buf + len;
+    const dns_hdr_t *hdr = (dns_hdr_t *)buf;
+    uint16_t flags = ntohs(hdr->flags);
+    unsigned rcode = flags & 0xf;
+
+    if (ttl) {
+        *ttl = 0;
+    }
+    /* a truncated reply may just have lost the answer */
+    if ((flags & 0x0200) ||
+        ((rcode != DNS_RCODE_NO_ERROR) && (rcode != DNS_RCODE_NAME_ERROR))) {
+        return -EBADMSG;
+    }
+
+    for (unsigned n = 0; n < ntohs(hdr->nscount); n++) {
+        ssize_t tmp = _skip_hostname(buf, len, bufpos);
+        if (tmp < 0) {
+            break;
+        }
+        bufpos += tmp;
+        if ((bufpos + RR_TYPE_LENGTH + RR_CLASS_LENGTH +
+             RR_TTL_LENGTH + RR_RDLENGTH_LENGTH) > buflim) {
+            break;
+        }
+        uint16_t _type = ntohs(_get_short(bufpos));
+        bufpos += RR_TYPE_LENGTH + RR_CLASS_LENGTH;
+        uint32_t rr_ttl = byteorder_bebuftohl(bufpos);
+        bufpos += RR_TTL_LENGTH;
+        unsigned rdlen = ntohs(_get_short(bufpos));
+        bufpos += RR_RDLENGTH_LENGTH;
+        if ((bufpos + rdlen) > buflim) {
+            break;
+        }
+        /* MINIMUM is the last field of the SOA record */
+        if ((_type == DNS_TYPE_SOA) && (rdlen >= SOA_MIN_LENGTH)) {
+            uint32_t minimum = byteorder_bebuftohl(bufpos + rdlen - RR_TTL_LENGTH);
+
+            DEBUG("dns_msg: negative answer, TTL %lu, MINIMUM %lu\n",
+                  (unsigned long)rr_ttl, (unsigned long)minimum);
+            if (ttl) {
+                *ttl = (rr_ttl < minimum) ? rr_ttl : minimum;
+            }
+            break;
+        }
+        bufpos += rdlen;
+    }
+    return -ENXIO;
+}
+
 size_t dns_msg_compose_query(void *dns_buf, const char *domain_name,
                              uint16_t id, int family)
 {
@@ -209,7 +270,7 @@ int dns_msg_parse_reply(const uint8_t *buf, size_t len, int family,
         return rdlen;
     }
 
-    return -EBADMSG;
+    return _parse_negative(buf, len, bufpos, ttl);
 }
 
 /** @} */
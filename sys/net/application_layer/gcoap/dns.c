@@ -125,7 +125,7 @@ int gcoap_dns_query(const char *domain_name, void *addr_out, int family)
 {
     int res;
 
-    if ((res = dns_cache_query(domain_name, addr_out, family)) > 0) {
+    if ((res = dns_cache_query(domain_name, addr_out, family)) != 0) {
         return res;
     }
 
@@ -149,6 +149,13 @@ int gcoap_dns_query(const char *domain_name, void *addr_out, int family)
         res = req_ctx.res;
     }
     mutex_unlock(&_client_mutex);
+    if (res == -ETIMEDOUT) {
+        /* an expired address is better than none */
+        int stale = dns_cache_query_stale(domain_name, addr_out, family);
+        if (stale > 0) {
+            res = stale;
+        }
+    }
     return res;
 }
 
@@ -742,6 +749,15 @@ static void _resp_handler(const gcoap_request_memo_t *memo, coap_pkt_t *pdu,
                 ttl += max_age;
                 dns_cache_add(_domain_name_from_ctx(context), context->addr_out, context->res, ttl);
             }
+            else if (IS_USED(MODULE_DNS_CACHE) && (context->res == -ENXIO) && ttl) {
+                uint32_t max_age;
+
+                if (coap_opt_get_uint(pdu, COAP_OPT_MAX_AGE, &max_age) < 0) {
+                    max_age = 60;
+                }
+                ttl += max_age;
+                dns_cache_add_negative(_domain_name_from_ctx(context), family, ttl);
+            }
             else if (ENABLE_DEBUG && (context->res < 0)) {
                 DEBUG("gcoap_dns: Unable to parse DNS reply: %d\n",
                       context->res);
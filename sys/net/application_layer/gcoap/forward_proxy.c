@@ -19,8 +19,10 @@
 
 #include "event.h"
 #include "kernel_defines.h"
+#include "mutex.h"
 #include "net/gcoap.h"
 #include "net/gcoap/forward_proxy.h"
+#include "net/sock/util.h"
 #include "uri_parser.h"
 #include "net/nanocoap/cache.h"
 #include "ztimer.h"
@@ -41,8 +43,14 @@ extern kernel_pid_t forward_proxy_pid;
 extern uint16_t gcoap_next_msg_id(void);
 extern void gcoap_forward_proxy_post_event(void *arg);
 
-static uint8_t proxy_req_buf[CONFIG_GCOAP_PDU_BUF_SIZE];
-static client_ep_t _client_eps[CONFIG_GCOAP_REQ_WAITING_MAX];
+/* the proxy thread changes the forward requests in gcoap_req_send() while
+ * the gcoap thread would compare them */
+#define COALESCE_REQUESTS   (IS_USED(MODULE_GCOAP_FORWARD_PROXY_WORKERS) || \
+                             !IS_USED(MODULE_GCOAP_FORWARD_PROXY_THREAD))
+
+/* keeps workers from storing a response while it is compared as request */
+static mutex_t _coalesce_lock;
+static client_ep_t _client_eps[CONFIG_GCOAP_FORWARD_PROXY_CLIENTS_MAX];
 
 static int _request_matcher_forward_proxy(gcoap_listener_t *listener,
                                           const coap_resource_t **resource,
@@ -93,18 +101,23 @@ void gcoap_forward_proxy_init(void)
     if (IS_ACTIVE(MODULE_GCOAP_FORWARD_PROXY_THREAD)) {
         gcoap_forward_proxy_thread_init();
     }
+    if (IS_ACTIVE(MODULE_GCOAP_FORWARD_PROXY_WORKERS)) {
+        gcoap_forward_proxy_workers_init();
+    }
 }
 
 static client_ep_t *_allocate_client_ep(const sock_udp_ep_t *ep)
 {
     client_ep_t *cep;
     for (cep = _client_eps;
-         cep < (_client_eps + CONFIG_GCOAP_REQ_WAITING_MAX);
+         cep < (_client_eps + CONFIG_GCOAP_FORWARD_PROXY_CLIENTS_MAX);
          cep++) {
         if (!_cep_in_use(cep)) {
             _cep_set_in_use(cep);
             _cep_set_req_etag(cep, NULL, 0);
             memcpy(&cep->ep, ep, sizeof(*ep));
+            cep->coalesced = NULL;
+            cep->coalescable = false;
             DEBUG("Client_ep is allocated %p\n", (void *)cep);
             return cep;
         }
@@ -157,6 +170,10 @@ static ssize_t _forward_proxy_handler(coap_pkt_t *pdu, uint8_t *buf,
     else if (pdu_len == -EPERM) {
         return gcoap_response(pdu, buf, len, COAP_CODE_PROXYING_NOT_SUPPORTED);
     }
+    /* all workers busy */
+    else if (pdu_len == -EAGAIN) {
+        return gcoap_response(pdu, buf, len, COAP_CODE_SERVICE_UNAVAILABLE);
+    }
 
     return pdu_len;
 }
@@ -264,21 +281,26 @@ static void _set_response_type(coap_pkt_t *pdu, uint8_t resp_type)
     }
 }
 
-static void _forward_resp_handler(const gcoap_request_memo_t *memo,
-                                  coap_pkt_t* pdu,
-                                  const sock_udp_ep_t *remote)
+/**
+ * @brief   Send the response to the forward request of @p cep to the client
+ *          and free @p cep
+ *
+ * @param[in] cep       client endpoint
+ * @param[in] pdu       response of the server, or the forward request if
+ *                      there is none
+ * @param[in] buf_len   size of the buffer of @p pdu
+ * @param[in] state     outcome of the forward request, a `GCOAP_MEMO_*` state
+ */
+static void _forward_resp(client_ep_t *cep, coap_pkt_t *pdu, size_t buf_len,
+                          unsigned state)
 {
-    (void) remote; /* this is the origin server */
-    client_ep_t *cep = (client_ep_t *)memo->context;
-    size_t buf_len;
-
     /* No harm done in removing a timer that's not active */
     ztimer_remove(ZTIMER_MSEC, &cep->empty_ack_timer);
-    buf_len = coap_get_total_len(pdu);
-    assert(memo->state == GCOAP_MEMO_RESP ||
-           memo->state == GCOAP_MEMO_RESP_TRUNC ||
-           memo->state == GCOAP_MEMO_TIMEOUT);
-    if (memo->state == GCOAP_MEMO_RESP) {
+    assert(state == GCOAP_MEMO_RESP ||
+           state == GCOAP_MEMO_RESP_TRUNC ||
+           state == GCOAP_MEMO_TIMEOUT ||
+           state == GCOAP_MEMO_ERR);
+    if (state == GCOAP_MEMO_RESP) {
         uint8_t req_etag_len = _cep_get_req_etag_len(cep);
 
         if (req_etag_len > 0) {
@@ -311,7 +333,7 @@ static void _forward_resp_handler(const gcoap_request_memo_t *memo,
          * converted by the client-side to the cached response */
         /* else forward the response packet as-is to the client */
     }
-    else if (memo->state == GCOAP_MEMO_RESP_TRUNC) {
+    else if (state == GCOAP_MEMO_RESP_TRUNC) {
         /* the response was truncated, so there should be enough space
          * to allocate an empty error message instead (with a potential Observe option) if not,
          * _listen_buf is _way_ too short ;-) */
@@ -320,16 +342,154 @@ static void _forward_resp_handler(const gcoap_request_memo_t *memo,
         coap_opt_finish(pdu, COAP_OPT_FINISH_NONE);
         _set_response_type(pdu, _cep_get_response_type(cep));
     }
-    else if (memo->state == GCOAP_MEMO_TIMEOUT) {
+    else if (state == GCOAP_MEMO_TIMEOUT) {
         /* send RST */
         gcoap_resp_init(pdu, (uint8_t *)pdu->hdr, buf_len, COAP_CODE_EMPTY);
         coap_opt_finish(pdu, COAP_OPT_FINISH_NONE);
     }
+    else {
+        /* the server could not be reached or reset the request */
+        gcoap_resp_init(pdu, (uint8_t *)pdu->hdr, buf_len, COAP_CODE_BAD_GATEWAY);
+        coap_opt_finish(pdu, COAP_OPT_FINISH_NONE);
+        _set_response_type(pdu, _cep_get_response_type(cep));
+    }
     /* don't use buf_len here, in case the above `gcoap_resp_init`s changed `pdu` */
     _dispatch_msg(pdu->hdr, coap_get_total_len(pdu), &cep->ep, &cep->proxy_ep);
     _free_client_ep(cep);
 }
 
+/**
+ * @brief   Copy the response @p resp of the server to the buffer of @p cep
+ *          with the token and message ID of the request of @p cep
+ *
+ * @return  0 on success
+ * @return  -ENOBUFS if the response does not fit
+ */
+static int _cep_copy_resp(client_ep_t *cep, const coap_pkt_t *resp)
+{
+    uint8_t token[COAP_TOKEN_LENGTH_MAX];
+    unsigned token_len = coap_get_token_len(&cep->pdu);
+    size_t hdr_len = coap_get_total_hdr_len(&cep->pdu);
+    size_t resp_hdr_len = coap_get_total_hdr_len(resp);
+    size_t len = coap_get_total_len(resp) - resp_hdr_len;
+
+    if ((hdr_len + len > sizeof(cep->buf)) || (token_len > sizeof(token))) {
+        return -ENOBUFS;
+    }
+    memcpy(token, coap_get_token(&cep->pdu), token_len);
+    coap_build_hdr((coap_hdr_t *)cep->buf, coap_get_type(resp), token, token_len,
+                   coap_get_code_raw(resp), ntohs(cep->mid));
+    memcpy(&cep->buf[hdr_len], (uint8_t *)resp->hdr + resp_hdr_len, len);
+    return coap_parse(&cep->pdu, cep->buf, hdr_len + len);
+}
+
+static ssize_t _opt_get_next_but_etag(const coap_pkt_t *pkt, coap_optpos_t *opt,
+                                      uint8_t **value, bool init_opt)
+{
+    ssize_t len;
+
+    do {
+        len = coap_opt_get_next(pkt, opt, value, init_opt);
+        init_opt = false;
+    } while ((len >= 0) && (opt->opt_num == COAP_OPT_ETAG));
+    return len;
+}
+
+static bool _cep_same_request(const client_ep_t *a, const client_ep_t *b)
+{
+    coap_optpos_t a_opt, b_opt;
+    uint8_t *a_value, *b_value;
+
+    if ((coap_get_code_raw(&a->pdu) != coap_get_code_raw(&b->pdu)) ||
+        (a->pdu.payload_len != b->pdu.payload_len) ||
+        !sock_udp_ep_equal(&a->server_ep, &b->server_ep)) {
+        return false;
+    }
+    /* the token and the message ID differ anyway, the ETag is the one of a
+     * stale cache entry, if any, and filled in when the request is sent */
+    for (bool init = true; ; init = false) {
+        ssize_t a_len = _opt_get_next_but_etag(&a->pdu, &a_opt, &a_value, init);
+        ssize_t b_len = _opt_get_next_but_etag(&b->pdu, &b_opt, &b_value, init);
+
+        if (a_len != b_len) {
+            return false;
+        }
+        if (a_len < 0) {
+            break;
+        }
+        if ((a_opt.opt_num != b_opt.opt_num) || memcmp(a_value, b_value, a_len)) {
+            return false;
+        }
+    }
+    return memcmp(a->pdu.payload, b->pdu.payload, a->pdu.payload_len) == 0;
+}
+
+/**
+ * @brief   Let @p cep wait for the response to an identical GET in flight
+ *
+ * @return  true if @p cep waits for the response to the request of another
+ *          client
+ */
+static bool _cep_coalesce(client_ep_t *cep)
+{
+    client_ep_t *first = NULL;
+
+    if (!COALESCE_REQUESTS || (coap_get_code_raw(&cep->pdu) != COAP_METHOD_GET)) {
+        return false;
+    }
+    mutex_lock(&_coalesce_lock);
+    for (client_ep_t *other = _client_eps;
+         other < (_client_eps + CONFIG_GCOAP_FORWARD_PROXY_CLIENTS_MAX);
+         other++) {
+        if ((other != cep) && _cep_in_use(other) && other->coalescable &&
+            _cep_same_request(other, cep)) {
+            first = other;
+            break;
+        }
+    }
+    if (first) {
+        cep->coalesced = first->coalesced;
+        first->coalesced = cep;
+    }
+    mutex_unlock(&_coalesce_lock);
+    if (first) {
+        DEBUG("gcoap_forward_proxy: waiting for the response to %p\n", (void *)first);
+    }
+    return first != NULL;
+}
+
+/**
+ * @brief   Send the response to the forward request of @p cep to all clients
+ *          waiting for it, see _forward_resp()
+ */
+static void _forward_resp_all(client_ep_t *cep, coap_pkt_t *pdu, size_t buf_len,
+                              unsigned state)
+{
+    /* only the gcoap thread looks for requests to coalesce */
+    cep->coalescable = false;
+    /* the others still have their requests, in place of the response */
+    while (cep->coalesced) {
+        client_ep_t *other = cep->coalesced;
+        unsigned other_state = state;
+
+        cep->coalesced = other->coalesced;
+        if ((state == GCOAP_MEMO_RESP) && (_cep_copy_resp(other, pdu) < 0)) {
+            other_state = GCOAP_MEMO_RESP_TRUNC;
+        }
+        _forward_resp(other, &other->pdu, sizeof(other->buf), other_state);
+    }
+    _forward_resp(cep, pdu, buf_len, state);
+}
+
+static void _forward_resp_handler(const gcoap_request_memo_t *memo,
+                                  coap_pkt_t* pdu,
+                                  const sock_udp_ep_t *remote)
+{
+    (void) remote; /* this is the origin server */
+    _forward_resp_all((client_ep_t *)memo->context, pdu, coap_get_total_len(pdu),
+                      memo->state);
+}
+
 static int _gcoap_forward_proxy_add_uri_path(coap_pkt_t *pkt,
                                              uri_parser_result_t *urip)
 {
@@ -369,7 +529,8 @@ static int _gcoap_forward_proxy_copy_options(coap_pkt_t *pkt,
             if (IS_USED(MODULE_NANOCOAP_CACHE) && !etag_added && (opt.opt_num >= COAP_OPT_ETAG)) {
                 static const uint8_t tmp[COAP_ETAG_LENGTH_MAX] = { 0 };
                 /* add slack to maybe add an ETag on stale cache hit later, as is done in
-                 * gcoap_req_send() (which we circumvented in _gcoap_forward_proxy_via_coap()) */
+                 * gcoap_req_send() (which we circumvented in _gcoap_forward_proxy_via_coap()),
+                 * or in _forward_from_cache() with the workers */
                 if (coap_opt_add_opaque(pkt, COAP_OPT_ETAG, tmp, sizeof(tmp))) {
                     etag_added = true;
                 }
@@ -426,12 +587,168 @@ int gcoap_forward_proxy_req_send(client_ep_t *cep)
     return len;
 }
 
+#if IS_USED(MODULE_GCOAP_FORWARD_PROXY_WORKERS)
+ssize_t gcoap_forward_proxy_resp_store(client_ep_t *cep, const coap_pkt_t *resp)
+{
+    size_t len = coap_get_total_len(resp);
+
+    if (len > sizeof(cep->buf)) {
+        return -ENOBUFS;
+    }
+    mutex_lock(&_coalesce_lock);
+    /* the request is gone, so nothing can be compared to it anymore */
+    cep->coalescable = false;
+    memcpy(cep->buf, resp->hdr, len);
+    mutex_unlock(&_coalesce_lock);
+    return len;
+}
+
+static void _worker_done(event_t *event)
+{
+    client_ep_t *cep = container_of(event, client_ep_t, done);
+    unsigned state = GCOAP_MEMO_ERR;
+
+    if (cep->res > 0) {
+        /* the worker parsed the response already, this can't fail */
+        coap_parse(&cep->pdu, cep->buf, cep->res);
+        state = GCOAP_MEMO_RESP;
+#if IS_USED(MODULE_NANOCOAP_CACHE)
+        nanocoap_cache_entry_t *ce = nanocoap_cache_process(cep->cache_key, cep->req_code,
+                                                            &cep->pdu, cep->res);
+
+        if (cep->pdu.hdr->code != COAP_CODE_VALID) {
+            if (ce) {
+                ce->truncated = false;
+            }
+        }
+        else if (ce) {
+            /* the stale entry was validated, respond with it */
+            if (_cep_copy_resp(cep, &ce->response_pkt) < 0) {
+                state = GCOAP_MEMO_ERR;
+            }
+            else if (ce->truncated) {
+                state = GCOAP_MEMO_RESP_TRUNC;
+            }
+        }
+#endif
+    }
+    else if (cep->res == -ENOBUFS) {
+        state = GCOAP_MEMO_RESP_TRUNC;
+    }
+    else if (cep->res == -ETIMEDOUT) {
+        state = GCOAP_MEMO_TIMEOUT;
+    }
+    /* the worker sent the request with a message ID of its own, and a
+     * separate response carries one of the server */
+    cep->pdu.hdr->id = cep->mid;
+    _forward_resp_all(cep, &cep->pdu, sizeof(cep->buf), state);
+}
+
+#if IS_USED(MODULE_NANOCOAP_CACHE)
+/**
+ * @brief   Fill the ETag slack of the forward request of @p cep with the ETag
+ *          of the stale cache entry @p ce, or remove it without one
+ */
+static void _cep_set_validation_etag(client_ep_t *cep, const nanocoap_cache_entry_t *ce)
+{
+    uint8_t *resp_etag, *slack;
+    ssize_t resp_etag_len = -ENOENT;
+    ssize_t slack_len = coap_opt_get_opaque(&cep->pdu, COAP_OPT_ETAG, &slack);
+
+    if (slack_len < 0) {
+        return;
+    }
+    if (ce) {
+        resp_etag_len = coap_opt_get_opaque((coap_pkt_t *)&ce->response_pkt, COAP_OPT_ETAG,
+                                            &resp_etag);
+    }
+    if ((resp_etag_len <= 0) || (resp_etag_len > slack_len)) {
+        coap_opt_remove(&cep->pdu, COAP_OPT_ETAG);
+        return;
+    }
+    memcpy(slack, resp_etag, resp_etag_len);
+    if (resp_etag_len < slack_len) {
+        size_t len = coap_get_total_len(&cep->pdu);
+        size_t rem_len = len - ((slack + slack_len) - cep->buf);
+
+        /* the slack is shorter than 13 bytes, so its length is encoded in
+         * the first byte of the option, see RFC 7252, section 3.1 */
+        *(slack - 1) = (*(slack - 1) & 0xf0) | (uint8_t)resp_etag_len;
+        memmove(slack + resp_etag_len, slack + slack_len, rem_len);
+        coap_parse(&cep->pdu, cep->buf, len - (slack_len - resp_etag_len));
+    }
+}
+#endif
+
+static bool _forward_from_cache(client_ep_t *cep)
+{
+#if IS_USED(MODULE_NANOCOAP_CACHE)
+    uint8_t cache_key[SHA256_DIGEST_LENGTH];
+    nanocoap_cache_entry_t *ce;
+
+    nanocoap_cache_key_generate(&cep->pdu, cache_key);
+    /* keep the key for the response of the server */
+    memcpy(cep->cache_key, cache_key, sizeof(cep->cache_key));
+    ce = nanocoap_cache_key_lookup(cache_key);
+    if (ce && (ce->request_method != cep->req_code)) {
+        ce = NULL;
+    }
+    if (!ce || nanocoap_cache_entry_is_stale(ce, ztimer_now(ZTIMER_SEC))) {
+        /* try to validate a stale entry, as gcoap_req_send() does */
+        _cep_set_validation_etag(cep, ce);
+        return false;
+    }
+    if (_cep_copy_resp(cep, &ce->response_pkt) < 0) {
+        /* the cached response would not fit after validation either */
+        _cep_set_validation_etag(cep, NULL);
+        return false;
+    }
+    _forward_resp(cep, &cep->pdu, sizeof(cep->buf),
+                  ce->truncated ? GCOAP_MEMO_RESP_TRUNC : GCOAP_MEMO_RESP);
+    return true;
+#else
+    (void)cep;
+    return false;
+#endif
+}
+
+static int _forward_via_worker(client_ep_t *cep)
+{
+    cep->req_code = coap_get_code_raw(&cep->pdu);
+    if (_forward_from_cache(cep) || _cep_coalesce(cep)) {
+        return 0;
+    }
+    /* the worker has not seen the request yet, no need to lock */
+    cep->coalescable = (cep->req_code == COAP_METHOD_GET);
+    cep->done.handler = _worker_done;
+    if (gcoap_forward_proxy_worker_dispatch(cep) < 0) {
+        DEBUG("gcoap_forward_proxy: all workers are busy\n");
+        _free_client_ep(cep);
+        return -EAGAIN;
+    }
+    return 0;
+}
+#endif /* IS_USED(MODULE_GCOAP_FORWARD_PROXY_WORKERS) */
+
+static bool _cep_req_pending(client_ep_t *cep)
+{
+    /* coalesced requests and those of the workers have no request memo */
+    for (client_ep_t *other = _client_eps;
+         other < (_client_eps + CONFIG_GCOAP_FORWARD_PROXY_CLIENTS_MAX);
+         other++) {
+        if ((other != cep) && _cep_in_use(other) && (other->mid == cep->mid) &&
+            sock_udp_ep_equal(&other->ep, &cep->ep)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 static int _gcoap_forward_proxy_via_coap(coap_pkt_t *client_pkt,
                                          client_ep_t *client_ep,
                                          uri_parser_result_t *urip)
 {
     ssize_t len;
-    gcoap_request_memo_t *memo = NULL;
 
     if (!_parse_endpoint(&client_ep->server_ep, urip)) {
         _free_client_ep(client_ep);
@@ -441,8 +758,7 @@ static int _gcoap_forward_proxy_via_coap(coap_pkt_t *client_pkt,
     /* do not forward requests if they already exist, e.g., due to CON
        and retransmissions. In the future, the proxy should set an
        empty ACK message to stop the retransmissions of a client */
-    gcoap_forward_proxy_find_req_memo(&memo, client_pkt, &client_ep->server_ep);
-    if (memo) {
+    if (_cep_req_pending(client_ep)) {
         DEBUG("gcoap_forward_proxy: request already exists, ignore!\n");
         _free_client_ep(client_ep);
         return 0;
@@ -455,7 +771,7 @@ static int _gcoap_forward_proxy_via_coap(coap_pkt_t *client_pkt,
 
     unsigned token_len = coap_get_token_len(client_pkt);
 
-    coap_pkt_init(&client_ep->pdu, proxy_req_buf, CONFIG_GCOAP_PDU_BUF_SIZE,
+    coap_pkt_init(&client_ep->pdu, client_ep->buf, sizeof(client_ep->buf),
                   sizeof(coap_hdr_t) + token_len);
 
     client_ep->pdu.hdr->ver_t_tkl = client_pkt->hdr->ver_t_tkl;
@@ -473,6 +789,12 @@ static int _gcoap_forward_proxy_via_coap(coap_pkt_t *client_pkt,
         _free_client_ep(client_ep);
         return -EINVAL;
     }
+#if IS_USED(MODULE_GCOAP_FORWARD_PROXY_WORKERS)
+    len = _forward_via_worker(client_ep);
+#else
+    if (_cep_coalesce(client_ep)) {
+        return 0;
+    }
     if (IS_USED(MODULE_GCOAP_FORWARD_PROXY_THREAD)) {
         /* WORKAROUND: DTLS communication is blocking the gcoap thread,
          * therefore the communication should be handled in the proxy thread */
@@ -482,9 +804,13 @@ static int _gcoap_forward_proxy_via_coap(coap_pkt_t *client_pkt,
                     };
         msg_send(&msg, forward_proxy_pid);
     }
-    else {
-        len = gcoap_forward_proxy_req_send(client_ep);
+    else if (((len = gcoap_forward_proxy_req_send(client_ep)) > 0) &&
+             (coap_get_code_raw(&client_ep->pdu) == COAP_METHOD_GET)) {
+        /* gcoap_req_send() may have filled in or removed the ETag */
+        coap_parse(&client_ep->pdu, client_ep->buf, len);
+        client_ep->coalescable = true;
     }
+#endif
 
     return len;
 }
@@ -496,10 +822,10 @@ int gcoap_forward_proxy_request_process(coap_pkt_t *pkt,
     ssize_t optlen = 0;
 
     client_ep_t *cep = _allocate_client_ep(client);
-    cep->proxy_ep = local ? *local : (sock_udp_ep_t){ 0 };
     if (!cep) {
         return -ENOMEM;
     }
+    cep->proxy_ep = local ? *local : (sock_udp_ep_t){ 0 };
 
     cep->mid = pkt->hdr->id;
     _cep_set_response_type(
@@ -529,7 +855,7 @@ int gcoap_forward_proxy_request_process(coap_pkt_t *pkt,
         /* client context ownership is passed to gcoap_forward_proxy_req_send() */
         int res = _gcoap_forward_proxy_via_coap(pkt, cep, &urip);
         if (res < 0) {
-            return -EINVAL;
+            return res;
         }
     }
     /* no other scheme supported for now */
@@ -0,0 +1,296 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Forward Proxy Workers
+ *
+ * The workers exchange the forward requests with the servers, each over its
+ * own socket and with several exchanges in flight. Everything else is left
+ * to the gcoap thread.
+ *
+ * @}
+ */
+
+#include "container.h"
+#include "event/timeout.h"
+#include "mbox.h"
+#include "net/gcoap/forward_proxy.h"
+#include "net/sock/async/event.h"
+#include "net/sock/util.h"
+#include "random.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#include "forward_proxy_internal.h"
+
+#define ENABLE_DEBUG    0
+#include "debug.h"
+
+struct worker;
+
+typedef struct {
+    struct worker *worker;          /**< worker of the exchange */
+    client_ep_t *cep;               /**< client of the exchange, NULL if free */
+    event_timeout_t timeout;        /**< retransmission or response timeout */
+    event_t event;                  /**< handles @p timeout */
+    uint32_t timeout_ms;            /**< current retransmission timeout */
+    uint16_t id;                    /**< message ID of the forward request */
+    uint8_t tries_left;             /**< retransmissions left */
+} _exchange_t;
+
+typedef struct worker {
+    event_queue_t queue;            /**< events of the worker */
+    event_t fetch;                  /**< requests are waiting in the queue */
+    sock_udp_t sock;                /**< socket to the servers */
+    _exchange_t exchanges[CONFIG_GCOAP_FORWARD_PROXY_WORKER_EXCHANGES];
+} _worker_t;
+
+extern uint16_t gcoap_next_msg_id(void);
+extern void gcoap_forward_proxy_post_event(void *arg);
+
+static char _stacks[CONFIG_GCOAP_FORWARD_PROXY_WORKERS][GCOAP_PROXY_WORKER_STACK_SIZE];
+static _worker_t _workers[CONFIG_GCOAP_FORWARD_PROXY_WORKERS];
+static msg_t _queue_buf[CONFIG_GCOAP_FORWARD_PROXY_QUEUE_SIZE];
+static mbox_t _queue = MBOX_INIT(_queue_buf, ARRAY_SIZE(_queue_buf));
+
+static void _complete(_exchange_t *ex, int res)
+{
+    client_ep_t *cep = ex->cep;
+
+    DEBUG("gcoap_forward_proxy_worker: request %p done: %d\n", (void *)cep, res);
+    event_timeout_clear(&ex->timeout);
+    event_cancel(&ex->worker->queue, &ex->event);
+    ex->cep = NULL;
+    cep->res = res;
+    gcoap_forward_proxy_post_event(&cep->done);
+}
+
+static void _send(_exchange_t *ex)
+{
+    client_ep_t *cep = ex->cep;
+    ssize_t res = sock_udp_send(&ex->worker->sock, cep->pdu.hdr,
+                                coap_get_total_len(&cep->pdu), &cep->server_ep);
+
+    if (res < 0) {
+        DEBUG("gcoap_forward_proxy_worker: can't send: %d\n", (int)res);
+        _complete(ex, res);
+        return;
+    }
+    event_timeout_set(&ex->timeout, ex->timeout_ms);
+}
+
+static void _start(_exchange_t *ex, client_ep_t *cep)
+{
+    bool confirmable = coap_get_type(&cep->pdu) == COAP_TYPE_CON;
+
+    ex->cep = cep;
+    /* the clients pick their message IDs independently of each other, but
+     * the server must not take their requests for duplicates */
+    ex->id = gcoap_next_msg_id();
+    cep->pdu.hdr->id = htons(ex->id);
+    ex->timeout_ms = CONFIG_COAP_ACK_TIMEOUT_MS;
+#if CONFIG_COAP_RANDOM_FACTOR_1000 > 1000
+    ex->timeout_ms = random_uint32_range(ex->timeout_ms,
+                                         (ex->timeout_ms * CONFIG_COAP_RANDOM_FACTOR_1000) / 1000);
+#endif
+    /* retry only when confirmable */
+    ex->tries_left = confirmable ? CONFIG_COAP_MAX_RETRANSMIT : 0;
+    _send(ex);
+}
+
+static void _fetch(_worker_t *worker)
+{
+    msg_t msg;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(worker->exchanges); i++) {
+        _exchange_t *ex = &worker->exchanges[i];
+
+        /* the exchange is free again if sending fails */
+        while (!ex->cep && mbox_try_get(&_queue, &msg)) {
+            _start(ex, msg.content.ptr);
+        }
+    }
+}
+
+static void _fetch_handler(event_t *event)
+{
+    _fetch(container_of(event, _worker_t, fetch));
+}
+
+static void _timeout_handler(event_t *event)
+{
+    _exchange_t *ex = container_of(event, _exchange_t, event);
+
+    if (!ex->cep) {
+        return;
+    }
+    if (ex->tries_left == 0) {
+        _complete(ex, -ETIMEDOUT);
+    }
+    else {
+        DEBUG("gcoap_forward_proxy_worker: retransmit %p\n", (void *)ex->cep);
+        ex->tries_left--;
+        ex->timeout_ms *= 2;
+        _send(ex);
+    }
+    _fetch(ex->worker);
+}
+
+static bool _matches(const _exchange_t *ex, const coap_pkt_t *pkt,
+                     const sock_udp_ep_t *remote)
+{
+    const coap_pkt_t *req = &ex->cep->pdu;
+    unsigned type = coap_get_type(pkt);
+
+    if (!sock_udp_ep_equal(remote, &ex->cep->server_ep)) {
+        return false;
+    }
+    /* message ID only has to match for RST and ACK */
+    if (((type == COAP_TYPE_RST) || (type == COAP_TYPE_ACK)) &&
+        (coap_get_id(pkt) != ex->id)) {
+        return false;
+    }
+    /* only RST and ACK may be empty, the others need the token */
+    if (coap_get_code_raw(pkt) == COAP_CODE_EMPTY) {
+        return (type == COAP_TYPE_RST) || (type == COAP_TYPE_ACK);
+    }
+    return (coap_get_token_len(pkt) == coap_get_token_len(req)) &&
+           (memcmp(coap_get_token(pkt), coap_get_token(req),
+                   coap_get_token_len(req)) == 0);
+}
+
+static void _send_ack(_worker_t *worker, const coap_pkt_t *pkt,
+                      const sock_udp_ep_t *remote)
+{
+    coap_hdr_t ack;
+
+    coap_build_hdr(&ack, COAP_TYPE_ACK, NULL, 0, COAP_CODE_EMPTY, coap_get_id(pkt));
+    sock_udp_send(&worker->sock, &ack, sizeof(ack), remote);
+}
+
+static void _handle_msg(_worker_t *worker, void *data, size_t len,
+                        const sock_udp_ep_t *remote)
+{
+    _exchange_t *ex = NULL;
+    coap_pkt_t pkt;
+
+    if (coap_parse(&pkt, data, len) < 0) {
+        DEBUG("gcoap_forward_proxy_worker: error parsing packet\n");
+        return;
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(worker->exchanges); i++) {
+        if (worker->exchanges[i].cep &&
+            _matches(&worker->exchanges[i], &pkt, remote)) {
+            ex = &worker->exchanges[i];
+            break;
+        }
+    }
+    if (!ex) {
+        DEBUG("gcoap_forward_proxy_worker: unexpected message %u\n", coap_get_id(&pkt));
+        return;
+    }
+    switch (coap_get_type(&pkt)) {
+    case COAP_TYPE_ACK:
+        if (coap_get_code_raw(&pkt) == COAP_CODE_EMPTY) {
+            /* empty ACK, wait for separate response */
+            ex->tries_left = 0;
+            event_timeout_clear(&ex->timeout);
+            event_cancel(&worker->queue, &ex->event);
+            event_timeout_set(&ex->timeout, CONFIG_COAP_SEPARATE_RESPONSE_TIMEOUT_MS);
+            return;
+        }
+        break;
+    case COAP_TYPE_RST:
+        _complete(ex, -EBADMSG);
+        return;
+    case COAP_TYPE_CON:
+        _send_ack(worker, &pkt, remote);
+        break;
+    default:
+        break;
+    }
+    _complete(ex, gcoap_forward_proxy_resp_store(ex->cep, &pkt));
+}
+
+static void _sock_cb(sock_udp_t *sock, sock_async_flags_t flags, void *arg)
+{
+    _worker_t *worker = arg;
+    sock_udp_ep_t remote;
+    void *data, *ctx = NULL;
+    ssize_t res;
+
+    if (!(flags & SOCK_ASYNC_MSG_RECV)) {
+        return;
+    }
+    /* a second call with the same context releases the message */
+    while ((res = sock_udp_recv_buf(sock, &data, &ctx, 0, &remote)) >= 0) {
+        if (res > 0) {
+            _handle_msg(worker, data, res, &remote);
+        }
+    }
+    _fetch(worker);
+}
+
+static void *_worker_start(void *arg)
+{
+    _worker_t *worker = arg;
+
+    event_queue_claim(&worker->queue);
+    event_loop(&worker->queue);
+    return NULL;
+}
+
+int gcoap_forward_proxy_worker_dispatch(client_ep_t *cep)
+{
+    msg_t msg = { .content.ptr = cep };
+
+    if (!mbox_try_put(&_queue, &msg)) {
+        return -EAGAIN;
+    }
+    /* the first worker with a free exchange takes the request */
+    for (unsigned i = 0; i < CONFIG_GCOAP_FORWARD_PROXY_WORKERS; i++) {
+        event_post(&_workers[i].queue, &_workers[i].fetch);
+    }
+    return 0;
+}
+
+void gcoap_forward_proxy_workers_init(void)
+{
+    for (unsigned i = 0; i < CONFIG_GCOAP_FORWARD_PROXY_WORKERS; i++) {
+        _worker_t *worker = &_workers[i];
+        /* the proxy supports IPv6 servers only, see _parse_endpoint() */
+        sock_udp_ep_t local = { .family = AF_INET6 };
+
+        event_queue_init_detached(&worker->queue);
+        worker->fetch.handler = _fetch_handler;
+        for (unsigned j = 0; j < ARRAY_SIZE(worker->exchanges); j++) {
+            _exchange_t *ex = &worker->exchanges[j];
+
+            ex->worker = worker;
+            ex->event.handler = _timeout_handler;
+            event_timeout_ztimer_init(&ex->timeout, ZTIMER_MSEC, &worker->queue, &ex->event);
+        }
+        /* bind explicitly, the callback does not survive an implicit bind */
+        if (sock_udp_create(&worker->sock, &local, NULL, 0) < 0) {
+            DEBUG_PUTS("gcoap_forward_proxy_workers_init(): can't create sock\n");
+            continue;
+        }
+        sock_udp_event_init(&worker->sock, &worker->queue, _sock_cb, worker);
+
+        kernel_pid_t pid = thread_create(_stacks[i], sizeof(_stacks[i]),
+                                         THREAD_PRIORITY_MAIN - 1, 0,
+                                         _worker_start, worker,
+                                         "gcoap proxy worker");
+        if (pid <= KERNEL_PID_UNDEF) {
+            DEBUG_PUTS("gcoap_forward_proxy_workers_init(): thread_create failed\n");
+        }
+    }
+}
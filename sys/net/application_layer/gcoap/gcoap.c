@@ -32,9 +32,11 @@
 #include "net/ipv6/addr.h"
 #include "net/nanocoap.h"
 #include "net/nanocoap/cache.h"
+#include "net/nanocoap/resource_trie.h"
 #include "net/sock/async/event.h"
 #include "net/sock/udp.h"
 #include "net/sock/util.h"
+#include "memarray.h"
 #include "mutex.h"
 #include "random.h"
 #include "thread.h"
@@ -63,6 +65,8 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
 static int _tl_init_coap_socket(gcoap_socket_t *sock, gcoap_socket_type_t type);
 static ssize_t _tl_send(gcoap_socket_t *sock, const void *data, size_t len,
                         const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux);
+static ssize_t _tl_sendv(gcoap_socket_t *sock, const iolist_t *snips,
+                         const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux);
 static ssize_t _tl_authenticate(gcoap_socket_t *sock, const sock_udp_ep_t *remote,
                                 uint32_t timeout);
 static ssize_t _well_known_core_handler(coap_pkt_t* pdu, uint8_t *buf, size_t len,
@@ -71,6 +75,11 @@ static void _cease_retransmission(gcoap_request_memo_t *memo);
 static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
                           size_t len, sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux);
 static void _expire_request(gcoap_request_memo_t *memo);
+static gcoap_request_memo_t *_memo_alloc(void);
+static void _memo_free(gcoap_request_memo_t *memo);
+static void _memo_index(gcoap_request_memo_t *memo);
+static void _memo_release(gcoap_request_memo_t *memo);
+static gcoap_request_memo_t *_req_memo_next(gcoap_request_memo_t *memo);
 static gcoap_request_memo_t* _find_req_memo_by_mid(const sock_udp_ep_t *remote,
                                                    uint16_t mid);
 static gcoap_request_memo_t* _find_req_memo_by_token(const sock_udp_ep_t *remote,
@@ -88,6 +97,10 @@ static int _find_obs_memo(gcoap_observe_memo_t **memo,
                           coap_pkt_t *pdu);
 static void _find_obs_memo_resource(gcoap_observe_memo_t **memo,
                                    const coap_resource_t *resource);
+static gcoap_observe_memo_t *_obs_memo_next_by_resource(gcoap_observe_memo_t *memo,
+                                                        const coap_resource_t *resource);
+static void _obs_memo_index(gcoap_observe_memo_t *memo);
+static void _obs_memo_unindex(gcoap_observe_memo_t *memo);
 
 static void _check_and_expire_obs_memo_last_mid(sock_udp_ep_t *remote,
                                                 uint16_t last_notify_mid);
@@ -146,8 +159,25 @@ typedef struct {
                                         /* Buffers for PDU for request resends;
                                            if first byte of an entry is zero,
                                            the entry is available */
+#if IS_USED(MODULE_GCOAP_MEMO_INDEX)
+    memarray_t req_memo_pool;           /* Free request memos, starts with
+                                           open_reqs */
+    gcoap_request_memo_t *req_by_mid[CONFIG_GCOAP_MEMO_INDEX_BUCKETS];
+                                        /* Request memos in use by message ID */
+    gcoap_request_memo_t *req_by_token[CONFIG_GCOAP_MEMO_INDEX_BUCKETS];
+                                        /* Request memos in use by token */
+    gcoap_observe_memo_t *obs_by_resource[CONFIG_GCOAP_MEMO_INDEX_BUCKETS];
+                                        /* Observe registrations by resource */
+    gcoap_observe_memo_t *obs_by_token[CONFIG_GCOAP_MEMO_INDEX_BUCKETS];
+                                        /* Observe registrations by token */
+#endif
 } gcoap_state_t;
 
+#if IS_USED(MODULE_GCOAP_MEMO_INDEX)
+static_assert((CONFIG_GCOAP_MEMO_INDEX_BUCKETS & (CONFIG_GCOAP_MEMO_INDEX_BUCKETS - 1)) == 0,
+              "CONFIG_GCOAP_MEMO_INDEX_BUCKETS must be a power of two");
+#endif
+
 static gcoap_state_t _coap_state = {
     .listeners   = &_default_listener,
 };
@@ -280,14 +310,14 @@ static void _on_sock_dtls_evt(sock_dtls_t *sock, sock_async_flags_t type, void *
         sock_dtls_session_get_udp_ep(&socket.ctx_dtls_session, &ep);
 
         /* Remove all memos of the concerned session. TODO: oberservable memos! */
-        for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
-            if (_coap_state.open_reqs[i].state == GCOAP_MEMO_UNUSED) {
-                continue;
-            }
-            gcoap_request_memo_t *memo = &_coap_state.open_reqs[i];
+        gcoap_request_memo_t *next = _req_memo_next(NULL);
+        while (next) {
+            gcoap_request_memo_t *memo = next;
+            /* expiring frees the memo */
+            next = _req_memo_next(memo);
             if (sock_udp_ep_equal(&memo->remote_ep, &ep)) {
-                _expire_request(memo);
                 event_timeout_clear(&memo->resp_evt_tmout);
+                _expire_request(memo);
             }
         }
     }
@@ -484,7 +514,13 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
             }
 
             if (pdu_len > 0) {
-                ssize_t bytes = _tl_send(sock, _listen_buf, pdu_len, remote, aux);
+                /* the handler may have attached payload snips */
+                iolist_t resp = {
+                    .iol_next = pdu.snips,
+                    .iol_base = _listen_buf,
+                    .iol_len = pdu_len,
+                };
+                ssize_t bytes = _tl_sendv(sock, &resp, remote, aux);
                 if (bytes <= 0) {
                     DEBUG("gcoap: send response failed: %" PRIdSIZE "\n", bytes);
                 }
@@ -551,8 +587,9 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
                  * Non-2.xx notifications indicate that the associated observe entry
                  * was removed on the server side. Then also free the memo here. */
                 if (!observe_notification || (code_class != COAP_CLASS_SUCCESS)) {
-                    /* setting the state to unused frees (drops) the memo entry */
-                    memo->state = GCOAP_MEMO_UNUSED;
+                    mutex_lock(&_coap_state.lock);
+                    _memo_release(memo);
+                    mutex_unlock(&_coap_state.lock);
                 }
 
                 break;
@@ -694,6 +731,16 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
         case GCOAP_RESOURCE_FOUND:
             /* find observe registration for resource */
             _find_obs_memo_resource(&resource_memo, resource);
+            if (IS_USED(MODULE_GCOAP_OBS_FANOUT)) {
+                /* only the registration of this remote matters, other
+                 * endpoints may observe the resource as well */
+                while (resource_memo &&
+                       !((sock->type == resource_memo->socket.type) &&
+                         sock_udp_ep_equal(remote, resource_memo->observer))) {
+                    resource_memo = _obs_memo_next_by_resource(resource_memo,
+                                                               resource);
+                }
+            }
             break;
         case GCOAP_RESOURCE_ERROR:
         default:
@@ -757,6 +804,8 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
         }
         /* finish registration */
         if (memo != NULL) {
+            mutex_lock(&_coap_state.lock);
+            _obs_memo_unindex(memo);
             /* resource may be assigned here if it is not already registered */
             memo->resource = resource;
             memo->token_len = coap_get_token_len(pdu);
@@ -764,6 +813,8 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
             if (memo->token_len) {
                 memcpy(&memo->token[0], coap_get_token(pdu), memo->token_len);
             }
+            _obs_memo_index(memo);
+            mutex_unlock(&_coap_state.lock);
             DEBUG("gcoap: Registered observer for: %s\n", memo->resource->path);
         }
 
@@ -772,6 +823,9 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
         /* clear memo, and clear observer if no other memos */
         if (memo != NULL) {
             DEBUG("gcoap: Deregistering observer for: %s\n", memo->resource->path);
+            mutex_lock(&_coap_state.lock);
+            _obs_memo_unindex(memo);
+            mutex_unlock(&_coap_state.lock);
             memo->observer = NULL;
             gcoap_observe_memo_t *other_memo = NULL;
             _find_obs_memo(&other_memo, remote, NULL, NULL);
@@ -807,6 +861,7 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
 
     pdu_len = resource->handler(pdu, buf, len, &ctx);
     if (pdu_len < 0) {
+        pdu->snips = NULL;
         pdu_len = gcoap_response(pdu, buf, len,
                                  COAP_CODE_INTERNAL_SERVER_ERROR);
     }
@@ -852,6 +907,22 @@ static int _request_matcher_default(gcoap_listener_t *listener,
     coap_method_flags_t method_flag = coap_method2flag(
         coap_get_code_detail(pdu));
 
+    if (IS_USED(MODULE_NANOCOAP_RESOURCE_TRIE)) {
+        switch (coap_resource_trie_find(listener->resources,
+                                        listener->resources_len,
+                                        (char *)uri, method_flag, resource)) {
+        case 0:
+            return GCOAP_RESOURCE_FOUND;
+        case -ENOTSUP:
+            return GCOAP_RESOURCE_WRONG_METHOD;
+        case -ENOENT:
+            return GCOAP_RESOURCE_NO_PATH;
+        default:
+            /* listener is not indexed, fall back to linear search */
+            break;
+        }
+    }
+
     *resource = NULL;
     while ((*resource = _match_resource_path_iterator(listener, *resource, uri))) {
         /* potential match, check for method */
@@ -932,6 +1003,194 @@ static int _find_resource(gcoap_socket_type_t tl_type,
     return ret;
 }
 
+/*
+ * Request memo allocation and lookup
+ *
+ * With module gcoap_memo_index, request memos in use are chained into hash
+ * buckets by message ID and by token. Otherwise, the lookups search the
+ * open_reqs array. Functions that change the memos in use must be called
+ * with _coap_state.lock held.
+ */
+#if IS_USED(MODULE_GCOAP_MEMO_INDEX)
+static unsigned _mid_bucket(uint16_t mid)
+{
+    return mid & (CONFIG_GCOAP_MEMO_INDEX_BUCKETS - 1);
+}
+
+static unsigned _token_bucket(const uint8_t *token, size_t tkl)
+{
+    uint32_t hash = tkl;
+
+    for (unsigned i = 0; i < tkl; i++) {
+        hash = (hash * 31) + token[i];
+    }
+    return (hash ^ (hash >> 8)) & (CONFIG_GCOAP_MEMO_INDEX_BUCKETS - 1);
+}
+
+static unsigned _memo_token_bucket(const gcoap_request_memo_t *memo)
+{
+    const coap_hdr_t *hdr = gcoap_request_memo_get_hdr(memo);
+
+    return _token_bucket(coap_hdr_get_token(hdr), coap_hdr_get_token_len(hdr));
+}
+
+static unsigned _resource_bucket(const coap_resource_t *resource)
+{
+    return ((uintptr_t)resource / sizeof(*resource)) & (CONFIG_GCOAP_MEMO_INDEX_BUCKETS - 1);
+}
+
+static unsigned _obs_memo_token_bucket(const gcoap_observe_memo_t *memo)
+{
+    return _token_bucket(memo->token, memo->token_len);
+}
+#endif
+
+/*
+ * Takes a request memo from the free ones and marks it as waiting.
+ *
+ * return         The memo, or NULL if none is free
+ */
+static gcoap_request_memo_t *_memo_alloc(void)
+{
+#if IS_USED(MODULE_GCOAP_MEMO_INDEX)
+    gcoap_request_memo_t *memo = memarray_alloc(&_coap_state.req_memo_pool);
+
+    if (memo) {
+        memo->state = GCOAP_MEMO_WAIT;
+    }
+    return memo;
+#else
+    for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
+        if (_coap_state.open_reqs[i].state == GCOAP_MEMO_UNUSED) {
+            _coap_state.open_reqs[i].state = GCOAP_MEMO_WAIT;
+            return &_coap_state.open_reqs[i];
+        }
+    }
+    return NULL;
+#endif
+}
+
+/*
+ * Frees a request memo that was not indexed with _memo_index() yet.
+ */
+static void _memo_free(gcoap_request_memo_t *memo)
+{
+    memo->state = GCOAP_MEMO_UNUSED;
+#if IS_USED(MODULE_GCOAP_MEMO_INDEX)
+    memarray_free(&_coap_state.req_memo_pool, memo);
+#endif
+}
+
+/*
+ * Makes a request memo findable by message ID and token. The request header
+ * must be stored in the memo.
+ */
+static void _memo_index(gcoap_request_memo_t *memo)
+{
+#if IS_USED(MODULE_GCOAP_MEMO_INDEX)
+    gcoap_request_memo_t **head;
+
+    head = &_coap_state.req_by_mid[_mid_bucket(gcoap_request_memo_get_hdr(memo)->id)];
+    memo->mid_next = *head;
+    *head = memo;
+    head = &_coap_state.req_by_token[_memo_token_bucket(memo)];
+    memo->token_next = *head;
+    *head = memo;
+#else
+    (void)memo;
+#endif
+}
+
+/*
+ * Frees a request memo that was indexed with _memo_index().
+ */
+static void _memo_release(gcoap_request_memo_t *memo)
+{
+#if IS_USED(MODULE_GCOAP_MEMO_INDEX)
+    gcoap_request_memo_t **link;
+
+    link = &_coap_state.req_by_mid[_mid_bucket(gcoap_request_memo_get_hdr(memo)->id)];
+    while (*link != memo) {
+        assert(*link);
+        link = &(*link)->mid_next;
+    }
+    *link = memo->mid_next;
+    link = &_coap_state.req_by_token[_memo_token_bucket(memo)];
+    while (*link != memo) {
+        assert(*link);
+        link = &(*link)->token_next;
+    }
+    *link = memo->token_next;
+#endif
+    _memo_free(memo);
+}
+
+/*
+ * Iterates over all request memos in use.
+ *
+ * memo[in]       Current memo, or NULL to get the first one
+ *
+ * return         Next memo in use, or NULL if there are no more
+ */
+static gcoap_request_memo_t *_req_memo_next(gcoap_request_memo_t *memo)
+{
+#if IS_USED(MODULE_GCOAP_MEMO_INDEX)
+    unsigned bucket = 0;
+
+    if (memo) {
+        if (memo->token_next) {
+            return memo->token_next;
+        }
+        bucket = _memo_token_bucket(memo) + 1;
+    }
+    for (; bucket < CONFIG_GCOAP_MEMO_INDEX_BUCKETS; bucket++) {
+        if (_coap_state.req_by_token[bucket]) {
+            return _coap_state.req_by_token[bucket];
+        }
+    }
+#else
+    unsigned i = memo ? (unsigned)(memo - _coap_state.open_reqs) + 1 : 0;
+
+    for (; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
+        if (_coap_state.open_reqs[i].state != GCOAP_MEMO_UNUSED) {
+            return &_coap_state.open_reqs[i];
+        }
+    }
+#endif
+    return NULL;
+}
+
+/*
+ * Iterates over the request memos in use that may have a token.
+ */
+static gcoap_request_memo_t *_req_memo_next_by_token(gcoap_request_memo_t *memo,
+                                                     const uint8_t *token,
+                                                     size_t tkl)
+{
+#if IS_USED(MODULE_GCOAP_MEMO_INDEX)
+    return memo ? memo->token_next
+                : _coap_state.req_by_token[_token_bucket(token, tkl)];
+#else
+    (void)token;
+    (void)tkl;
+    return _req_memo_next(memo);
+#endif
+}
+
+/*
+ * Iterates over the request memos in use that may have a message ID.
+ */
+static gcoap_request_memo_t *_req_memo_next_by_mid(gcoap_request_memo_t *memo,
+                                                   uint16_t mid)
+{
+#if IS_USED(MODULE_GCOAP_MEMO_INDEX)
+    return memo ? memo->mid_next : _coap_state.req_by_mid[_mid_bucket(mid)];
+#else
+    (void)mid;
+    return _req_memo_next(memo);
+#endif
+}
+
 /*
  * Finds the memo for an outstanding request within the _coap_state.open_reqs
  * array. Matches on remote endpoint and token.
@@ -945,12 +1204,8 @@ static int _find_resource(gcoap_socket_type_t tl_type,
 static gcoap_request_memo_t* _find_req_memo_by_token(const sock_udp_ep_t *remote,
                                                      const uint8_t *token, size_t tkl)
 {
-    for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
-        if (_coap_state.open_reqs[i].state == GCOAP_MEMO_UNUSED) {
-            continue;
-        }
-
-        gcoap_request_memo_t *memo = &_coap_state.open_reqs[i];
+    for (gcoap_request_memo_t *memo = _req_memo_next_by_token(NULL, token, tkl);
+         memo != NULL; memo = _req_memo_next_by_token(memo, token, tkl)) {
         coap_hdr_t *hdr = gcoap_request_memo_get_hdr(memo);
 
         /* verbose debug to catch bugs with request/response matching */
@@ -1032,13 +1287,8 @@ static gcoap_request_memo_t* _find_req_memo_by_pdu_token(
  */
 static gcoap_request_memo_t* _find_req_memo_by_mid(const sock_udp_ep_t *remote, uint16_t mid)
 {
-    for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
-        if (_coap_state.open_reqs[i].state == GCOAP_MEMO_UNUSED) {
-            continue;
-        }
-
-        gcoap_request_memo_t *memo = &_coap_state.open_reqs[i];
-
+    for (gcoap_request_memo_t *memo = _req_memo_next_by_mid(NULL, mid);
+         memo != NULL; memo = _req_memo_next_by_mid(memo, mid)) {
         if ((mid == gcoap_request_memo_get_hdr(memo)->id) &&
             sock_udp_ep_equal(&memo->remote_ep, remote)) {
             return memo;
@@ -1063,7 +1313,9 @@ static void _expire_request(gcoap_request_memo_t *memo)
             memo->resp_handler(memo, &req, NULL);
         }
         _memo_clear_resend_buffer(memo);
-        memo->state = GCOAP_MEMO_UNUSED;
+        mutex_lock(&_coap_state.lock);
+        _memo_release(memo);
+        mutex_unlock(&_coap_state.lock);
     }
     else {
         /* Response already handled; timeout must have fired while response */
@@ -1155,6 +1407,27 @@ static int _find_obs_memo(gcoap_observe_memo_t **memo,
     if (local) {
         _find_notifier(&local_notifier, local);
     }
+#if IS_USED(MODULE_GCOAP_MEMO_INDEX)
+    if (pdu && !local && coap_get_token_len(pdu)) {
+        for (gcoap_observe_memo_t *m =
+                 _coap_state.obs_by_token[_token_bucket(coap_get_token(pdu),
+                                                        coap_get_token_len(pdu))];
+             m != NULL; m = m->token_next) {
+            if ((m->observer == remote_observer || !remote_observer) &&
+                (m->token_len == coap_get_token_len(pdu)) &&
+                (memcmp(m->token, coap_get_token(pdu), m->token_len) == 0)) {
+                *memo = m;
+                return empty_slot;
+            }
+        }
+        for (int i = CONFIG_GCOAP_OBS_REGISTRATIONS_MAX - 1; i >= 0; i--) {
+            if (_coap_state.observe_memos[i].observer == NULL) {
+                return i;
+            }
+        }
+        return empty_slot;
+    }
+#endif
     for (unsigned i = 0; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
         if (_coap_state.observe_memos[i].observer == NULL) {
             empty_slot = i;
@@ -1213,6 +1486,9 @@ static void _check_and_expire_obs_memo_last_mid(sock_udp_ep_t *remote,
         }
 
         if (stale_obs_memo) {
+            mutex_lock(&_coap_state.lock);
+            _obs_memo_unindex(stale_obs_memo);
+            mutex_unlock(&_coap_state.lock);
             stale_obs_memo->observer = NULL; /* clear memo */
              /* check if no other memo is referencing the same local endpoint ...  */
             gcoap_observe_memo_t *other_memo = NULL;
@@ -1244,14 +1520,91 @@ static void _check_and_expire_obs_memo_last_mid(sock_udp_ep_t *remote,
 static void _find_obs_memo_resource(gcoap_observe_memo_t **memo,
                                    const coap_resource_t *resource)
 {
-    *memo = NULL;
-    for (int i = 0; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
+    *memo = _obs_memo_next_by_resource(NULL, resource);
+}
+
+/*
+ * Iterates over the observe memos registered for a resource.
+ *
+ * Must be called with _coap_state.lock held.
+ *
+ * memo[in] -- Previous memo, or NULL to start the iteration
+ * resource[in] -- Resource to match
+ *
+ * return next memo of the resource, or NULL if there is none
+ */
+static gcoap_observe_memo_t *_obs_memo_next_by_resource(gcoap_observe_memo_t *memo,
+                                                        const coap_resource_t *resource)
+{
+#if IS_USED(MODULE_GCOAP_MEMO_INDEX)
+    memo = memo ? memo->resource_next
+                : _coap_state.obs_by_resource[_resource_bucket(resource)];
+    while (memo && (memo->resource != resource)) {
+        memo = memo->resource_next;
+    }
+    return memo;
+#else
+    unsigned i = memo ? (unsigned)(memo - _coap_state.observe_memos) + 1 : 0;
+
+    for (; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
         if (_coap_state.observe_memos[i].observer != NULL
                 && _coap_state.observe_memos[i].resource == resource) {
-            *memo = &_coap_state.observe_memos[i];
-            break;
+            return &_coap_state.observe_memos[i];
         }
     }
+    return NULL;
+#endif
+}
+
+/*
+ * Makes a registered observe memo findable by resource and token.
+ *
+ * Must be called with _coap_state.lock held.
+ */
+static void _obs_memo_index(gcoap_observe_memo_t *memo)
+{
+#if IS_USED(MODULE_GCOAP_MEMO_INDEX)
+    gcoap_observe_memo_t **head;
+
+    head = &_coap_state.obs_by_resource[_resource_bucket(memo->resource)];
+    memo->resource_next = *head;
+    *head = memo;
+    head = &_coap_state.obs_by_token[_obs_memo_token_bucket(memo)];
+    memo->token_next = *head;
+    *head = memo;
+#else
+    (void)memo;
+#endif
+}
+
+/*
+ * Removes an observe memo from the indexes before its resource or token
+ * change or it is cleared. Does nothing if the memo is not indexed.
+ *
+ * Must be called with _coap_state.lock held.
+ */
+static void _obs_memo_unindex(gcoap_observe_memo_t *memo)
+{
+#if IS_USED(MODULE_GCOAP_MEMO_INDEX)
+    gcoap_observe_memo_t **link;
+
+    link = &_coap_state.obs_by_resource[_resource_bucket(memo->resource)];
+    while (*link && (*link != memo)) {
+        link = &(*link)->resource_next;
+    }
+    if (*link) {
+        *link = memo->resource_next;
+    }
+    link = &_coap_state.obs_by_token[_obs_memo_token_bucket(memo)];
+    while (*link && (*link != memo)) {
+        link = &(*link)->token_next;
+    }
+    if (*link) {
+        *link = memo->token_next;
+    }
+#else
+    (void)memo;
+#endif
 }
 
 /*
@@ -1284,11 +1637,22 @@ static int _tl_init_coap_socket(gcoap_socket_t *sock, gcoap_socket_type_t type)
 
 static ssize_t _tl_send(gcoap_socket_t *sock, const void *data, size_t len,
                         const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+{
+    const iolist_t snip = {
+        .iol_base = (void *)data,
+        .iol_len = len,
+    };
+
+    return _tl_sendv(sock, &snip, remote, aux);
+}
+
+static ssize_t _tl_sendv(gcoap_socket_t *sock, const iolist_t *snips,
+                         const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
 {
     ssize_t res = -1;
     switch (sock->type) {
         case GCOAP_SOCKET_TYPE_UDP:
-            res = sock_udp_send_aux(sock->socket.udp, data, len, remote, aux);
+            res = sock_udp_sendv_aux(sock->socket.udp, snips, remote, aux);
             break;
 #if IS_USED(MODULE_GCOAP_DTLS)
         case GCOAP_SOCKET_TYPE_DTLS:
@@ -1303,8 +1667,8 @@ static ssize_t _tl_send(gcoap_socket_t *sock, const void *data, size_t len,
             }
 
             /* send application data */
-            res = sock_dtls_send(sock->socket.dtls, &sock->ctx_dtls_session, data, len,
-                                    SOCK_NO_TIMEOUT);
+            res = sock_dtls_sendv(sock->socket.dtls, &sock->ctx_dtls_session, snips,
+                                  SOCK_NO_TIMEOUT);
             switch (res) {
             case -EHOSTUNREACH:
             case -ENOTCONN:
@@ -1475,7 +1839,9 @@ static void _receive_from_cache_cb(void *ctx)
                 memo->state = (ce->truncated) ? GCOAP_MEMO_RESP_TRUNC : GCOAP_MEMO_RESP;
                 memo->resp_handler(memo, &pdu, &memo->remote_ep);
                 _memo_clear_resend_buffer(memo);
-                memo->state = GCOAP_MEMO_UNUSED;
+                mutex_lock(&_coap_state.lock);
+                _memo_release(memo);
+                mutex_unlock(&_coap_state.lock);
             }
         }
     }
@@ -1620,6 +1986,10 @@ kernel_pid_t gcoap_init(void)
     memset(&_coap_state.observers[0], 0, sizeof(_coap_state.observers));
     memset(&_coap_state.observe_memos[0], 0, sizeof(_coap_state.observe_memos));
     memset(&_coap_state.resend_bufs[0], 0, sizeof(_coap_state.resend_bufs));
+#if IS_USED(MODULE_GCOAP_MEMO_INDEX)
+    memarray_init(&_coap_state.req_memo_pool, _coap_state.open_reqs,
+                  sizeof(_coap_state.open_reqs[0]), CONFIG_GCOAP_REQ_WAITING_MAX);
+#endif
     /* randomize initial value */
     atomic_init(&_coap_state.next_message_id, (unsigned)random_uint32());
 
@@ -1666,6 +2036,12 @@ void gcoap_register_listener(gcoap_listener_t *listener)
     if (!listener->request_matcher) {
         listener->request_matcher = _request_matcher_default;
     }
+
+    if (IS_USED(MODULE_NANOCOAP_RESOURCE_TRIE) &&
+        (listener->request_matcher == _request_matcher_default)) {
+        /* on failure the resources are just searched linearly */
+        coap_resource_trie_add(listener->resources, listener->resources_len);
+    }
 }
 
 const coap_resource_t *gcoap_get_resource_by_path_iterator(const gcoap_listener_t **last_listener,
@@ -1738,7 +2114,7 @@ int gcoap_obs_req_forget(const sock_udp_ep_t *remote, const uint8_t *token,
     obs_req_memo = _find_req_memo_by_token(remote, token, tokenlen);
     if (obs_req_memo) {
         /* forget the existing observe memo. */
-        obs_req_memo->state = GCOAP_MEMO_UNUSED;
+        _memo_release(obs_req_memo);
         res = 0;
     }
 
@@ -1768,14 +2144,7 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
      * response or request is confirmable) */
     if ((resp_handler != NULL) || (msg_type == COAP_TYPE_CON)) {
         mutex_lock(&_coap_state.lock);
-        /* Find empty slot in list of open requests. */
-        for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
-            if (_coap_state.open_reqs[i].state == GCOAP_MEMO_UNUSED) {
-                memo = &_coap_state.open_reqs[i];
-                memo->state = GCOAP_MEMO_WAIT;
-                break;
-            }
-        }
+        memo = _memo_alloc();
         if (!memo) {
             mutex_unlock(&_coap_state.lock);
             DEBUG("gcoap: dropping request; no space for response tracking\n");
@@ -1792,7 +2161,7 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
 
             if (res < 0) {
                 DEBUG("gcoap: Error from cache check");
-                memo->state = GCOAP_MEMO_UNUSED;
+                _memo_free(memo);
                 mutex_unlock(&_coap_state.lock);
                 return res;
             }
@@ -1805,7 +2174,7 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
              * the provided buffer once is possible */
             if (len > CONFIG_GCOAP_PDU_BUF_SIZE) {
                 DEBUG("gcoap: Request too large for retransmit buffer");
-                memo->state = GCOAP_MEMO_UNUSED;
+                _memo_free(memo);
                 mutex_unlock(&_coap_state.lock);
                 return -EINVAL;
             }
@@ -1830,7 +2199,8 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
                 memo->state = GCOAP_MEMO_RETRANSMIT;
             }
             else {
-                memo->state = GCOAP_MEMO_UNUSED;
+                _memo_free(memo);
+                memo = NULL;
                 DEBUG("gcoap: no space for PDU in resend bufs\n");
             }
             break;
@@ -1841,12 +2211,16 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
             timeout = CONFIG_GCOAP_NON_TIMEOUT_MSEC;
             break;
         default:
-            memo->state = GCOAP_MEMO_UNUSED;
+            _memo_free(memo);
+            memo = NULL;
             DEBUG("gcoap: illegal msg type %u\n", msg_type);
             break;
         }
+        if (memo) {
+            _memo_index(memo);
+        }
         mutex_unlock(&_coap_state.lock);
-        if (memo->state == GCOAP_MEMO_UNUSED) {
+        if (memo == NULL) {
             return 0;
         }
         if (cache_hit) {
@@ -1902,8 +2276,10 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
             if (timeout > 0) {
                 event_timeout_clear(&memo->resp_evt_tmout);
             }
-            memo->state = GCOAP_MEMO_UNUSED;
-    }
+            mutex_lock(&_coap_state.lock);
+            _memo_release(memo);
+            mutex_unlock(&_coap_state.lock);
+        }
         DEBUG("gcoap: sock send failed: %" PRIdSIZE "\n", res);
     }
     return ((res > 0 || res == -ENOTCONN) ? res : 0);
@@ -1975,6 +2351,10 @@ int gcoap_obs_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
 size_t gcoap_obs_send(const uint8_t *buf, size_t len,
                       const coap_resource_t *resource)
 {
+    if (IS_USED(MODULE_GCOAP_OBS_FANOUT)) {
+        return (gcoap_obs_send_all(buf, len, resource) > 0) ? len : 0;
+    }
+
     ssize_t ret = 0;
     gcoap_observe_memo_t *memo = NULL;
     _find_obs_memo_resource(&memo, resource);
@@ -1991,17 +2371,82 @@ size_t gcoap_obs_send(const uint8_t *buf, size_t len,
     return ret <= 0 ? 0 : (size_t)ret;
 }
 
-uint8_t gcoap_op_state(void)
+int gcoap_obs_send_all(const uint8_t *buf, size_t len,
+                       const coap_resource_t *resource)
 {
-    uint8_t count = 0;
-    for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
-        if (_coap_state.open_reqs[i].state != GCOAP_MEMO_UNUSED) {
-            count++;
+    const coap_hdr_t *hdr = (const coap_hdr_t *)buf;
+    size_t hdr_len = coap_hdr_len(hdr);
+    gcoap_observe_memo_t *first = _obs_memo_next_by_resource(NULL, resource);
+    int numof = 0;
+
+    if (hdr_len > len) {
+        mutex_unlock(&_coap_state.lock);
+        return -EINVAL;
+    }
+
+    /* options and payload are the same for all observers */
+    iolist_t body = {
+        .iol_base = (uint8_t *)buf + hdr_len,
+        .iol_len = len - hdr_len,
+    };
+
+    for (gcoap_observe_memo_t *memo = first; memo != NULL;
+         memo = _obs_memo_next_by_resource(memo, resource)) {
+        uint8_t obs_hdr[sizeof(coap_hdr_t) + GCOAP_TOKENLEN_MAX];
+        coap_hdr_t *obs = (coap_hdr_t *)obs_hdr;
+        iolist_t head = {
+            .iol_next = &body,
+            .iol_base = obs_hdr,
+            .iol_len = sizeof(coap_hdr_t) + memo->token_len,
+        };
+
+        /* gcoap_obs_init() built the header for the first observer, all
+         * others get their own token and message ID */
+        if (memo != first) {
+            memo->last_msgid = gcoap_next_msg_id();
+        }
+        memcpy(obs, hdr, sizeof(coap_hdr_t));
+        obs->ver_t_tkl = (hdr->ver_t_tkl & 0xf0) | memo->token_len;
+        obs->id = byteorder_htons(memo->last_msgid).u16;
+        memcpy(obs_hdr + sizeof(coap_hdr_t), memo->token, memo->token_len);
+
+        sock_udp_aux_tx_t aux = { 0 };
+        if (memo->notifier) {
+            memcpy(&aux.local, memo->notifier, sizeof(*memo->notifier));
+            aux.flags = SOCK_AUX_SET_LOCAL;
+        }
+        if (_tl_sendv(&memo->socket, &head, memo->observer, &aux) > 0) {
+            numof++;
         }
     }
+    mutex_unlock(&_coap_state.lock);
+    return numof;
+}
+
+unsigned gcoap_op_state(void)
+{
+    unsigned count = 0;
+
+    mutex_lock(&_coap_state.lock);
+    for (gcoap_request_memo_t *memo = _req_memo_next(NULL); memo != NULL;
+         memo = _req_memo_next(memo)) {
+        count++;
+    }
+    mutex_unlock(&_coap_state.lock);
     return count;
 }
 
+#if IS_USED(MODULE_GCOAP_MEMO_INDEX)
+void gcoap_req_memo_pool_extend(gcoap_request_memo_t *memos, size_t numof)
+{
+    assert(memos && numof);
+
+    mutex_lock(&_coap_state.lock);
+    memarray_extend(&_coap_state.req_memo_pool, memos, numof);
+    mutex_unlock(&_coap_state.lock);
+}
+#endif
+
 int gcoap_get_resource_list(void *buf, size_t maxlen, uint8_t cf,
                                gcoap_socket_type_t tl_type)
 {
@@ -35,7 +35,7 @@ extern "C" {
 /**
  * @brief   client ep structure
  */
-typedef struct {
+typedef struct client_ep {
     coap_pkt_t pdu;                         /**< forward CoAP PDU */
     sock_udp_ep_t server_ep;                /**< forward Server endpoint */
     sock_udp_ep_t ep;                       /**< client endpoint */
@@ -47,6 +47,21 @@ typedef struct {
 #endif
     ztimer_t empty_ack_timer;               /**< empty ACK timer */
     event_t event;                          /**< client event */
+    /**
+     * @brief   Forward request, replaced by the response of the server with
+     *          `gcoap_forward_proxy_workers`
+     */
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    struct client_ep *coalesced;            /**< next client waiting for the same response */
+    bool coalescable;                       /**< others may wait for the response */
+#if IS_USED(MODULE_GCOAP_FORWARD_PROXY_WORKERS)
+    event_t done;                           /**< a worker finished the forward request */
+    int res;                                /**< result of the forward request */
+    uint8_t req_code;                       /**< code of the forward request */
+#if IS_USED(MODULE_NANOCOAP_CACHE)
+    uint8_t cache_key[CONFIG_NANOCOAP_CACHE_KEY_LENGTH]; /**< cache key of the request */
+#endif
+#endif
 } client_ep_t;
 
 /**
@@ -58,6 +73,14 @@ typedef struct {
                                 + sizeof(coap_pkt_t) + GCOAP_DTLS_EXTRA_STACKSIZE)
 #endif
 
+/**
+ * @brief Stack size of a forward proxy worker
+ */
+#ifndef GCOAP_PROXY_WORKER_STACK_SIZE
+#define GCOAP_PROXY_WORKER_STACK_SIZE (THREAD_STACKSIZE_DEFAULT + DEBUG_EXTRA_STACKSIZE \
+                                       + sizeof(coap_pkt_t))
+#endif
+
 /**
  * @brief Definition of forward proxy thread msgs.
  */
@@ -80,6 +103,38 @@ void gcoap_forward_proxy_thread_init(void);
  */
 int gcoap_forward_proxy_req_send(client_ep_t *cep);
 
+/**
+ * @brief   Start the forward proxy workers
+ */
+void gcoap_forward_proxy_workers_init(void);
+
+/**
+ * @brief   Queue the forward request of @p cep for the next worker with a
+ *          free exchange
+ *
+ * The worker stores the response with @ref gcoap_forward_proxy_resp_store,
+ * sets `cep->res` and posts `cep->done` to the gcoap thread.
+ *
+ * @param[in] cep   client endpoint
+ *
+ * @return  0 on success
+ * @return  -EAGAIN if the queue of the workers is full
+ */
+int gcoap_forward_proxy_worker_dispatch(client_ep_t *cep);
+
+/**
+ * @brief   Store the response of the server in the buffer of @p cep
+ *
+ * Called by a worker when the response to the forward request arrives.
+ *
+ * @param[in] cep   client endpoint
+ * @param[in] resp  response of the server
+ *
+ * @return  length of the response on success
+ * @return  -ENOBUFS if the response does not fit into `cep->buf`
+ */
+ssize_t gcoap_forward_proxy_resp_store(client_ep_t *cep, const coap_pkt_t *resp);
+
 #ifdef __cplusplus
 }
 #endif
@@ -20,13 +20,30 @@
 
 #include <string.h>
 
+#include "container.h"
 #include "kernel_defines.h"
 #include "net/nanocoap/cache.h"
 #include "hashes/sha256.h"
+#include "hashes/siphash.h"
+#include "random.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+static_assert((CONFIG_NANOCOAP_CACHE_BUCKETS & (CONFIG_NANOCOAP_CACHE_BUCKETS - 1)) == 0,
+              "CONFIG_NANOCOAP_CACHE_BUCKETS must be a power of two");
+static_assert(CONFIG_NANOCOAP_CACHE_KEY_LENGTH >= 2,
+              "CONFIG_NANOCOAP_CACHE_KEY_LENGTH is too short for the hash table");
+
+#if IS_ACTIVE(CONFIG_NANOCOAP_CACHE_KEY_SIPHASH)
+static_assert(CONFIG_NANOCOAP_CACHE_KEY_LENGTH <= SIPHASH_DIGEST_LENGTH,
+              "CONFIG_NANOCOAP_CACHE_KEY_LENGTH is too long for SipHash");
+
+typedef siphash_context_t _key_ctx_t;
+#else
+typedef sha256_context_t _key_ctx_t;
+#endif
+
 static int _cache_replacement_lru(void);
 static int _cache_update_lru(clist_node_t *node);
 
@@ -34,20 +51,48 @@ static clist_node_t _cache_list_head = { NULL };
 static clist_node_t _empty_list_head = { NULL };
 
 static nanocoap_cache_entry_t _cache_entries[CONFIG_NANOCOAP_CACHE_ENTRIES];
+static nanocoap_cache_entry_t *_buckets[CONFIG_NANOCOAP_CACHE_BUCKETS];
+
+/* responses are kept back to back at the start of the buffer */
+static uint8_t _cache_buf[CONFIG_NANOCOAP_CACHE_SIZE];
+static size_t _cache_buf_used;
+
+/* earliest Max-Age of the fresh entries, if _expiry_pending */
+static uint32_t _next_expiry;
+static bool _expiry_pending;
+
+static nanocoap_cache_stats_t _stats;
+
+#if IS_ACTIVE(CONFIG_NANOCOAP_CACHE_KEY_SIPHASH)
+static uint8_t _siphash_key[SIPHASH_KEY_LENGTH];
+#endif
 
 static const nanocoap_cache_replacement_strategy_t _replacement_strategy = _cache_replacement_lru;
 static const nanocoap_cache_update_strategy_t _update_strategy = _cache_update_lru;
 
+static int _is_stale(clist_node_t *node, void *arg)
+{
+    nanocoap_cache_entry_t *ce = container_of(node, nanocoap_cache_entry_t, node);
+
+    return nanocoap_cache_entry_is_stale(ce, *(uint32_t *)arg);
+}
+
 static int _cache_replacement_lru(void)
 {
-    clist_node_t *lru_node = clist_lpeek(&_cache_list_head);
+    uint32_t now = ztimer_now(ZTIMER_SEC);
+    /* stale entries are replaced first */
+    clist_node_t *lru_node = clist_foreach(&_cache_list_head, _is_stale, &now);
 
+    if (!lru_node) {
+        lru_node = clist_lpeek(&_cache_list_head);
+    }
     /* no element in the list */
     if (!lru_node) {
         return -1;
     }
 
     nanocoap_cache_entry_t *lru_ce = container_of(lru_node, nanocoap_cache_entry_t, node);
+    _stats.evictions++;
     return nanocoap_cache_del(lru_ce);
 }
 
@@ -62,11 +107,96 @@ static int _cache_update_lru(clist_node_t *node)
     return -1;
 }
 
+static nanocoap_cache_entry_t **_bucket(const uint8_t *cache_key)
+{
+    /* the cache key already is a hash */
+    unsigned hash = cache_key[0] | (cache_key[1] << 8);
+
+    return &_buckets[hash & (CONFIG_NANOCOAP_CACHE_BUCKETS - 1)];
+}
+
+static nanocoap_cache_entry_t *_lookup(const uint8_t *cache_key)
+{
+    nanocoap_cache_entry_t *ce = *_bucket(cache_key);
+
+    while (ce && memcmp(ce->cache_key, cache_key, CONFIG_NANOCOAP_CACHE_KEY_LENGTH)) {
+        ce = ce->bucket_next;
+    }
+    return ce;
+}
+
+static void _track_expiry(const nanocoap_cache_entry_t *ce)
+{
+    if (!_expiry_pending || ((int)(ce->max_age - _next_expiry) < 0)) {
+        _next_expiry = ce->max_age;
+        _expiry_pending = true;
+    }
+}
+
+static bool _has_etag(const nanocoap_cache_entry_t *ce)
+{
+    uint8_t *etag;
+
+    return coap_opt_get_opaque((coap_pkt_t *)&ce->response_pkt, COAP_OPT_ETAG, &etag) > 0;
+}
+
+/* Removes all stale entries without ETag, once the earliest Max-Age of
+ * the cache has passed */
+static void _sweep(void)
+{
+    uint32_t now = ztimer_now(ZTIMER_SEC);
+
+    if (!_expiry_pending || ((int)(now - _next_expiry) <= 0)) {
+        return;
+    }
+    _expiry_pending = false;
+    for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
+        nanocoap_cache_entry_t *ce = &_cache_entries[i];
+
+        if (ce->response_buf == NULL) {
+            continue;
+        }
+        if (!nanocoap_cache_entry_is_stale(ce, now)) {
+            _track_expiry(ce);
+        }
+        else if (!_has_etag(ce)) {
+            DEBUG("nanocoap_cache: entry %u expired\n", i);
+            nanocoap_cache_del(ce);
+            _stats.expirations++;
+        }
+    }
+}
+
+/* Frees the bytes of a response and closes the gap in the buffer */
+static void _buf_free(nanocoap_cache_entry_t *ce)
+{
+    uint8_t *end = ce->response_buf + ce->response_len;
+
+    memmove(ce->response_buf, end, &_cache_buf[_cache_buf_used] - end);
+    _cache_buf_used -= ce->response_len;
+    for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
+        nanocoap_cache_entry_t *moved = &_cache_entries[i];
+
+        if (moved->response_buf >= end) {
+            moved->response_buf -= ce->response_len;
+            moved->response_pkt.hdr = (coap_hdr_t *)moved->response_buf;
+            moved->response_pkt.payload -= ce->response_len;
+        }
+    }
+}
+
 void nanocoap_cache_init(void)
 {
     _cache_list_head.next = NULL;
     _empty_list_head.next = NULL;
     memset(_cache_entries, 0, sizeof(_cache_entries));
+    memset(_buckets, 0, sizeof(_buckets));
+    memset(&_stats, 0, sizeof(_stats));
+    _cache_buf_used = 0;
+    _expiry_pending = false;
+#if IS_ACTIVE(CONFIG_NANOCOAP_CACHE_KEY_SIPHASH)
+    random_bytes(_siphash_key, sizeof(_siphash_key));
+#endif
     /* construct list of empty entries */
     for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
         clist_rpush(&_empty_list_head, &_cache_entries[i].node);
@@ -75,15 +205,55 @@ void nanocoap_cache_init(void)
 
 size_t nanocoap_cache_used_count(void)
 {
+    _sweep();
     return clist_count(&_cache_list_head);
 }
 
 size_t nanocoap_cache_free_count(void)
 {
+    _sweep();
     return clist_count(&_empty_list_head);
 }
 
-static void _cache_key_digest_opts(const coap_pkt_t *req, sha256_context_t *ctx,
+size_t nanocoap_cache_used_bytes(void)
+{
+    _sweep();
+    return _cache_buf_used;
+}
+
+void nanocoap_cache_stats_get(nanocoap_cache_stats_t *stats)
+{
+    *stats = _stats;
+}
+
+static void _key_init(_key_ctx_t *ctx)
+{
+#if IS_ACTIVE(CONFIG_NANOCOAP_CACHE_KEY_SIPHASH)
+    siphash_init(ctx, _siphash_key);
+#else
+    sha256_init(ctx);
+#endif
+}
+
+static void _key_update(_key_ctx_t *ctx, const void *data, size_t len)
+{
+#if IS_ACTIVE(CONFIG_NANOCOAP_CACHE_KEY_SIPHASH)
+    siphash_update(ctx, data, len);
+#else
+    sha256_update(ctx, data, len);
+#endif
+}
+
+static void _key_final(_key_ctx_t *ctx, void *cache_key)
+{
+#if IS_ACTIVE(CONFIG_NANOCOAP_CACHE_KEY_SIPHASH)
+    siphash_final(ctx, cache_key);
+#else
+    sha256_final(ctx, cache_key);
+#endif
+}
+
+static void _cache_key_digest_opts(const coap_pkt_t *req, _key_ctx_t *ctx,
         bool include_etag,
         bool include_blockwise)
 {
@@ -111,42 +281,42 @@ static void _cache_key_digest_opts(const coap_pkt_t *req, sha256_context_t *ctx,
                     )) {
                 continue;
             }
-            sha256_update(ctx, &opt.opt_num, sizeof(opt.opt_num));
-            sha256_update(ctx, value, optlen);
+            _key_update(ctx, &opt.opt_num, sizeof(opt.opt_num));
+            _key_update(ctx, value, optlen);
         }
     }
 }
 
 void nanocoap_cache_key_options_generate(const coap_pkt_t *req, void *cache_key)
 {
-    sha256_context_t ctx;
-    sha256_init(&ctx);
+    _key_ctx_t ctx;
+    _key_init(&ctx);
     _cache_key_digest_opts(req, &ctx, true, true);
-    sha256_final(&ctx, cache_key);
+    _key_final(&ctx, cache_key);
 }
 
 void nanocoap_cache_key_blockreq_options_generate(const coap_pkt_t *req, void *cache_key)
 {
-    sha256_context_t ctx;
-    sha256_init(&ctx);
+    _key_ctx_t ctx;
+    _key_init(&ctx);
     _cache_key_digest_opts(req, &ctx, true, false);
-    sha256_final(&ctx, cache_key);
+    _key_final(&ctx, cache_key);
 }
 
 void nanocoap_cache_key_generate(const coap_pkt_t *req, uint8_t *cache_key)
 {
-    sha256_context_t ctx;
-    sha256_init(&ctx);
+    _key_ctx_t ctx;
+    _key_init(&ctx);
 
     _cache_key_digest_opts(req, &ctx, !(IS_USED(MODULE_GCOAP_FORWARD_PROXY)), true);
     switch (req->hdr->code) {
         case COAP_METHOD_FETCH:
-            sha256_update(&ctx, req->payload, req->payload_len);
+            _key_update(&ctx, req->payload, req->payload_len);
             break;
         default:
             break;
     }
-    sha256_final(&ctx, cache_key);
+    _key_final(&ctx, cache_key);
 }
 
 ssize_t nanocoap_cache_key_compare(uint8_t *cache_key1, uint8_t *cache_key2)
@@ -154,31 +324,21 @@ ssize_t nanocoap_cache_key_compare(uint8_t *cache_key1, uint8_t *cache_key2)
     return memcmp(cache_key1, cache_key2, CONFIG_NANOCOAP_CACHE_KEY_LENGTH);
 }
 
-static int _compare_cache_keys(clist_node_t *ce, void *arg)
-{
-    nanocoap_cache_entry_t *iterator = container_of(ce, nanocoap_cache_entry_t, node);
-    uint8_t *cache_key = (uint8_t *) arg;
-
-    if (!memcmp(iterator->cache_key, cache_key, CONFIG_NANOCOAP_CACHE_KEY_LENGTH)) {
-        return 1;
-    }
-    return 0;
-}
-
-static clist_node_t *_nanocoap_cache_foreach(const uint8_t *key)
-{
-    return clist_foreach(&_cache_list_head, _compare_cache_keys, (uint8_t *)key);
-}
-
 nanocoap_cache_entry_t *nanocoap_cache_key_lookup(const uint8_t *key)
 {
-    clist_node_t *node = _nanocoap_cache_foreach(key);
+    nanocoap_cache_entry_t *ce;
 
-    if (node) {
-        _update_strategy(node);
+    _sweep();
+    ce = _lookup(key);
+    if (ce) {
+        _update_strategy(&ce->node);
+        _stats.hits++;
+    }
+    else {
+        _stats.misses++;
     }
 
-    return container_of(node, nanocoap_cache_entry_t, node);
+    return ce;
 }
 
 nanocoap_cache_entry_t *nanocoap_cache_request_lookup(const coap_pkt_t *req)
@@ -199,7 +359,9 @@ nanocoap_cache_entry_t *nanocoap_cache_process(const uint8_t *cache_key, unsigne
                                                const coap_pkt_t *resp, size_t resp_len)
 {
     nanocoap_cache_entry_t *ce;
-    ce = nanocoap_cache_key_lookup(cache_key);
+
+    _sweep();
+    ce = _lookup(cache_key);
 
     /* This response is not cacheable. */
     if (resp->hdr->code == COAP_CODE_CREATED) {
@@ -213,6 +375,7 @@ nanocoap_cache_entry_t *nanocoap_cache_process(const uint8_t *cache_key, unsigne
             /* set max_age to now(), so that the cache is considered
              * stale immdiately */
             ce->max_age = ztimer_now(ZTIMER_SEC);
+            _track_expiry(ce);
         }
     }
     /* When a cache that recognizes and processes the ETag response
@@ -232,6 +395,7 @@ nanocoap_cache_entry_t *nanocoap_cache_process(const uint8_t *cache_key, unsigne
             uint32_t max_age = 60;
             coap_opt_get_uint((coap_pkt_t *)resp, COAP_OPT_MAX_AGE, &max_age);
             ce->max_age = ztimer_now(ZTIMER_SEC) + max_age;
+            _track_expiry(ce);
         }
         /* TODO: handle the copying of the new options (if changed) */
     }
@@ -243,6 +407,7 @@ nanocoap_cache_entry_t *nanocoap_cache_process(const uint8_t *cache_key, unsigne
             /* set max_age to now(), so that the cache is considered
              * stale immdiately */
             ce->max_age = ztimer_now(ZTIMER_SEC);
+            _track_expiry(ce);
         }
     }
     /* This response is cacheable: Caches can use the Max-Age Option
@@ -277,31 +442,35 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_key(const uint8_t *cache_key,
                                                   const coap_pkt_t *resp,
                                                   size_t resp_len)
 {
-    nanocoap_cache_entry_t *ce = nanocoap_cache_key_lookup(cache_key);
-    bool add_to_cache = false;
+    nanocoap_cache_entry_t *ce;
 
-    if (resp_len > CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE) {
+    if ((resp_len > CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE) ||
+        (resp_len > sizeof(_cache_buf))) {
         DEBUG("nanocoap_cache: response too large to cache (%" PRIuSIZE "> %d)\n",
               resp_len, CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE);
         return NULL;
     }
 
-    if (!ce) {
-        /* did not find .. get an empty cache container */
-        ce = _nanocoap_cache_pop();
-        add_to_cache = true;
+    _sweep();
+    /* the new response replaces the response of an existing entry */
+    if ((ce = _lookup(cache_key))) {
+        nanocoap_cache_del(ce);
     }
 
-    /* no space left */
-    if (!ce) {
+    /* make room for the response */
+    while ((sizeof(_cache_buf) - _cache_buf_used) < resp_len) {
+        if (_replacement_strategy()) {
+            return NULL;
+        }
+    }
+    /* get an empty cache container */
+    if (!(ce = _nanocoap_cache_pop())) {
         /* could not remove any entry */
         if (_replacement_strategy()) {
             return NULL;
         }
         /* could remove an entry */
-        ce = _nanocoap_cache_pop();
-        add_to_cache = true;
-        if (!ce) {
+        if (!(ce = _nanocoap_cache_pop())) {
             /* still no free space ? stop trying now */
             return NULL;
         }
@@ -309,7 +478,9 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_key(const uint8_t *cache_key,
 
     memcpy(ce->cache_key, cache_key, CONFIG_NANOCOAP_CACHE_KEY_LENGTH);
     memcpy(&ce->response_pkt, resp, sizeof(coap_pkt_t));
-    memcpy(&ce->response_buf, resp->hdr, resp_len);
+    ce->response_buf = &_cache_buf[_cache_buf_used];
+    _cache_buf_used += resp_len;
+    memcpy(ce->response_buf, resp->hdr, resp_len);
     ce->response_pkt.hdr = (coap_hdr_t *) ce->response_buf;
     ce->response_pkt.payload = ce->response_buf + (resp->payload - ((uint8_t *)resp->hdr));
     ce->response_len = resp_len;
@@ -319,10 +490,12 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_key(const uint8_t *cache_key,
     uint32_t max_age = 60;
     coap_opt_get_uint((coap_pkt_t *)resp, COAP_OPT_MAX_AGE, &max_age);
     ce->max_age = ztimer_now(ZTIMER_SEC) + max_age;
+    _track_expiry(ce);
 
-    if (add_to_cache) {
-        clist_rpush(&_cache_list_head, &ce->node);
-    }
+    nanocoap_cache_entry_t **bucket = _bucket(ce->cache_key);
+    ce->bucket_next = *bucket;
+    *bucket = ce;
+    clist_rpush(&_cache_list_head, &ce->node);
 
     return ce;
 }
@@ -344,14 +517,22 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_req(const coap_pkt_t *req,
 
 int nanocoap_cache_del(const nanocoap_cache_entry_t *ce)
 {
-    clist_node_t *entry = clist_find(&_cache_list_head, &ce->node);
+    nanocoap_cache_entry_t **link = _bucket(ce->cache_key);
 
-    if (entry) {
-        clist_remove(&_cache_list_head, entry);
-        memset(entry, 0, sizeof(nanocoap_cache_entry_t));
-        clist_rpush(&_empty_list_head, entry);
-        return 0;
+    /* only entries in use are in the hash table */
+    while (*link && (*link != ce)) {
+        link = &(*link)->bucket_next;
+    }
+    if (*link == NULL) {
+        return -1;
     }
 
-    return -1;
+    nanocoap_cache_entry_t *entry = *link;
+
+    *link = entry->bucket_next;
+    clist_remove(&_cache_list_head, &entry->node);
+    _buf_free(entry);
+    memset(entry, 0, sizeof(nanocoap_cache_entry_t));
+    clist_rpush(&_empty_list_head, &entry->node);
+    return 0;
 }
@@ -29,6 +29,7 @@
 #include "bitarithm.h"
 #include "net/nanocoap.h"
 #include "net/nanocoap_sock.h"
+#include "net/nanocoap/resource_trie.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -89,6 +90,9 @@ int coap_parse(coap_pkt_t *pkt, uint8_t *buf, size_t len)
     pkt->payload_len = 0;
     memset(pkt->opt_crit, 0, sizeof(pkt->opt_crit));
     pkt->snips = NULL;
+#ifdef MODULE_GCOAP
+    pkt->observe_value = UINT32_MAX;
+#endif
 
     if (len < sizeof(coap_hdr_t)) {
         DEBUG("msg too short\n");
@@ -155,6 +159,15 @@ int coap_parse(coap_pkt_t *pkt, uint8_t *buf, size_t len)
                 DEBUG("optpos option_nr=%u %u\n", (unsigned)option_nr, (unsigned)optpos->offset);
                 optpos++;
                 option_count++;
+
+#ifdef MODULE_GCOAP
+                /* pick up the observe value while at it instead of searching
+                 * the option again after parsing */
+                if ((option_nr == COAP_OPT_OBSERVE) && (option_len <= 4) &&
+                    (pkt_pos + option_len <= pkt_end)) {
+                    pkt->observe_value = _decode_uint(pkt_pos, option_len);
+                }
+#endif
             }
 
             pkt_pos += option_len;
@@ -171,12 +184,6 @@ int coap_parse(coap_pkt_t *pkt, uint8_t *buf, size_t len)
         pkt->payload = pkt_pos;
     }
 
-#ifdef MODULE_GCOAP
-    if (coap_opt_get_uint(pkt, COAP_OPT_OBSERVE, &pkt->observe_value) != 0) {
-        pkt->observe_value = UINT32_MAX;
-    }
-#endif
-
     DEBUG("coap pkt parsed. code=%u detail=%u payload_len=%u, nopts=%u, 0x%02x\n",
           coap_get_code_class(pkt),
           coap_get_code_detail(pkt),
@@ -205,8 +212,13 @@ uint8_t *coap_find_option(coap_pkt_t *pkt, unsigned opt_num)
     const coap_optpos_t *optpos = pkt->options;
     unsigned opt_count = pkt->options_len;
 
+    /* the option array is sorted by option number, both when parsed and when
+     * built, so the search can stop at the first larger option number */
     while (opt_count--) {
-        if (optpos->opt_num == opt_num) {
+        if (optpos->opt_num >= opt_num) {
+            if (optpos->opt_num > opt_num) {
+                break;
+            }
             unsigned idx = index_of(pkt->options, optpos);
             bf_unset(pkt->opt_crit, idx);
             return (uint8_t*)pkt->hdr + optpos->offset;
@@ -577,6 +589,8 @@ ssize_t coap_handle_req(coap_pkt_t *pkt, uint8_t *resp_buf, unsigned resp_buf_le
                                        coap_resources, coap_resources_numof);
 
     if (retval < 0) {
+        /* no payload is sent with any of the replies below */
+        pkt->snips = NULL;
         if (retval == -ECANCELED) {
             DEBUG_PUTS("nanocoap: No-Response Option present and matching");
             if (coap_get_type(pkt) == COAP_TYPE_CON) {
@@ -616,6 +630,26 @@ ssize_t coap_tree_handler(coap_pkt_t *pkt, uint8_t *resp_buf, unsigned resp_buf_
     }
     DEBUG("nanocoap: URI path: \"%s\"\n", uri);
 
+    if (IS_USED(MODULE_NANOCOAP_RESOURCE_TRIE)) {
+        const coap_resource_t *resource;
+        int res = coap_resource_trie_find(resources, resources_numof,
+                                          (char *)uri, method_flag, &resource);
+
+        if ((res == -ENXIO) &&
+            (coap_resource_trie_add(resources, resources_numof) == 0)) {
+            res = coap_resource_trie_find(resources, resources_numof,
+                                          (char *)uri, method_flag, &resource);
+        }
+        if (res == 0) {
+            ctx->resource = resource;
+            return resource->handler(pkt, resp_buf, resp_buf_len, ctx);
+        }
+        if (res != -ENXIO) {
+            return coap_build_reply(pkt, COAP_CODE_404, resp_buf, resp_buf_len, 0);
+        }
+        /* resources could not be indexed, fall back to linear search */
+    }
+
     for (unsigned i = 0; i < resources_numof; i++) {
         const coap_resource_t *resource = &resources[i];
         if (!(resource->methods & method_flag)) {
@@ -1367,6 +1401,17 @@ ssize_t coap_opt_remove(coap_pkt_t *pkt, uint16_t opt_num)
     return (pkt->payload - ((uint8_t *)pkt->hdr)) + pkt->payload_len;
 }
 
+void coap_payload_add_snip(coap_pkt_t *pkt, iolist_t *snip)
+{
+    iolist_t **tail = &pkt->snips;
+
+    while (*tail) {
+        tail = &(*tail)->iol_next;
+    }
+    snip->iol_next = NULL;
+    *tail = snip;
+}
+
 ssize_t coap_payload_put_bytes(coap_pkt_t *pkt, const void *data, size_t len)
 {
     if (pkt->payload_len < len) {
@@ -1501,6 +1546,24 @@ size_t coap_blockwise_put_bytes(coap_block_slicer_t *slicer, uint8_t *bufpos,
     return str_len;
 }
 
+size_t coap_blockwise_put_snip(coap_block_slicer_t *slicer, coap_pkt_t *pkt,
+                               iolist_t *snip, const void *c, size_t len)
+{
+    size_t offset = (slicer->start > slicer->cur) ? slicer->start - slicer->cur : 0;
+
+    snip->iol_base = (uint8_t *)c + offset;
+    snip->iol_len = 0;
+    /* only the part within the window is attached */
+    if ((slicer->cur < slicer->end) && (offset < len)) {
+        snip->iol_len = ((slicer->cur + len) > slicer->end)
+                        ? slicer->end - (slicer->cur + offset)
+                        : len - offset;
+        coap_payload_add_snip(pkt, snip);
+    }
+    slicer->cur += len;
+    return snip->iol_len;
+}
+
 ssize_t coap_well_known_core_default_handler(coap_pkt_t *pkt, uint8_t *buf, \
                                              size_t len, coap_request_ctx_t *context)
 {
@@ -0,0 +1,262 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_nanocoap_resource_trie
+ * @{
+ *
+ * @file
+ * @brief       nanoCoAP resource index implementation
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "container.h"
+#include "mutex.h"
+#include "net/nanocoap/resource_trie.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define TRIE_NONE   UINT16_MAX
+
+/**
+ * @brief   Trie node
+ *
+ * The label of the edge to a node points into the path of the resource that
+ * created the node, so it is not NUL-terminated.
+ */
+typedef struct {
+    const char *label;      /**< label of the edge to this node */
+    uint16_t child;         /**< first child of the node */
+    uint16_t sibling;       /**< next sibling of the node */
+    uint16_t head;          /**< first resource with a path ending here */
+    uint8_t len;            /**< length of @ref label */
+} _node_t;
+
+/**
+ * @brief   Indexed resource array
+ */
+typedef struct {
+    const coap_resource_t *resources;   /**< the resource array */
+    uint16_t numof;                     /**< number of resources in the array */
+    uint16_t root;                      /**< root node, TRIE_NONE if the array
+                                         *   could not be indexed */
+    uint16_t base;                      /**< offset of the array in _next */
+} _array_t;
+
+static mutex_t _lock = MUTEX_INIT;
+static _node_t _nodes[CONFIG_NANOCOAP_RESOURCE_TRIE_NODES];
+/* resources ending at the same node are linked in order of their index */
+static uint16_t _next[CONFIG_NANOCOAP_RESOURCE_TRIE_RESOURCES];
+static _array_t _arrays[CONFIG_NANOCOAP_RESOURCE_TRIE_ARRAYS];
+static unsigned _nodes_numof;
+static unsigned _next_numof;
+static unsigned _arrays_numof;
+
+static const _array_t *_get_array(const coap_resource_t *resources,
+                                  size_t resources_numof)
+{
+    for (unsigned i = 0; i < _arrays_numof; i++) {
+        if ((_arrays[i].resources == resources) &&
+            (_arrays[i].numof == resources_numof)) {
+            return &_arrays[i];
+        }
+    }
+    return NULL;
+}
+
+static uint16_t _node_new(const char *label, size_t len)
+{
+    if (_nodes_numof >= ARRAY_SIZE(_nodes)) {
+        return TRIE_NONE;
+    }
+
+    _node_t *node = &_nodes[_nodes_numof];
+
+    node->label = label;
+    node->len = len;
+    node->child = TRIE_NONE;
+    node->sibling = TRIE_NONE;
+    node->head = TRIE_NONE;
+    return _nodes_numof++;
+}
+
+static int _insert(const _array_t *array, const char *path, uint16_t idx)
+{
+    uint16_t node = array->root;
+
+    while (*path) {
+        uint16_t *link = &_nodes[node].child;
+
+        while ((*link != TRIE_NONE) && (_nodes[*link].label[0] != *path)) {
+            link = &_nodes[*link].sibling;
+        }
+        if (*link == TRIE_NONE) {
+            size_t len = strlen(path);
+
+            if (len > UINT8_MAX) {
+                return -EINVAL;
+            }
+            if ((*link = _node_new(path, len)) == TRIE_NONE) {
+                return -ENOMEM;
+            }
+            node = *link;
+            break;
+        }
+
+        _node_t *child = &_nodes[*link];
+        unsigned common = 1;
+
+        while ((common < child->len) && (path[common] == child->label[common])) {
+            common++;
+        }
+        if (common < child->len) {
+            /* path diverges within the label: split the edge */
+            uint16_t split = _node_new(child->label, common);
+
+            if (split == TRIE_NONE) {
+                return -ENOMEM;
+            }
+            _nodes[split].child = *link;
+            _nodes[split].sibling = child->sibling;
+            child->sibling = TRIE_NONE;
+            child->label += common;
+            child->len -= common;
+            *link = split;
+        }
+        node = *link;
+        path += common;
+    }
+
+    /* append to keep the resources of a node in order */
+    uint16_t *link = &_nodes[node].head;
+    while (*link != TRIE_NONE) {
+        link = &_next[array->base + *link];
+    }
+    *link = idx;
+    _next[array->base + idx] = TRIE_NONE;
+    return 0;
+}
+
+int coap_resource_trie_add(const coap_resource_t *resources,
+                           size_t resources_numof)
+{
+    int res = 0;
+
+    mutex_lock(&_lock);
+    const _array_t *existing = _get_array(resources, resources_numof);
+    if (existing) {
+        res = (existing->root == TRIE_NONE) ? -ENOMEM : 0;
+        goto out;
+    }
+    if (_arrays_numof >= ARRAY_SIZE(_arrays)) {
+        res = -ENOMEM;
+        goto out;
+    }
+
+    _array_t *array = &_arrays[_arrays_numof];
+    unsigned nodes_numof = _nodes_numof;
+
+    array->resources = resources;
+    array->numof = resources_numof;
+    array->base = _next_numof;
+    array->root = TRIE_NONE;
+    if ((resources_numof <= (ARRAY_SIZE(_next) - _next_numof)) &&
+        ((array->root = _node_new("", 0)) != TRIE_NONE)) {
+        for (unsigned i = 0; i < resources_numof; i++) {
+            if ((res = _insert(array, resources[i].path, i)) < 0) {
+                break;
+            }
+        }
+    }
+    else {
+        res = -ENOMEM;
+    }
+    if (res < 0) {
+        DEBUG("nanocoap: unable to index %u resources: %d\n",
+              (unsigned)resources_numof, res);
+        /* nodes are only ever added to the end of the pool, so this drops all
+         * nodes of this array. Keep the array registered to not try again on
+         * every request. */
+        _nodes_numof = nodes_numof;
+        array->root = TRIE_NONE;
+    }
+    else {
+        _next_numof += resources_numof;
+    }
+    _arrays_numof++;
+
+out:
+    mutex_unlock(&_lock);
+    return res;
+}
+
+int coap_resource_trie_find(const coap_resource_t *resources,
+                            size_t resources_numof, const char *uri,
+                            coap_method_flags_t method_flag,
+                            const coap_resource_t **resource)
+{
+    uint16_t found = TRIE_NONE;
+    bool path_matches = false;
+
+    mutex_lock(&_lock);
+    const _array_t *array = _get_array(resources, resources_numof);
+    if ((array == NULL) || (array->root == TRIE_NONE)) {
+        mutex_unlock(&_lock);
+        return -ENXIO;
+    }
+
+    uint16_t node = array->root;
+    while (1) {
+        bool end = (*uri == '\0');
+
+        for (uint16_t idx = _nodes[node].head; idx != TRIE_NONE;
+             idx = _next[array->base + idx]) {
+            const coap_resource_t *r = &resources[idx];
+
+            /* before the end of the URI only subtrees match */
+            if (!end && !(r->methods & COAP_MATCH_SUBTREE)) {
+                continue;
+            }
+            if (!(r->methods & method_flag)) {
+                path_matches = true;
+                continue;
+            }
+            if (idx < found) {
+                found = idx;
+            }
+            break;
+        }
+        if (end) {
+            break;
+        }
+
+        node = _nodes[node].child;
+        while ((node != TRIE_NONE) && (_nodes[node].label[0] != *uri)) {
+            node = _nodes[node].sibling;
+        }
+        if ((node == TRIE_NONE) ||
+            (strncmp(uri, _nodes[node].label, _nodes[node].len) != 0)) {
+            break;
+        }
+        uri += _nodes[node].len;
+    }
+    mutex_unlock(&_lock);
+
+    if (found != TRIE_NONE) {
+        *resource = &resources[found];
+        return 0;
+    }
+    return path_matches ? -ENOTSUP : -ENOENT;
+}
@@ -792,6 +792,26 @@ static int _block_cb(void *arg, coap_pkt_t *pkt)
     return ctx->callback(ctx->arg, block2.offset, pkt->payload, pkt->payload_len, block2.more);
 }
 
+static void _build_block_get(coap_pkt_t *pkt, size_t len, const char *path,
+                             coap_blksize_t blksize, uint32_t blknum,
+                             uint16_t id, const void *token, size_t token_len)
+{
+    uint8_t *pktpos = (uint8_t *)pkt->hdr;
+    uint16_t lastonum = 0;
+
+    pktpos += coap_build_hdr(pkt->hdr, COAP_TYPE_CON, token, token_len,
+                             COAP_METHOD_GET, id);
+    pktpos += coap_opt_put_uri_pathquery(pktpos, &lastonum, path);
+    pktpos += coap_opt_put_uint(pktpos, lastonum, COAP_OPT_BLOCK2,
+                                (blknum << 4) | blksize);
+
+    (void)len;
+    assert((uintptr_t)pktpos - (uintptr_t)pkt->hdr < len);
+
+    pkt->payload = pktpos;
+    pkt->payload_len = 0;
+}
+
 static int _fetch_block(nanocoap_sock_t *sock, uint8_t *buf, size_t len,
                         const char *path, coap_blksize_t blksize,
                         _block_ctx_t *ctx)
@@ -799,7 +819,6 @@ static int _fetch_block(nanocoap_sock_t *sock, uint8_t *buf, size_t len,
     coap_pkt_t pkt = {
         .hdr = (void *)buf,
     };
-    uint16_t lastonum = 0;
 
     void *token = NULL;
     size_t token_len = 0;
@@ -811,16 +830,8 @@ static int _fetch_block(nanocoap_sock_t *sock, uint8_t *buf, size_t len,
     token_len = sizeof(ctx->token);
 #endif
 
-    buf += coap_build_hdr(pkt.hdr, COAP_TYPE_CON, token, token_len, COAP_METHOD_GET,
-                          nanocoap_sock_next_msg_id(sock));
-    buf += coap_opt_put_uri_pathquery(buf, &lastonum, path);
-    buf += coap_opt_put_uint(buf, lastonum, COAP_OPT_BLOCK2, (ctx->blknum << 4) | blksize);
-
-    (void)len;
-    assert((uintptr_t)buf - (uintptr_t)pkt.hdr < len);
-
-    pkt.payload = buf;
-    pkt.payload_len = 0;
+    _build_block_get(&pkt, len, path, blksize, ctx->blknum,
+                     nanocoap_sock_next_msg_id(sock), token, token_len);
 
     return nanocoap_sock_request_cb(sock, &pkt, _block_cb, ctx);
 }
@@ -909,6 +920,284 @@ int nanocoap_sock_get_blockwise(nanocoap_sock_t *sock, const char *path,
     return 0;
 }
 
+enum {
+    BLOCK_SLOT_FREE,        /**< slot is not used */
+    BLOCK_SLOT_SENT,        /**< block request sent, waiting for the block */
+    BLOCK_SLOT_SEPARATE,    /**< empty ACK received, waiting for the block */
+};
+
+typedef struct {
+    uint32_t blknum;        /**< requested block */
+    uint32_t deadline;      /**< deadline for the response in usec */
+    uint32_t timeout;       /**< current retransmission timeout in usec */
+    uint16_t id;            /**< message ID of the request */
+    uint8_t tries_left;     /**< transmissions left for the request */
+    uint8_t state;          /**< state of the slot */
+} _block_slot_t;
+
+typedef struct {
+    _block_slot_t slots[CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW_MAX];
+    coap_blockwise_cb_t callback;
+    void *arg;
+    const char *path;
+    uint32_t next;          /**< next block to request */
+    uint32_t end;           /**< first block known to be past the resource */
+    uint32_t last;          /**< lowest block received with more == 0 */
+    unsigned window;
+    unsigned pending;       /**< number of slots in use */
+    int err;                /**< error response received for a block > 0 */
+    coap_blksize_t blksize;
+    uint8_t token[4];       /**< last byte is replaced by the slot index */
+} _block_pipe_t;
+
+static int _pipe_send(nanocoap_sock_t *sock, _block_pipe_t *pipe, unsigned idx)
+{
+    _block_slot_t *slot = &pipe->slots[idx];
+    coap_pkt_t pkt = {
+        .hdr = (void *)sock->hdr_buf,
+    };
+
+    if (slot->tries_left == 0) {
+        DEBUG("nanocoap: block %"PRIu32" timed out\n", slot->blknum);
+        return -ETIMEDOUT;
+    }
+    slot->tries_left--;
+    pipe->token[sizeof(pipe->token) - 1] = idx;
+    _build_block_get(&pkt, sizeof(sock->hdr_buf), pipe->path, pipe->blksize,
+                     slot->blknum, slot->id, pipe->token, sizeof(pipe->token));
+    slot->deadline = _deadline_from_interval(slot->timeout);
+    DEBUG("nanocoap: request block %"PRIu32" (%u tries left)\n",
+          slot->blknum, slot->tries_left);
+
+    iolist_t head = {
+        .iol_base = pkt.hdr,
+        .iol_len = coap_get_total_len(&pkt),
+    };
+    int res = _sock_sendv(sock, &head);
+    return (res < 0) ? res : 0;
+}
+
+static void _pipe_cut(_block_pipe_t *pipe, uint32_t end)
+{
+    if (end >= pipe->end) {
+        return;
+    }
+    pipe->end = end;
+    /* drop requests for blocks past the end of the resource */
+    for (unsigned i = 0; i < pipe->window; i++) {
+        _block_slot_t *slot = &pipe->slots[i];
+        if ((slot->state != BLOCK_SLOT_FREE) && (slot->blknum >= end)) {
+            slot->state = BLOCK_SLOT_FREE;
+            pipe->pending--;
+        }
+    }
+}
+
+static _block_slot_t *_pipe_match(_block_pipe_t *pipe, coap_pkt_t *pkt)
+{
+    const uint8_t *token = coap_get_token(pkt);
+    const unsigned last = sizeof(pipe->token) - 1;
+
+    if (coap_get_token_len(pkt) == sizeof(pipe->token)) {
+        unsigned idx = token[last];
+        if ((idx < pipe->window) &&
+            (memcmp(token, pipe->token, last) == 0) &&
+            (pipe->slots[idx].state != BLOCK_SLOT_FREE)) {
+            return &pipe->slots[idx];
+        }
+    }
+    if ((coap_get_code_raw(pkt) != COAP_CODE_EMPTY) ||
+        (coap_get_type(pkt) == COAP_TYPE_CON) ||
+        (coap_get_type(pkt) == COAP_TYPE_NON)) {
+        return NULL;
+    }
+    /* empty ACK or RST only carry the message ID */
+    for (unsigned i = 0; i < pipe->window; i++) {
+        _block_slot_t *slot = &pipe->slots[i];
+        if ((slot->state != BLOCK_SLOT_FREE) && (slot->id == coap_get_id(pkt))) {
+            return slot;
+        }
+    }
+    return NULL;
+}
+
+static int _pipe_recv(nanocoap_sock_t *sock, _block_pipe_t *pipe,
+                      coap_pkt_t *pkt)
+{
+    _block_slot_t *slot = _pipe_match(pipe, pkt);
+    coap_block1_t block2;
+    int res;
+
+    if (slot == NULL) {
+        DEBUG("nanocoap: no request for response %u\n", coap_get_id(pkt));
+        return 0;
+    }
+    if ((coap_get_type(pkt) == COAP_TYPE_ACK) && (coap_get_id(pkt) != slot->id)) {
+        DEBUG("nanocoap: ID mismatch, got %u want %u\n", coap_get_id(pkt), slot->id);
+        return 0;
+    }
+    switch (coap_get_type(pkt)) {
+    case COAP_TYPE_RST:
+        return -EBADMSG;
+    case COAP_TYPE_CON:
+        _send_ack(sock, pkt);
+        break;
+    case COAP_TYPE_ACK:
+        if (coap_get_code_raw(pkt) == COAP_CODE_EMPTY) {
+            /* empty ACK, wait for separate response */
+            slot->state = BLOCK_SLOT_SEPARATE;
+            slot->deadline = _deadline_from_interval(CONFIG_COAP_SEPARATE_RESPONSE_TIMEOUT_MS
+                                                     * US_PER_MS);
+            slot->tries_left = 0; /* stop retransmissions */
+            return 0;
+        }
+        break;
+    default:
+        break;
+    }
+
+    res = _get_error(pkt);
+    if (res) {
+        if (slot->blknum == 0) {
+            return res;
+        }
+        /* might just be a request for a block past the end of the resource,
+         * so only fail if the resource turns out to be longer */
+        DEBUG("nanocoap: error %d for block %"PRIu32"\n", res, slot->blknum);
+        pipe->err = res;
+        _pipe_cut(pipe, slot->blknum);
+        return 0;
+    }
+
+    /* response was not block-wise */
+    if (!coap_get_block2(pkt, &block2)) {
+        block2.offset = 0;
+        block2.more = false;
+    }
+    if (block2.blknum != slot->blknum) {
+        DEBUG("nanocoap: got block %"PRIu32", want %"PRIu32"\n",
+              block2.blknum, slot->blknum);
+        return 0;
+    }
+    DEBUG("nanocoap: got block %"PRIu32" (offset %u)\n",
+          block2.blknum, (unsigned)block2.offset);
+
+    slot->state = BLOCK_SLOT_FREE;
+    pipe->pending--;
+    if (block2.blknum == 0) {
+        uint32_t size2;
+        if (coap_opt_get_uint(pkt, COAP_OPT_SIZE2, &size2) == 0) {
+            unsigned shift = pipe->blksize + 4;
+            uint32_t num = (size2 >> shift) + !!(size2 & ((1UL << shift) - 1));
+            /* even an empty resource consists of one block */
+            _pipe_cut(pipe, MAX(num, 1U));
+        }
+    }
+    if (!block2.more) {
+        if (block2.blknum < pipe->last) {
+            pipe->last = block2.blknum;
+        }
+        _pipe_cut(pipe, block2.blknum + 1);
+    }
+    /* an empty block past the end of the resource only tells where it ends */
+    if ((pkt->payload_len == 0) && (block2.blknum > 0)) {
+        return 0;
+    }
+    return pipe->callback(pipe->arg, block2.offset, pkt->payload,
+                          pkt->payload_len, block2.more);
+}
+
+int nanocoap_sock_get_blockwise_pipelined(nanocoap_sock_t *sock, const char *path,
+                                          coap_blksize_t blksize, unsigned window,
+                                          coap_blockwise_cb_t callback, void *arg)
+{
+    _block_pipe_t pipe = {
+        .callback = callback,
+        .arg = arg,
+        .path = path,
+        .end = UINT32_MAX,
+        .last = UINT32_MAX,
+        .window = MAX(1U, MIN(window, CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW_MAX)),
+        .blksize = blksize,
+    };
+    void *payload, *ctx = NULL;
+    int res = 0;
+
+    random_bytes(pipe.token, sizeof(pipe.token));
+
+    /* clear out stale responses from previous requests */
+    _sock_flush(sock);
+
+    while (1) {
+        uint32_t timeout = UINT32_MAX;
+
+        for (unsigned i = 0; i < pipe.window; i++) {
+            _block_slot_t *slot = &pipe.slots[i];
+
+            if ((slot->state == BLOCK_SLOT_FREE) && (pipe.next < pipe.end)) {
+                slot->state = BLOCK_SLOT_SENT;
+                slot->blknum = pipe.next++;
+                slot->id = nanocoap_sock_next_msg_id(sock);
+                slot->tries_left = CONFIG_COAP_MAX_RETRANSMIT + 1;
+                slot->timeout = random_uint32_range(
+                        (uint32_t)CONFIG_COAP_ACK_TIMEOUT_MS * US_PER_MS,
+                        (uint32_t)CONFIG_COAP_ACK_TIMEOUT_MS * CONFIG_COAP_RANDOM_FACTOR_1000);
+                pipe.pending++;
+                if ((res = _pipe_send(sock, &pipe, i)) < 0) {
+                    return res;
+                }
+            }
+            else if ((slot->state != BLOCK_SLOT_FREE) &&
+                     (_deadline_left_us(slot->deadline) == 0)) {
+                slot->timeout *= 2;
+                if ((res = _pipe_send(sock, &pipe, i)) < 0) {
+                    return res;
+                }
+            }
+            if (slot->state != BLOCK_SLOT_FREE) {
+                timeout = MIN(timeout, _deadline_left_us(slot->deadline));
+            }
+        }
+        if (pipe.pending == 0) {
+            break;
+        }
+
+        res = _sock_recv_buf(sock, &payload, &ctx, timeout);
+        if ((res == -ETIMEDOUT) || (res == -EAGAIN)) {
+            /* retransmissions are handled above */
+            continue;
+        }
+        if (res < 0) {
+            DEBUG("nanocoap: error receiving CoAP response, %d\n", res);
+            return res;
+        }
+        if (res > 0) {
+            coap_pkt_t pkt;
+
+            if (coap_parse(&pkt, payload, res) < 0) {
+                DEBUG("nanocoap: error parsing packet\n");
+                res = 0;
+            }
+            else {
+                res = _pipe_recv(sock, &pipe, &pkt);
+            }
+        }
+        while (ctx) {
+            _sock_recv_buf(sock, &payload, &ctx, 0);
+        }
+        if (res < 0) {
+            return res;
+        }
+    }
+
+    /* the block following the last one may have failed, but all other
+     * blocks must have been received */
+    if ((pipe.last == UINT32_MAX) || (pipe.last + 1 != pipe.end)) {
+        return pipe.err ? pipe.err : -EBADMSG;
+    }
+    return 0;
+}
+
 typedef struct {
     uint8_t *ptr;
     size_t len;
@@ -1114,10 +1403,16 @@ ssize_t nanocoap_get_blockwise_url_to_buf(const char *url,
                                           coap_blksize_t blksize,
                                           void *buf, size_t len)
 {
-    _buf_t _buf = { .ptr = buf, .len = len };
-    int res = nanocoap_get_blockwise_url(url, blksize, _2buf, &_buf);
+    nanocoap_sock_t sock;
+    int res = nanocoap_sock_url_connect(url, &sock);
+    if (res) {
+        return res;
+    }
 
-    return (res < 0) ? (ssize_t)res : (ssize_t)_buf.len;
+    res = nanocoap_get_blockwise_to_buf(&sock, sock_urlpath(url), blksize, buf, len);
+    nanocoap_sock_close(&sock);
+
+    return res;
 }
 
 ssize_t nanocoap_get_blockwise_to_buf(nanocoap_sock_t *sock, const char *path,
@@ -1125,8 +1420,17 @@ ssize_t nanocoap_get_blockwise_to_buf(nanocoap_sock_t *sock, const char *path,
                                       void *buf, size_t len)
 {
     _buf_t _buf = { .ptr = buf, .len = len };
+    int res;
 
-    int res = nanocoap_sock_get_blockwise(sock, path, blksize, _2buf, &_buf);
+    /* _2buf() places blocks by their offset, so they may arrive out of order */
+    if (CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW > 1) {
+        res = nanocoap_sock_get_blockwise_pipelined(sock, path, blksize,
+                                                    CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW,
+                                                    _2buf, &_buf);
+    }
+    else {
+        res = nanocoap_sock_get_blockwise(sock, path, blksize, _2buf, &_buf);
+    }
 
     return (res < 0) ? (ssize_t)res : (ssize_t)_buf.len;
 }
@@ -1197,7 +1501,13 @@ int nanocoap_server(sock_udp_ep_t *local, void *rsp_buf, size_t rsp_buf_len)
             continue;
         }
 
-        sock_udp_send_aux(&sock, rsp_buf, res, &remote, aux_out_ptr);
+        /* the handler may have attached payload snips */
+        iolist_t rsp = {
+            .iol_next = pkt.snips,
+            .iol_base = rsp_buf,
+            .iol_len = res,
+        };
+        sock_udp_sendv_aux(&sock, &rsp, &remote, aux_out_ptr);
     }
 
     return 0;
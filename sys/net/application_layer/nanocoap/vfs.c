@@ -72,25 +72,32 @@ int nanocoap_vfs_get(nanocoap_sock_t *sock, const char *path, const char *dst)
     }
 
     DEBUG("nanocoap: downloading %s to %s\n", path, dst_tmp);
-    res = nanocoap_sock_get_blockwise(sock, path, CONFIG_NANOCOAP_BLOCKSIZE_DEFAULT,
-                                      _2file, &fd);
+    /* _2file() seeks to the offset of each block, so they may arrive out of order */
+    if (CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW > 1) {
+        res = nanocoap_sock_get_blockwise_pipelined(sock, path,
+                                                    CONFIG_NANOCOAP_BLOCKSIZE_DEFAULT,
+                                                    CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW,
+                                                    _2file, &fd);
+    }
+    else {
+        res = nanocoap_sock_get_blockwise(sock, path, CONFIG_NANOCOAP_BLOCKSIZE_DEFAULT,
+                                          _2file, &fd);
+    }
     return _finalize_file(fd, res, dst, dst_tmp);
 }
 
 int nanocoap_vfs_get_url(const char *url, const char *dst)
 {
-    int fd, res;
-    char dst_tmp[CONFIG_SOCK_URLPATH_MAXLEN];
-
-    fd = _prepare_file(dst, dst_tmp, sizeof(dst_tmp));
-    if (fd < 0) {
-        return fd;
+    nanocoap_sock_t sock;
+    int res = nanocoap_sock_url_connect(url, &sock);
+    if (res) {
+        return res;
     }
 
-    DEBUG("nanocoap: downloading %s to %s\n", url, dst_tmp);
-    res = nanocoap_get_blockwise_url(url, CONFIG_NANOCOAP_BLOCKSIZE_DEFAULT,
-                                     _2file, &fd);
-    return _finalize_file(fd, res, dst, dst_tmp);
+    res = nanocoap_vfs_get(&sock, sock_urlpath(url), dst);
+    nanocoap_sock_close(&sock);
+
+    return res;
 }
 
 static int _vfs_put(coap_block_request_t *ctx, const char *file, void *buffer)
@@ -119,11 +119,22 @@ int sock_dns_query(const char *domain_name, void *addr_out, int family)
                                        addr_out, &ttl)) > 0) {
             dns_cache_add(domain_name, addr_out, res, ttl);
             break;
+        } else if (res == -ENXIO) {
+            DEBUG("sock_dns: %s has no address\n", domain_name);
+            dns_cache_add_negative(domain_name, family, ttl);
+            break;
         } else {
             DEBUG("sock_dns: can't parse response\n");
         }
     }
 
     sock_udp_close(&sock_dns);
+    if ((res < 0) && (res != -ENXIO)) {
+        /* the server did not answer, an expired address is better than none */
+        int stale = dns_cache_query_stale(domain_name, addr_out, family);
+        if (stale > 0) {
+            res = stale;
+        }
+    }
     return res;
 }
@@ -0,0 +1,381 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_sock_dns_async
+ * @{
+ * @file
+ * @brief   Asynchronous sock DNS client implementation
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <arpa/inet.h>
+
+#include "container.h"
+#include "event/timeout.h"
+#include "mutex.h"
+#include "net/dns/cache.h"
+#include "net/dns/msg.h"
+#include "net/ipv6/addr.h"
+#include "net/sock/async/event.h"
+#include "net/sock/dns_async.h"
+#include "net/sock/util.h"
+#include "random.h"
+#include "ztimer.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* min domain name length is 1, so minimum record length is 7 */
+#define DNS_MIN_REPLY_LEN   (unsigned)(sizeof(dns_hdr_t) + 7)
+
+/* messages of a query, the AAAA message has the ID of the A message | 1 */
+#define MSG_A               (1U << 0)
+#define MSG_AAAA            (1U << 1)
+
+typedef struct {
+    sock_dns_async_req_t *reqs;     /* requests waiting for the query */
+    event_timeout_t timeout;
+    event_t event;
+    uint16_t id;
+    uint8_t family;
+    uint8_t pending;                /* messages without reply, 0 if free */
+    uint8_t tries;
+    int res;                        /* best result so far */
+    uint8_t addr[sizeof(ipv6_addr_t)];
+    char name[SOCK_DNS_MAX_NAME_LEN + 1];
+} _query_t;
+
+static _query_t _queries[CONFIG_SOCK_DNS_ASYNC_QUERIES_NUMOF];
+static sock_udp_t _sock;
+static uint8_t _sock_family;
+/* ID of the last query, starts at a random value */
+static uint16_t _id;
+static uint8_t _buf[CONFIG_DNS_MSG_LEN];
+/* protects everything above */
+static mutex_t _mutex = MUTEX_INIT;
+/* held while callbacks of completed queries are called */
+static mutex_t _cb_mutex = MUTEX_INIT;
+
+static uint8_t _msgs(int family)
+{
+    switch (family) {
+    case AF_INET:
+        return MSG_A;
+    case AF_INET6:
+        return MSG_AAAA;
+    case AF_UNSPEC:
+        return MSG_A | MSG_AAAA;
+    default:
+        return 0;
+    }
+}
+
+static int _send(_query_t *q)
+{
+    int res = -EINVAL;
+
+    q->tries++;
+    for (uint8_t msg = MSG_A; msg <= MSG_AAAA; msg <<= 1) {
+        if (!(q->pending & msg)) {
+            continue;
+        }
+        size_t len = dns_msg_compose_query(_buf, q->name,
+                                           q->id | (msg == MSG_AAAA),
+                                           (msg == MSG_A) ? AF_INET : AF_INET6);
+        int tmp = sock_udp_send(&_sock, _buf, len, &sock_dns_server);
+        if (tmp < 0) {
+            DEBUG("sock_dns_async: can't send: %s\n", strerror(-tmp));
+        }
+        /* one message is enough to wait for a reply */
+        res = (res < 0) ? tmp : res;
+    }
+    event_timeout_set(&q->timeout, CONFIG_SOCK_DNS_ASYNC_TIMEOUT_MS);
+    return (res < 0) ? res : 0;
+}
+
+/* must be called with _mutex locked, from the event thread */
+static void _complete(_query_t *q)
+{
+    uint8_t addr[sizeof(ipv6_addr_t)];
+    sock_dns_async_req_t *reqs = q->reqs;
+    int res = q->res;
+
+    if (res > 0) {
+        memcpy(addr, q->addr, res);
+    }
+    else if (res != -ENXIO) {
+        /* the server did not answer, an expired address is better than none */
+        int stale = dns_cache_query_stale(q->name, addr, q->family);
+        if (stale > 0) {
+            res = stale;
+        }
+        else if (res == 0) {
+            res = -ETIMEDOUT;
+        }
+    }
+    DEBUG("sock_dns_async: %s resolved (%d)\n", q->name, res);
+
+    event_timeout_clear(&q->timeout);
+    event_cancel(CONFIG_SOCK_DNS_ASYNC_EVENT_PRIO, &q->event);
+    q->reqs = NULL;
+    q->pending = 0;
+
+    /* sock_dns_async_cancel() must not return while the callback runs */
+    mutex_lock(&_cb_mutex);
+    mutex_unlock(&_mutex);
+    while (reqs) {
+        sock_dns_async_req_t *req = reqs;
+
+        reqs = req->next;
+        req->cb(req->arg, res, addr);
+    }
+    mutex_unlock(&_cb_mutex);
+    mutex_lock(&_mutex);
+}
+
+static _query_t *_find_msg(uint16_t id, uint8_t msg)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_queries); i++) {
+        if ((_queries[i].pending & msg) && (_queries[i].id == id)) {
+            return &_queries[i];
+        }
+    }
+    return NULL;
+}
+
+static void _handle_reply(size_t len)
+{
+    uint8_t addr[sizeof(ipv6_addr_t)];
+    uint16_t id = ntohs(((dns_hdr_t *)_buf)->id);
+    uint8_t msg = (id & 1) ? MSG_AAAA : MSG_A;
+    int family = (msg == MSG_A) ? AF_INET : AF_INET6;
+    _query_t *q = _find_msg(id & ~1, msg);
+    uint32_t ttl;
+
+    if (q == NULL) {
+        DEBUG("sock_dns_async: unexpected reply %u\n", id);
+        return;
+    }
+
+    int res = dns_msg_parse_reply(_buf, len, family, addr, &ttl);
+    if (res > 0) {
+        dns_cache_add(q->name, addr, res, ttl);
+        /* an IPv6 address is preferred */
+        if ((q->res <= 0) || (msg == MSG_AAAA)) {
+            q->res = res;
+            memcpy(q->addr, addr, res);
+        }
+    }
+    else if (res == -ENXIO) {
+        DEBUG("sock_dns_async: %s has no address of family %d\n", q->name, family);
+        dns_cache_add_negative(q->name, family, ttl);
+        if (q->res <= 0) {
+            q->res = res;
+        }
+    }
+    else {
+        DEBUG("sock_dns_async: can't parse response\n");
+        if (q->res == 0) {
+            q->res = res;
+        }
+        /* wait for the retransmission */
+        return;
+    }
+
+    q->pending &= ~msg;
+    if (q->pending && !((res > 0) && (msg == MSG_AAAA))) {
+        return;
+    }
+    if ((q->family == AF_UNSPEC) && (q->res == -ENXIO)) {
+        dns_cache_add_negative(q->name, AF_UNSPEC, ttl);
+    }
+    _complete(q);
+}
+
+static void _sock_cb(sock_udp_t *sock, sock_async_flags_t flags, void *arg)
+{
+    sock_udp_ep_t remote;
+    ssize_t res;
+
+    (void)arg;
+    if (!(flags & SOCK_ASYNC_MSG_RECV)) {
+        return;
+    }
+
+    mutex_lock(&_mutex);
+    while ((res = sock_udp_recv(sock, _buf, sizeof(_buf), 0, &remote)) != -EAGAIN) {
+        if (res < (int)DNS_MIN_REPLY_LEN) {
+            DEBUG("sock_dns_async: reply too small (%d byte)\n", (int)res);
+            continue;
+        }
+        if (!sock_udp_ep_equal(&remote, &sock_dns_server)) {
+            DEBUG("sock_dns_async: reply not from the DNS server\n");
+            continue;
+        }
+        _handle_reply(res);
+    }
+    mutex_unlock(&_mutex);
+}
+
+static void _timeout_handler(event_t *event)
+{
+    _query_t *q = container_of(event, _query_t, event);
+
+    mutex_lock(&_mutex);
+    if (q->pending) {
+        if (q->tries < SOCK_DNS_RETRIES) {
+            _send(q);
+        }
+        else {
+            _complete(q);
+        }
+    }
+    mutex_unlock(&_mutex);
+}
+
+static int _open(void)
+{
+    sock_udp_ep_t local = { .family = sock_dns_server.family };
+    int res;
+
+    if (_sock_family == sock_dns_server.family) {
+        return 0;
+    }
+    if (_sock_family != AF_UNSPEC) {
+        /* the replies to queries in flight are lost, they time out */
+        sock_udp_close(&_sock);
+        _sock_family = AF_UNSPEC;
+    }
+    /* bind explicitly, the callback does not survive an implicit bind */
+    if ((res = sock_udp_create(&_sock, &local, NULL, 0)) < 0) {
+        return res;
+    }
+    sock_udp_event_init(&_sock, CONFIG_SOCK_DNS_ASYNC_EVENT_PRIO, _sock_cb, NULL);
+    _sock_family = sock_dns_server.family;
+    return 0;
+}
+
+static _query_t *_find_query(const char *domain_name, int family)
+{
+    _query_t *unused = NULL;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_queries); i++) {
+        _query_t *q = &_queries[i];
+
+        if (!q->pending) {
+            unused = unused ? unused : q;
+        }
+        else if ((q->family == family) && !strcmp(q->name, domain_name)) {
+            return q;
+        }
+    }
+    return unused;
+}
+
+int sock_dns_query_async(sock_dns_async_req_t *req, const char *domain_name,
+                         int family, sock_dns_async_cb_t cb, void *arg)
+{
+    uint8_t addr[sizeof(ipv6_addr_t)];
+    uint8_t msgs = _msgs(family);
+    int res;
+
+    if (!msgs) {
+        return -EAFNOSUPPORT;
+    }
+    if (sock_dns_server.port == 0) {
+        return -ECONNREFUSED;
+    }
+    if (strlen(domain_name) > SOCK_DNS_MAX_NAME_LEN) {
+        return -ENOSPC;
+    }
+
+    req->next = NULL;
+    req->cb = cb;
+    req->arg = arg;
+
+    res = dns_cache_query(domain_name, addr, family);
+    if (res) {
+        cb(arg, res, addr);
+        return 0;
+    }
+
+    mutex_lock(&_mutex);
+    if ((res = _open()) < 0) {
+        goto out;
+    }
+
+    if (_id == 0) {
+        _id = random_uint32();
+    }
+
+    _query_t *q = _find_query(domain_name, family);
+    if (q == NULL) {
+        res = -ENOBUFS;
+        goto out;
+    }
+    if (!q->pending) {
+        strcpy(q->name, domain_name);
+        q->family = family;
+        q->pending = msgs;
+        q->tries = 0;
+        q->res = 0;
+        q->id = (_id += 2) & ~1;
+        q->event.handler = _timeout_handler;
+        event_timeout_ztimer_init(&q->timeout, ZTIMER_MSEC,
+                                  CONFIG_SOCK_DNS_ASYNC_EVENT_PRIO, &q->event);
+        if ((res = _send(q)) < 0) {
+            event_timeout_clear(&q->timeout);
+            q->pending = 0;
+            goto out;
+        }
+    }
+    else {
+        DEBUG("sock_dns_async: %s is already being resolved\n", domain_name);
+    }
+
+    /* append, so the callbacks are called in the order of the requests */
+    sock_dns_async_req_t **tail = &q->reqs;
+    while (*tail) {
+        tail = &(*tail)->next;
+    }
+    *tail = req;
+
+out:
+    mutex_unlock(&_mutex);
+    return res;
+}
+
+void sock_dns_async_cancel(sock_dns_async_req_t *req)
+{
+    bool found = false;
+
+    mutex_lock(&_mutex);
+    for (unsigned i = 0; (i < ARRAY_SIZE(_queries)) && !found; i++) {
+        if (!_queries[i].pending) {
+            continue;
+        }
+        for (sock_dns_async_req_t **r = &_queries[i].reqs; *r; r = &(*r)->next) {
+            if (*r == req) {
+                *r = req->next;
+                found = true;
+                break;
+            }
+        }
+    }
+    mutex_unlock(&_mutex);
+
+    if (!found) {
+        /* wait until the callback returned */
+        mutex_lock(&_cb_mutex);
+        mutex_unlock(&_cb_mutex);
+    }
+}
@@ -110,6 +110,10 @@ int sock_dodtls_query(const char *domain_name, void *addr_out, int family)
                     dns_cache_add(domain_name, addr_out, res, ttl);
                     goto out;
                 }
+                if (res == -ENXIO) {
+                    dns_cache_add_negative(domain_name, family, ttl);
+                    goto out;
+                }
             }
             else {
                 res = -EBADMSG;
@@ -120,6 +124,13 @@ int sock_dodtls_query(const char *domain_name, void *addr_out, int family)
 out:
     memset(_dns_buf, 0, sizeof(_dns_buf));  /* flush-out unencrypted data */
     mutex_unlock(&_server_mutex);
+    if ((res < 0) && (res != -ENXIO)) {
+        /* the server did not answer, an expired address is better than none */
+        int stale = dns_cache_query_stale(domain_name, addr_out, family);
+        if (stale > 0) {
+            res = stale;
+        }
+    }
     return res;
 }
 
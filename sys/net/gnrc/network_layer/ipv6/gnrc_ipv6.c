@@ -58,6 +58,13 @@ static msg_t _msg_q[GNRC_IPV6_MSG_QUEUE_SIZE];
  */
 static fib_entry_t _fib_entries[GNRC_IPV6_FIB_TABLE_SIZE];
 
+#if IS_USED(MODULE_FIB_TRIE)
+/**
+ * @brief prefix tree index of the IPv6 forwarding table
+ */
+static fib_trie_node_t _fib_trie[FIB_TRIE_NODES_NUMOF(GNRC_IPV6_FIB_TABLE_SIZE)];
+#endif
+
 /**
  * @brief the IPv6 forwarding table
  */
@@ -93,6 +100,9 @@ kernel_pid_t gnrc_ipv6_init(void)
     gnrc_ipv6_fib_table.data.entries = _fib_entries;
     gnrc_ipv6_fib_table.table_type = FIB_TABLE_TYPE_SH;
     gnrc_ipv6_fib_table.size = GNRC_IPV6_FIB_TABLE_SIZE;
+#if IS_USED(MODULE_FIB_TRIE)
+    gnrc_ipv6_fib_table.trie = _fib_trie;
+#endif
     fib_init(&gnrc_ipv6_fib_table);
 #endif
 
@@ -32,21 +32,9 @@ static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 #define HDR_NETTYPE (GNRC_NETTYPE_UNDEF)
 #endif
 
-gnrc_pktsnip_t *gnrc_ipv6_hdr_build(gnrc_pktsnip_t *payload, const ipv6_addr_t *src,
-                                    const ipv6_addr_t *dst)
+void gnrc_ipv6_hdr_init(ipv6_hdr_t *hdr, const ipv6_addr_t *src,
+                        const ipv6_addr_t *dst)
 {
-    gnrc_pktsnip_t *ipv6;
-    ipv6_hdr_t *hdr;
-
-    ipv6 = gnrc_pktbuf_add(payload, NULL, sizeof(ipv6_hdr_t), HDR_NETTYPE);
-
-    if (ipv6 == NULL) {
-        DEBUG("ipv6_hdr: no space left in packet buffer\n");
-        return NULL;
-    }
-
-    hdr = (ipv6_hdr_t *)ipv6->data;
-
     if (src != NULL) {
 #ifdef MODULE_IPV6_ADDR
         DEBUG("ipv6_hdr: set packet source to %s\n",
@@ -76,6 +64,21 @@ gnrc_pktsnip_t *gnrc_ipv6_hdr_build(gnrc_pktsnip_t *payload, const ipv6_addr_t *
     hdr->v_tc_fl = byteorder_htonl(0x60000000); /* set version, tc and fl in one go*/
     hdr->nh = PROTNUM_RESERVED;
     hdr->hl = 0;
+}
+
+gnrc_pktsnip_t *gnrc_ipv6_hdr_build(gnrc_pktsnip_t *payload, const ipv6_addr_t *src,
+                                    const ipv6_addr_t *dst)
+{
+    gnrc_pktsnip_t *ipv6;
+
+    ipv6 = gnrc_pktbuf_add(payload, NULL, sizeof(ipv6_hdr_t), HDR_NETTYPE);
+
+    if (ipv6 == NULL) {
+        DEBUG("ipv6_hdr: no space left in packet buffer\n");
+        return NULL;
+    }
+
+    gnrc_ipv6_hdr_init(ipv6->data, src, dst);
 
     return ipv6;
 }
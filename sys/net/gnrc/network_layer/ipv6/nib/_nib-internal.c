@@ -46,6 +46,15 @@ static _nib_dr_entry_t _def_routers[CONFIG_GNRC_IPV6_NIB_DEFAULT_ROUTER_NUMOF];
 static _nib_abr_entry_t _abrs[CONFIG_GNRC_IPV6_NIB_ABR_NUMOF];
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
 static rmutex_t _nib_mutex = RMUTEX_INIT;
+#if CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF > 0
+static _nib_rc_entry_t _rc[CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF];
+static unsigned _rc_next;
+/* starts at 1, so zero-initialized route cache entries are invalid */
+static uint32_t _nib_gen = 1;
+#if IS_USED(MODULE_NETSTATS_IPV6)
+netstats_cache_t _nib_rc_stats;
+#endif
+#endif
 
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
@@ -66,12 +75,31 @@ void _nib_init(void)
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
+#if CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF > 0
+    memset(_rc, 0, sizeof(_rc));
+    _rc_next = 0;
+#if IS_USED(MODULE_NETSTATS_IPV6)
+    memset(&_nib_rc_stats, 0, sizeof(_nib_rc_stats));
+#endif
+#endif  /* CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF > 0 */
 #endif  /* TEST_SUITES */
     evtimer_init_msg(&_nib_evtimer);
     /* TODO: load ABR information from persistent memory */
 }
 
 void _nib_acquire(void)
+{
+    rmutex_lock(&_nib_mutex);
+#if CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF > 0
+    /* caller may change the NIB => invalidate route cache */
+    if (++_nib_gen == 0) {
+        /* keep zero-initialized route cache entries invalid */
+        _nib_gen = 1;
+    }
+#endif
+}
+
+void _nib_acquire_ro(void)
 {
     rmutex_lock(&_nib_mutex);
 }
@@ -897,6 +925,63 @@ static inline bool _node_unreachable(_nib_onl_entry_t *node)
     }
 }
 
+#if CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF > 0
+_nib_rc_entry_t *_nib_rc_get(const ipv6_addr_t *dst, unsigned iface)
+{
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF; i++) {
+        _nib_rc_entry_t *entry = &_rc[i];
+
+        if ((entry->gen == _nib_gen) && (entry->iface == iface) &&
+            ipv6_addr_equal(&entry->dst, dst)) {
+#if IS_USED(MODULE_NETSTATS_IPV6)
+            _nib_rc_stats.hits++;
+#endif
+            return entry;
+        }
+    }
+#if IS_USED(MODULE_NETSTATS_IPV6)
+    _nib_rc_stats.misses++;
+#endif
+    return NULL;
+}
+
+void _nib_rc_add(const ipv6_addr_t *dst, unsigned iface,
+                 const gnrc_ipv6_nib_nc_t *nce,
+                 const gnrc_ipv6_nib_ft_t *route)
+{
+    _nib_rc_entry_t *entry = NULL;
+
+    DEBUG("nib: Adding %s%%%u to route cache\n",
+          ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)), iface);
+    /* prefer invalid entries, otherwise replace round-robin */
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF; i++) {
+        if (_rc[i].gen != _nib_gen) {
+            entry = &_rc[i];
+            break;
+        }
+    }
+    if (entry == NULL) {
+        entry = &_rc[_rc_next];
+        _rc_next = (_rc_next + 1) % CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF;
+    }
+    memcpy(&entry->dst, dst, sizeof(entry->dst));
+    memcpy(&entry->nce, nce, sizeof(entry->nce));
+    entry->gen = _nib_gen;
+    entry->iface = iface;
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER)
+    if (route != NULL) {
+        memcpy(&entry->route, &route->dst, sizeof(entry->route));
+        entry->route_len = route->dst_len;
+    }
+    else {
+        entry->route_len = UINT8_MAX;
+    }
+#else
+    (void)route;
+#endif
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF > 0 */
+
 uint32_t _evtimer_lookup(const void *ctx, uint16_t type)
 {
     evtimer_msg_event_t *event = (evtimer_msg_event_t *)_nib_evtimer.events;
@@ -40,6 +40,7 @@
 #include "net/gnrc/pktqueue.h"
 #include "net/gnrc/sixlowpan/ctx.h"
 #include "net/ndp.h"
+#include "net/netstats.h"
 #include "random.h"
 #include "timex.h"
 
@@ -313,9 +314,20 @@ void _nib_init(void);
 
 /**
  * @brief   Acquire exclusive access to the NIB
+ *
+ * Since the caller may change the NIB, this invalidates all entries of the
+ * route cache.
  */
 void _nib_acquire(void);
 
+/**
+ * @brief   Acquire exclusive access to the NIB for a look-up only
+ *
+ * In contrast to @ref _nib_acquire(), this does not invalidate the route
+ * cache, so the caller must not change the NIB.
+ */
+void _nib_acquire_ro(void);
+
 /**
  * @brief   Release exclusive access to the NIB
  */
@@ -876,6 +888,66 @@ void _nib_ft_get(const _nib_offl_entry_t *dst, gnrc_ipv6_nib_ft_t *fte);
 int _nib_get_route(const ipv6_addr_t *dst, gnrc_pktsnip_t *pkt,
                    gnrc_ipv6_nib_ft_t *fte);
 
+#if (CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF > 0) || DOXYGEN
+/**
+ * @brief   Route cache entry
+ */
+typedef struct {
+    ipv6_addr_t dst;            /**< destination address */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER) || DOXYGEN
+    ipv6_addr_t route;          /**< prefix of the route taken to
+                                 *   _nib_rc_entry_t::dst */
+#endif
+    gnrc_ipv6_nib_nc_t nce;     /**< next hop to _nib_rc_entry_t::dst */
+    uint32_t gen;               /**< NIB generation the entry is valid for */
+    uint8_t iface;              /**< interface the look-up was restricted
+                                 *   to (0 for any) */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER) || DOXYGEN
+    uint8_t route_len;          /**< length of _nib_rc_entry_t::route.
+                                 *   Greater than @ref IPV6_ADDR_BIT_LEN
+                                 *   if _nib_rc_entry_t::dst is on-link */
+#endif
+} _nib_rc_entry_t;
+
+#if IS_USED(MODULE_NETSTATS_IPV6) || DOXYGEN
+/**
+ * @brief   Route cache statistics
+ */
+extern netstats_cache_t _nib_rc_stats;
+#endif
+
+/**
+ * @brief   Gets a valid route cache entry for a destination
+ *
+ * @pre `dst != NULL`
+ * @pre NIB is acquired, either by @ref _nib_acquire_ro() or @ref _nib_acquire()
+ *
+ * @param[in] dst   Destination address to look up.
+ * @param[in] iface Interface the look-up is restricted to. 0 for any.
+ *
+ * @return  The route cache entry for @p dst on @p iface.
+ * @return  NULL, if there is no valid entry.
+ */
+_nib_rc_entry_t *_nib_rc_get(const ipv6_addr_t *dst, unsigned iface);
+
+/**
+ * @brief   Adds a resolved next hop to the route cache
+ *
+ * The entry is valid until the next call of @ref _nib_acquire().
+ *
+ * @pre `(dst != NULL) && (nce != NULL)`
+ * @pre NIB is acquired
+ *
+ * @param[in] dst   Destination address.
+ * @param[in] iface Interface the look-up was restricted to. 0 for any.
+ * @param[in] nce   Next hop to @p dst.
+ * @param[in] route Route taken to @p dst. NULL if @p dst is on-link.
+ */
+void _nib_rc_add(const ipv6_addr_t *dst, unsigned iface,
+                 const gnrc_ipv6_nib_nc_t *nce,
+                 const gnrc_ipv6_nib_ft_t *route);
+#endif  /* CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF > 0 */
+
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_QUEUE_PKT) || DOXYGEN
 /**
  * @brief Flush the packet queue of a on-link neighbor.
@@ -296,6 +296,58 @@ static gnrc_netif_t *_acquire_new_iface(unsigned iface)
     return netif;
 }
 
+#if CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF > 0
+static inline bool _rc_cacheable(const gnrc_ipv6_nib_nc_t *nce)
+{
+    if (!IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)) {
+        return true;
+    }
+    /* entries in any other state need the address resolution state-machine
+     * to act when they are used */
+    switch (gnrc_ipv6_nib_nc_get_nud_state(nce)) {
+        case GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNMANAGED:
+        case GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static bool _get_next_hop_from_rc(const ipv6_addr_t *dst, gnrc_netif_t *netif,
+                                  gnrc_ipv6_nib_nc_t *nce)
+{
+    _nib_rc_entry_t *entry;
+
+    _nib_acquire_ro();
+    entry = _nib_rc_get(dst, netif ? netif->pid : 0);
+    if (entry != NULL) {
+        DEBUG("nib: %s found in route cache\n",
+              ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+        memcpy(nce, &entry->nce, sizeof(*nce));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER)
+        if (entry->route_len <= IPV6_ADDR_BIT_LEN) {
+            _call_route_info_cb(gnrc_netif_get_by_pid(gnrc_ipv6_nib_nc_get_iface(nce)),
+                                GNRC_IPV6_NIB_ROUTE_INFO_TYPE_RN,
+                                &entry->route,
+                                (void *)((intptr_t)entry->route_len));
+        }
+#endif
+    }
+    _nib_release();
+    return (entry != NULL);
+}
+
+#if IS_USED(MODULE_NETSTATS_IPV6)
+void gnrc_ipv6_nib_route_cache_stats(netstats_cache_t *stats)
+{
+    assert(stats != NULL);
+    _nib_acquire_ro();
+    memcpy(stats, &_nib_rc_stats, sizeof(*stats));
+    _nib_release();
+}
+#endif
+#endif  /* CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF > 0 */
+
 int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
                                       gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
                                       gnrc_ipv6_nib_nc_t *nce)
@@ -306,6 +358,14 @@ int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
           ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)),
           netif ? (unsigned)netif->pid : 0);
 
+#if CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF > 0
+    if (_get_next_hop_from_rc(dst, netif, nce)) {
+        return 0;
+    }
+    /* the requested interface might be replaced during the look-up */
+    unsigned rc_iface = netif ? netif->pid : 0;
+#endif
+
     gnrc_netif_acquire(netif);
     _nib_acquire();
 
@@ -340,6 +400,11 @@ int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
             }
             res = -EHOSTUNREACH;
         }
+#if CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF > 0
+        else if (_rc_cacheable(nce)) {
+            _nib_rc_add(dst, rc_iface, nce, NULL);
+        }
+#endif
         goto out;
     }
 
@@ -392,6 +457,11 @@ int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_DC)
         _nib_dc_add(&route.next_hop, netif->pid, dst);
 #endif  /* CONFIG_GNRC_IPV6_NIB_DC */
+#if CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF > 0
+        if (_rc_cacheable(nce)) {
+            _nib_rc_add(dst, rc_iface, nce, &route);
+        }
+#endif
     }
     else {
         /* _resolve_addr releases pkt if not queued (in which case
@@ -96,7 +96,7 @@ bool gnrc_ipv6_nib_nc_iter(unsigned iface, void **state,
 {
     _nib_onl_entry_t *node = *state;
 
-    _nib_acquire();
+    _nib_acquire_ro();
     while ((node = _nib_onl_iter(node)) != NULL) {
         if ((node->mode & _NC) &&
             ((iface == 0) || (_nib_onl_get_if(node) == iface))) {
@@ -125,7 +125,7 @@ bool gnrc_ipv6_nib_pl_iter(unsigned iface, void **state,
 {
     _nib_offl_entry_t *dst = *state;
 
-    _nib_acquire();
+    _nib_acquire_ro();
     while ((dst = _nib_offl_iter(dst)) != NULL) {
         const _nib_onl_entry_t *node = dst->next_hop;
         if ((node != NULL) && (dst->mode & _PL) &&
@@ -96,6 +96,14 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_lookup_id(uint8_t id)
     return NULL;
 }
 
+const gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_lookup_id_decomp(uint8_t id)
+{
+    if ((id >= GNRC_SIXLOWPAN_CTX_SIZE) || (_ctxs[id].prefix_len == 0)) {
+        return NULL;
+    }
+    return &_ctxs[id];
+}
+
 gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_update(uint8_t id, const ipv6_addr_t *prefix,
                                                 uint8_t prefix_len, uint16_t ltime,
                                                 bool comp)
@@ -32,7 +32,6 @@
 #include "net/sixlowpan/sfr.h"
 #include "thread.h"
 #include "xtimer.h"
-#include "utlist.h"
 
 #include "net/gnrc/sixlowpan/frag/rb.h"
 
@@ -63,6 +62,21 @@ static gnrc_sixlowpan_frag_rb_int_t rbuf_int[RBUF_INT_SIZE];
 
 static gnrc_sixlowpan_frag_rb_t rbuf[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
 
+static_assert(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE < UINT8_MAX,
+              "reassembly buffer too large for index");
+static_assert(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE > 0,
+              "reassembly buffer index needs at least one bucket");
+
+/* Look-up index of the reassembly buffer: all values are an index into `rbuf`
+ * + 1, so 0 marks the end of a chain or an unlinked entry. An
+ * entry stays linked into the bucket of its tuple after removal, until it is
+ * reused. */
+static uint8_t _rbuf_buckets[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE];
+static uint8_t _rbuf_chain[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+static uint8_t _rbuf_bucket_of[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+/* interval to start the search for a free interval at */
+static unsigned _rbuf_int_next;
+
 static char l2addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
 
 static xtimer_t _gc_timer;
@@ -110,8 +124,93 @@ static int _forward_uncomp(gnrc_pktsnip_t *pkt,
                            unsigned page);
 static int _rbuf_resize_for_reassembly(gnrc_sixlowpan_frag_rb_t *rbuf);
 
+static inline void _rbuf_stats_drop(void)
+{
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
+    gnrc_sixlowpan_frag_stats_get()->rbuf_drops++;
+#endif
+}
+
+static unsigned _rbuf_hash(const uint8_t *src, size_t src_len,
+                           const uint8_t *dst, size_t dst_len,
+                           uint16_t tag)
+{
+    if (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE == 1) {
+        return 0;
+    }
+    /* FNV-1a over the tuple, the datagram size is not part of it since not
+     * all fragments carry it with SFR */
+    uint32_t hash = 2166136261U ^ tag;
+
+    for (unsigned i = 0; i < src_len; i++) {
+        hash = (hash ^ src[i]) * 16777619U;
+    }
+    for (unsigned i = 0; i < dst_len; i++) {
+        hash = (hash ^ dst[i]) * 16777619U;
+    }
+    return hash % CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE;
+}
+
+static void _rbuf_idx_unlink(unsigned idx)
+{
+    if (_rbuf_bucket_of[idx] == 0) {
+        return;
+    }
+    uint8_t *ptr = &_rbuf_buckets[_rbuf_bucket_of[idx] - 1];
+
+    while (*ptr != (idx + 1)) {
+        assert(*ptr != 0);
+        ptr = &_rbuf_chain[*ptr - 1];
+    }
+    *ptr = _rbuf_chain[idx];
+    _rbuf_chain[idx] = 0;
+    _rbuf_bucket_of[idx] = 0;
+}
+
+static void _rbuf_idx_link(unsigned idx)
+{
+    const gnrc_sixlowpan_frag_rb_base_t *e = &rbuf[idx].super;
+    unsigned bucket = _rbuf_hash(e->src, e->src_len, e->dst, e->dst_len,
+                                 e->tag);
+
+    _rbuf_idx_unlink(idx);
+    _rbuf_chain[idx] = _rbuf_buckets[bucket];
+    _rbuf_buckets[bucket] = idx + 1;
+    _rbuf_bucket_of[idx] = bucket + 1;
+}
+
+/* finds the entry in use for a tuple, the datagram size is only compared
+ * if match_size is true */
+static gnrc_sixlowpan_frag_rb_t *_rbuf_idx_find(const uint8_t *src,
+                                                size_t src_len,
+                                                const uint8_t *dst,
+                                                size_t dst_len,
+                                                bool match_size, size_t size,
+                                                uint16_t tag)
+{
+    unsigned bucket = _rbuf_hash(src, src_len, dst, dst_len, tag);
+
+    for (unsigned i = _rbuf_buckets[bucket]; i != 0; i = _rbuf_chain[i - 1]) {
+        gnrc_sixlowpan_frag_rb_t *e = &rbuf[i - 1];
+
+        if ((e->pkt != NULL) && (e->super.tag == tag) &&
+            (!match_size || (e->super.datagram_size == size)) &&
+            (e->super.src_len == src_len) &&
+            (e->super.dst_len == dst_len) &&
+            (memcmp(e->super.src, src, src_len) == 0) &&
+            (memcmp(e->super.dst, dst, dst_len) == 0)) {
+            return e;
+        }
+    }
+    return NULL;
+}
+
+/* the intervals of a reassembly buffer entry are sorted by descending start
+ * and do not overlap, so the check can stop at the first interval that ends
+ * before the fragment. This does not apply to VRB entries, which may carry
+ * intervals appended from a reassembly buffer entry. */
 static int _check_fragments(gnrc_sixlowpan_frag_rb_base_t *entry,
-                            size_t frag_size, size_t offset)
+                            size_t frag_size, size_t offset, bool sorted)
 {
     gnrc_sixlowpan_frag_rb_int_t *ptr = entry->ints;
 
@@ -119,6 +218,9 @@ static int _check_fragments(gnrc_sixlowpan_frag_rb_base_t *entry,
      * or the offset of the overlapped fragment, discards the datagram
      * https://tools.ietf.org/html/rfc4944#section-5.3 */
     while (ptr != NULL) {
+        if (sorted && (ptr->end < offset)) {
+            break;
+        }
         if (_rbuf_int_overlap_partially(ptr, offset, offset + frag_size - 1)) {
 
             /* "A fresh reassembly may be commenced with the most recently
@@ -186,21 +288,9 @@ static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_
     assert(netif_hdr != NULL);
     const uint8_t *src = gnrc_netif_hdr_get_src_addr(netif_hdr);
     const uint8_t *dst = gnrc_netif_hdr_get_dst_addr(netif_hdr);
-    const uint8_t src_len = netif_hdr->src_l2addr_len;
-    const uint8_t dst_len = netif_hdr->dst_l2addr_len;
-
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        gnrc_sixlowpan_frag_rb_t *e = &rbuf[i];
 
-        if ((e->pkt != NULL) && (e->super.tag == tag) &&
-            (e->super.src_len == src_len) &&
-            (e->super.dst_len == dst_len) &&
-            (memcmp(e->super.src, src, src_len) == 0) &&
-            (memcmp(e->super.dst, dst, dst_len) == 0)) {
-            return e;
-        }
-    }
-    return NULL;
+    return _rbuf_idx_find(src, netif_hdr->src_l2addr_len,
+                          dst, netif_hdr->dst_l2addr_len, false, 0, tag);
 }
 
 #ifndef NDEBUG
@@ -347,7 +437,7 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
         (entry.vrb = gnrc_sixlowpan_frag_vrb_get(src, netif_hdr->src_l2addr_len,
                                                  datagram_tag)) != NULL) {
         DEBUG("6lo rbuf minfwd: VRB entry found, trying to forward\n");
-        switch (_check_fragments(entry.super, frag_size, offset)) {
+        switch (_check_fragments(entry.super, frag_size, offset, false)) {
             case RBUF_ADD_REPEAT:
                 DEBUG("6lo rbuf minfwd: overlap found; dropping VRB\n");
                 gnrc_sixlowpan_frag_vrb_rm(entry.vrb);
@@ -387,15 +477,17 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
 #endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) */
     if ((offset + frag_size) > entry.super->datagram_size) {
         DEBUG("6lo rfrag: fragment too big for resulting datagram, discarding datagram\n");
+        _rbuf_stats_drop();
         gnrc_pktbuf_release(entry.rbuf->pkt);
         gnrc_pktbuf_release(pkt);
         gnrc_sixlowpan_frag_rb_remove(entry.rbuf);
         return RBUF_ADD_ERROR;
     }
 
-    switch (_check_fragments(entry.super, frag_size, offset)) {
+    switch (_check_fragments(entry.super, frag_size, offset, true)) {
         case RBUF_ADD_REPEAT:
             DEBUG("6lo rfrag: overlapping intervals, discarding datagram\n");
+            _rbuf_stats_drop();
             gnrc_pktbuf_release(entry.rbuf->pkt);
             gnrc_sixlowpan_frag_rb_remove(entry.rbuf);
             return RBUF_ADD_REPEAT;
@@ -418,6 +510,7 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
                 if (frag_hdr == NULL) {
                     DEBUG("6lo rbuf: unable to mark fragment header. "
                           "aborting reassembly.\n");
+                    _rbuf_stats_drop();
                     gnrc_pktbuf_release(entry.rbuf->pkt);
                     gnrc_pktbuf_release(pkt);
                     gnrc_sixlowpan_frag_rb_remove(entry.rbuf);
@@ -429,6 +522,7 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
                     gnrc_sixlowpan_iphc_recv(pkt, entry.rbuf, 0);
                     /* check if entry was deleted in IPHC (error case) */
                     if (gnrc_sixlowpan_frag_rb_entry_empty(entry.rbuf)) {
+                        _rbuf_stats_drop();
                         res = RBUF_ADD_ERROR;
                     }
                     return res;
@@ -469,6 +563,7 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
                            "6lo rfrag: fragment too big for resulting datagram, "
                            "discarding datagram\n"
                         );
+                        _rbuf_stats_drop();
                         gnrc_pktbuf_release(entry.rbuf->pkt);
                         gnrc_pktbuf_release(pkt);
                         gnrc_sixlowpan_frag_rb_remove(entry.rbuf);
@@ -495,6 +590,7 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
     }
     else {
         /* no space left in rbuf interval buffer*/
+        _rbuf_stats_drop();
         gnrc_pktbuf_release(entry.rbuf->pkt);
         gnrc_sixlowpan_frag_rb_remove(entry.rbuf);
         res = RBUF_ADD_ERROR;
@@ -514,7 +610,12 @@ static inline bool _rbuf_int_overlap_partially(gnrc_sixlowpan_frag_rb_int_t *i,
 
 static gnrc_sixlowpan_frag_rb_int_t *_rbuf_int_get_free(void)
 {
-    for (unsigned int i = 0; i < RBUF_INT_SIZE; i++) {
+    /* continue after the last allocated interval, as the intervals before it
+     * are likely still in use */
+    for (unsigned int n = 0; n < RBUF_INT_SIZE; n++) {
+        unsigned int i = _rbuf_int_next;
+
+        _rbuf_int_next = (_rbuf_int_next + 1) % RBUF_INT_SIZE;
         if (rbuf_int[i].end == 0) { /* start must be smaller than end anyways*/
             return rbuf_int + i;
         }
@@ -541,6 +642,8 @@ static bool _rbuf_update_ints(gnrc_sixlowpan_frag_rb_base_t *entry,
     gnrc_sixlowpan_frag_rb_int_t *new;
     uint16_t end = (uint16_t)(offset + frag_size - 1);
 
+    gnrc_sixlowpan_frag_rb_int_t **ptr = &entry->ints;
+
     new = _rbuf_int_get_free();
 
     if (new == NULL) {
@@ -560,7 +663,13 @@ static bool _rbuf_update_ints(gnrc_sixlowpan_frag_rb_base_t *entry,
                                                   l2addr_str),
           entry->datagram_size, entry->tag);
 
-    LL_PREPEND(entry->ints, new);
+    /* keep intervals sorted by descending start, for in-order fragments this
+     * is the head of the list */
+    while ((*ptr != NULL) && ((*ptr)->start > offset)) {
+        ptr = &(*ptr)->next;
+    }
+    new->next = *ptr;
+    *ptr = new;
 
     return true;
 }
@@ -597,6 +706,15 @@ void gnrc_sixlowpan_frag_rb_gc(void)
                                          l2addr_str),
                   (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
+#if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0
+            /* completed datagrams scheduled for deletion did not time out */
+            if (rbuf[i].super.current_size > 0)
+#endif
+            {
+                gnrc_sixlowpan_frag_stats_get()->rbuf_timeouts++;
+            }
+#endif
             _gc_pkt(&rbuf[i]);
             gnrc_sixlowpan_frag_rb_remove(&(rbuf[i]));
         }
@@ -620,41 +738,34 @@ static int _rbuf_get(const void *src, size_t src_len,
     gnrc_sixlowpan_frag_rb_t *res = NULL, *oldest = NULL;
     uint32_t now_usec = xtimer_now_usec();
 
-    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        /* check first if entry already available */
-        if ((rbuf[i].pkt != NULL) && (rbuf[i].super.tag == tag) &&
-            ((IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
-              /* not all SFR fragments carry the datagram size, so make 0 a
-               * legal value to not compare datagram size */
-              ((size == 0) || (rbuf[i].super.datagram_size == size))) ||
-             (!IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
-              (rbuf[i].super.datagram_size == size))) &&
-            (rbuf[i].super.src_len == src_len) &&
-            (rbuf[i].super.dst_len == dst_len) &&
-            (memcmp(rbuf[i].super.src, src, src_len) == 0) &&
-            (memcmp(rbuf[i].super.dst, dst, dst_len) == 0)) {
-            DEBUG("6lo rfrag: entry %p (%s, ", (void *)(&rbuf[i]),
-                  gnrc_netif_addr_to_str(rbuf[i].super.src,
-                                         rbuf[i].super.src_len,
-                                         l2addr_str));
-            DEBUG("%s, %u, %u) found\n",
-                  gnrc_netif_addr_to_str(rbuf[i].super.dst,
-                                         rbuf[i].super.dst_len,
-                                         l2addr_str),
-                  (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
+    /* check first if entry already available. Not all SFR fragments carry
+     * the datagram size, so make 0 a legal value to not compare datagram
+     * size */
+    res = _rbuf_idx_find(src, src_len, dst, dst_len,
+                         !IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) || (size != 0),
+                         size, tag);
+    if (res != NULL) {
+        DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
+              gnrc_netif_addr_to_str(res->super.src, res->super.src_len,
+                                     l2addr_str));
+        DEBUG("%s, %u, %u) found\n",
+              gnrc_netif_addr_to_str(res->super.dst, res->super.dst_len,
+                                     l2addr_str),
+              (unsigned)res->super.datagram_size, res->super.tag);
 #if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0
-            if (rbuf[i].super.current_size == 0) {
-                /* ensure that only empty reassembly buffer entries and entries
-                 * scheduled for deletion have `current_size == 0` */
-                DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
-                return -1;
-            }
-#endif
-            rbuf[i].super.arrival = now_usec;
-            _set_rbuf_timeout();
-            return i;
+        if (res->super.current_size == 0) {
+            /* ensure that only empty reassembly buffer entries and entries
+             * scheduled for deletion have `current_size == 0` */
+            DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
+            return -1;
         }
+#endif
+        res->super.arrival = now_usec;
+        _set_rbuf_timeout();
+        return res - &(rbuf[0]);
+    }
 
+    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         /* if there is a free spot: remember it */
         if ((res == NULL) && gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i])) {
             res = &(rbuf[i]);
@@ -746,6 +857,10 @@ static int _rbuf_get(const void *src, size_t src_len,
     res->offset_diff = 0U;
     memset(res->received, 0U, sizeof(res->received));
 #endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) */
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
+    res->created = now_usec;
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS) */
+    _rbuf_idx_link(res - &(rbuf[0]));
 
     DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
           gnrc_netif_addr_to_str(res->super.src, res->super.src_len,
@@ -772,6 +887,10 @@ void gnrc_sixlowpan_frag_rb_reset(void)
         }
     }
     memset(rbuf, 0, sizeof(rbuf));
+    memset(_rbuf_buckets, 0, sizeof(_rbuf_buckets));
+    memset(_rbuf_chain, 0, sizeof(_rbuf_chain));
+    memset(_rbuf_bucket_of, 0, sizeof(_rbuf_bucket_of));
+    _rbuf_int_next = 0;
 }
 
 const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void)
@@ -857,8 +976,15 @@ int gnrc_sixlowpan_frag_rb_dispatch_when_complete(gnrc_sixlowpan_frag_rb_t *rbuf
         new_netif_hdr->rssi = netif_hdr->rssi;
         rbuf->pkt = gnrc_pkt_append(rbuf->pkt, netif);
 #if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
-        gnrc_sixlowpan_frag_stats_get()->fragments += _count_frags(rbuf);
-        gnrc_sixlowpan_frag_stats_get()->datagrams++;
+        gnrc_sixlowpan_frag_stats_t *stats = gnrc_sixlowpan_frag_stats_get();
+        uint32_t reass_time = xtimer_now_usec() - rbuf->created;
+
+        stats->fragments += _count_frags(rbuf);
+        stats->datagrams++;
+        stats->reass_time_sum += reass_time;
+        if (reass_time > stats->reass_time_max) {
+            stats->reass_time_max = reass_time;
+        }
 #endif
         gnrc_sixlowpan_dispatch_recv(rbuf->pkt, NULL, 0);
         _tmp_rm(rbuf);
@@ -953,6 +1079,7 @@ static int _rbuf_resize_for_reassembly(gnrc_sixlowpan_frag_rb_t *rbuf)
     if (gnrc_pktbuf_realloc_data(rbuf->pkt,
                                  rbuf->super.datagram_size) != 0) {
         DEBUG("6lo rbuf minfwd: can't allocate packet data\n");
+        _rbuf_stats_drop();
         gnrc_pktbuf_release(rbuf->pkt);
         gnrc_sixlowpan_frag_rb_remove(rbuf);
         return RBUF_ADD_ERROR;
@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief   Link-quality adaptive congestion control for SFR
+ */
+
+#include "kernel_defines.h"
+#include "congure.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/sixlowpan/config.h"
+#include "net/gnrc/sixlowpan/frag/fb.h"
+#include "net/netstats/neighbor.h"
+
+#include "net/gnrc/sixlowpan/frag/sfr/congure.h"
+
+/* This extends the simple SFR of
+ * https://datatracker.ietf.org/doc/html/rfc8931#appendix-C
+ * by deriving the upper bound of the window and the inter-frame gap for each
+ * datagram from the link metrics to its next hop:
+ *
+ * - the window is OptWindowSize divided by the ETX of the link and
+ * - the inter-frame gap is InterFrameGap multiplied by the ETX of the link.
+ *
+ * Links with an average RSSI weaker than
+ * CONFIG_GNRC_SIXLOWPAN_SFR_LQ_RSSI_WEAK halve the window and double the
+ * inter-frame gap once more. After a window was halved due to a timeout, the
+ * window grows by one fragment per acknowledged fragment up to that bound. */
+
+typedef struct {
+    congure_snd_t super;    /**< CongURE state object parent */
+    uint32_t inter_frame_gap;   /**< inter-frame gap for the next hop in usec */
+    uint8_t max_cwnd;       /**< upper bound of the window for the next hop */
+} congure_lq_snd_t;
+
+static void _snd_init(congure_snd_t *cong, void *ctx);
+static int32_t _snd_inter_msg_interval(congure_snd_t *cong, unsigned msg_size);
+static void _snd_report_msg_sent(congure_snd_t *cong, unsigned sent_size);
+static void _snd_report_msg_discarded(congure_snd_t *cong, unsigned msg_size);
+static void _snd_report_msgs_lost(congure_snd_t *cong, congure_snd_msg_t *msgs);
+static void _snd_report_msgs_timeout(congure_snd_t *cong, congure_snd_msg_t *msgs);
+static void _snd_report_msg_acked(congure_snd_t *cong, congure_snd_msg_t *msg,
+                                  congure_snd_ack_t *ack);
+static void _snd_report_ecn_ce(congure_snd_t *cong, ztimer_now_t time);
+
+static congure_lq_snd_t _sfr_congures_lq[CONFIG_GNRC_SIXLOWPAN_FRAG_FB_SIZE];
+static const congure_snd_driver_t _driver = {
+    .init = _snd_init,
+    .inter_msg_interval = _snd_inter_msg_interval,
+    .report_msg_sent = _snd_report_msg_sent,
+    .report_msg_discarded = _snd_report_msg_discarded,
+    .report_msgs_timeout = _snd_report_msgs_timeout,
+    .report_msgs_lost = _snd_report_msgs_lost,
+    .report_msg_acked = _snd_report_msg_acked,
+    .report_ecn_ce = _snd_report_ecn_ce,
+};
+
+congure_snd_t *gnrc_sixlowpan_frag_sfr_congure_snd_get(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_sfr_congures_lq); i++) {
+        if (_sfr_congures_lq[i].super.driver == NULL) {
+            _sfr_congures_lq[i].super.driver = &_driver;
+            return &_sfr_congures_lq[i].super;
+        }
+    }
+    return NULL;
+}
+
+static bool _get_nb_stats(gnrc_sixlowpan_frag_fb_t *fb, netstats_nb_t *stats)
+{
+    gnrc_netif_hdr_t *netif_hdr;
+    gnrc_netif_t *netif;
+
+    if ((fb == NULL) || (fb->pkt == NULL) ||
+        (fb->pkt->type != GNRC_NETTYPE_NETIF)) {
+        return false;
+    }
+    netif_hdr = fb->pkt->data;
+    netif = gnrc_netif_hdr_get_netif(netif_hdr);
+    if ((netif == NULL) || (netif_hdr->dst_l2addr_len == 0) ||
+        (netif_hdr->flags & (GNRC_NETIF_HDR_FLAGS_BROADCAST |
+                             GNRC_NETIF_HDR_FLAGS_MULTICAST))) {
+        return false;
+    }
+    return netstats_nb_get(&netif->netif,
+                           gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                           netif_hdr->dst_l2addr_len, stats) &&
+           netstats_nb_isfresh(&netif->netif, stats);
+}
+
+static void _snd_init(congure_snd_t *cong, void *ctx)
+{
+    congure_lq_snd_t *c = container_of(cong, congure_lq_snd_t, super);
+    netstats_nb_t stats;
+    unsigned max_cwnd = CONFIG_GNRC_SIXLOWPAN_SFR_OPT_WIN_SIZE;
+    uint32_t inter_frame_gap = CONFIG_GNRC_SIXLOWPAN_SFR_INTER_FRAME_GAP_US;
+
+    if (_get_nb_stats(ctx, &stats)) {
+        /* ETX is a fixed point number with NETSTATS_NB_ETX_DIVISOR as 1 */
+        unsigned etx = (stats.etx > NETSTATS_NB_ETX_DIVISOR)
+                     ? stats.etx : NETSTATS_NB_ETX_DIVISOR;
+
+        max_cwnd = (max_cwnd * NETSTATS_NB_ETX_DIVISOR) / etx;
+        inter_frame_gap = (inter_frame_gap * etx) / NETSTATS_NB_ETX_DIVISOR;
+        /* gnrc_netif records the RSSI in dBm truncated to 8 bit, so take the
+         * absolute value of the signed interpretation. It is 0 if nothing was
+         * received from the neighbor yet. */
+        int8_t rssi = (int8_t)stats.rssi;
+        unsigned rssi_abs = (rssi < 0) ? (unsigned)-rssi : (unsigned)rssi;
+
+        if (rssi_abs > CONFIG_GNRC_SIXLOWPAN_SFR_LQ_RSSI_WEAK) {
+            max_cwnd /= 2U;
+            inter_frame_gap *= 2U;
+        }
+    }
+    if (max_cwnd < CONFIG_GNRC_SIXLOWPAN_SFR_MIN_WIN_SIZE) {
+        max_cwnd = CONFIG_GNRC_SIXLOWPAN_SFR_MIN_WIN_SIZE;
+    }
+    if (max_cwnd > CONFIG_GNRC_SIXLOWPAN_SFR_MAX_WIN_SIZE) {
+        max_cwnd = CONFIG_GNRC_SIXLOWPAN_SFR_MAX_WIN_SIZE;
+    }
+    c->max_cwnd = max_cwnd;
+    c->inter_frame_gap = inter_frame_gap;
+    cong->cwnd = max_cwnd;
+}
+
+static int32_t _snd_inter_msg_interval(congure_snd_t *cong, unsigned msg_size)
+{
+    congure_lq_snd_t *c = container_of(cong, congure_lq_snd_t, super);
+
+    (void)msg_size;
+    return c->inter_frame_gap;
+}
+
+static void _snd_report_msg_sent(congure_snd_t *cong, unsigned sent_size)
+{
+    (void)cong;
+    (void)sent_size;
+}
+
+static void _snd_report_msg_discarded(congure_snd_t *cong, unsigned msg_size)
+{
+    (void)cong;
+    (void)msg_size;
+}
+
+static void _snd_report_msgs_lost(congure_snd_t *cong, congure_snd_msg_t *msgs)
+{
+    /* Appendix C defines loss as timeout, so this does nothing */
+    (void)cong;
+    (void)msgs;
+}
+
+static void _snd_report_msgs_timeout(congure_snd_t *cong,
+                                     congure_snd_msg_t *msgs)
+{
+    (void)msgs;
+    cong->cwnd /= 2U;
+    if (cong->cwnd < CONFIG_GNRC_SIXLOWPAN_SFR_MIN_WIN_SIZE) {
+        cong->cwnd = CONFIG_GNRC_SIXLOWPAN_SFR_MIN_WIN_SIZE;
+    }
+}
+
+static void _snd_report_msg_acked(congure_snd_t *cong, congure_snd_msg_t *msg,
+                                  congure_snd_ack_t *ack)
+{
+    congure_lq_snd_t *c = container_of(cong, congure_lq_snd_t, super);
+
+    (void)msg;
+    (void)ack;
+    if (cong->cwnd < c->max_cwnd) {
+        cong->cwnd++;
+    }
+}
+
+static void _snd_report_ecn_ce(congure_snd_t *cong, ztimer_now_t time)
+{
+    (void)time;
+    if (cong->cwnd > CONFIG_GNRC_SIXLOWPAN_SFR_MIN_WIN_SIZE) {
+        cong->cwnd--;
+    }
+}
+
+/** @} */
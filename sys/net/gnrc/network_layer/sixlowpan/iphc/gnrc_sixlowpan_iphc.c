@@ -115,6 +115,53 @@
 
 #define SIXLOWPAN_IPHC_PREFIX_LEN   (64)    /**< minimum prefix length for IPHC */
 
+/* sources of the prefix of a compressed unicast address */
+#define IPHC_ADDR_PREFIX_INLINE     (0U)    /* in-line with the IID */
+#define IPHC_ADDR_PREFIX_LL         (1U)    /* link-local prefix */
+#define IPHC_ADDR_PREFIX_CTX        (2U)    /* prefix of a context */
+#define IPHC_ADDR_PREFIX_UNSPEC     (3U)    /* unspecified (or reserved) */
+
+/**
+ * @brief   Decompression rule for a unicast address
+ */
+typedef struct {
+    uint8_t prefix;     /**< source of the prefix (IPHC_ADDR_PREFIX_*) */
+    uint8_t inline_len; /**< number of in-line bytes */
+} _iphc_ucast_mode_t;
+
+/* unicast address decompression rules, indexed by SAC/SAM (shifted by 4) for
+ * the source and by DAC/DAM for a unicast destination address. Unless the
+ * address is unspecified, the IID of an address without in-line bytes is
+ * derived from the link-layer address. The unspecified address is only valid
+ * for the source, DAC=1/DAM=00 is reserved for the destination. */
+static const _iphc_ucast_mode_t _iphc_ucast_modes[] = {
+    { IPHC_ADDR_PREFIX_INLINE, sizeof(ipv6_addr_t) },
+    { IPHC_ADDR_PREFIX_LL, sizeof(eui64_t) },
+    { IPHC_ADDR_PREFIX_LL, sizeof(network_uint16_t) },
+    { IPHC_ADDR_PREFIX_LL, 0 },
+    { IPHC_ADDR_PREFIX_UNSPEC, 0 },
+    { IPHC_ADDR_PREFIX_CTX, sizeof(eui64_t) },
+    { IPHC_ADDR_PREFIX_CTX, sizeof(network_uint16_t) },
+    { IPHC_ADDR_PREFIX_CTX, 0 },
+};
+
+/* hop limit, indexed by HL */
+static const uint8_t _iphc_hl[] = {
+    [IPHC_HL_1] = 1, [IPHC_HL_64] = 64, [IPHC_HL_255] = 255,
+};
+
+/* protocol numbers of the extension headers, indexed by NHC EID */
+static const uint8_t _iphc_nhc_ext_protnum[] = {
+    [NHC_IPV6_EXT_EID_HOPOPT >> 1] = PROTNUM_IPV6_EXT_HOPOPT,
+    [NHC_IPV6_EXT_EID_RH >> 1] = PROTNUM_IPV6_EXT_RH,
+    [NHC_IPV6_EXT_EID_FRAG >> 1] = PROTNUM_IPV6_EXT_FRAG,
+    [NHC_IPV6_EXT_EID_DST >> 1] = PROTNUM_IPV6_EXT_DST,
+    [NHC_IPV6_EXT_EID_MOB >> 1] = PROTNUM_IPV6_EXT_MOB,
+    [0x05] = PROTNUM_RESERVED,
+    [0x06] = PROTNUM_RESERVED,
+    [NHC_IPV6_EXT_EID_IPV6 >> 1] = PROTNUM_RESERVED,
+};
+
 /* currently only used with forwarding output, remove guard if more debug info
  * is added */
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
@@ -165,14 +212,76 @@ static int _forward_frag(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *frag_hdr,
                          gnrc_sixlowpan_frag_vrb_t *vrbe, unsigned page);
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
 
+/**
+ * @brief   Decompresses a unicast address
+ *
+ * @param[out] addr         The address to decompress to. Must be zeroed.
+ * @param[in] mode          The SAC/SAM (shifted by 4) or DAC/DAM bits of the
+ *                          address
+ * @param[in] ctx           The context of the address. May be NULL if @p mode
+ *                          is stateless.
+ * @param[in] inline_data   The in-line bytes of the address
+ * @param[in] iface         The interface the address was received on
+ * @param[in] l2addr        The link-layer address of the same node as @p addr
+ * @param[in] l2addr_len    Length of @p l2addr
+ *
+ * @return  Number of in-line bytes of the address on success.
+ * @return  -1, if the IID could not be derived from @p l2addr.
+ */
+static int _iphc_ucast_decode(ipv6_addr_t *addr, uint8_t mode,
+                              const gnrc_sixlowpan_ctx_t *ctx,
+                              const uint8_t *inline_data,
+                              const gnrc_netif_t *iface,
+                              const uint8_t *l2addr, uint8_t l2addr_len)
+{
+    const _iphc_ucast_mode_t *rule = &_iphc_ucast_modes[mode];
+
+    switch (rule->inline_len) {
+        case sizeof(ipv6_addr_t):
+            memcpy(addr, inline_data, sizeof(ipv6_addr_t));
+            break;
+        case sizeof(eui64_t):
+            memcpy(&addr->u64[1], inline_data, sizeof(eui64_t));
+            break;
+        case sizeof(network_uint16_t):
+            addr->u32[2] = byteorder_htonl(0x000000ff);
+            addr->u16[6] = byteorder_htons(0xfe00);
+            memcpy(&addr->u16[7], inline_data, sizeof(network_uint16_t));
+            break;
+        default:
+            if ((rule->prefix != IPHC_ADDR_PREFIX_UNSPEC) &&
+                (gnrc_netif_ipv6_iid_from_addr(iface, l2addr, l2addr_len,
+                                               (eui64_t *)&addr->u64[1]) < 0)) {
+                return -1;
+            }
+            break;
+    }
+    switch (rule->prefix) {
+        case IPHC_ADDR_PREFIX_LL:
+            ipv6_addr_set_link_local_prefix(addr);
+            break;
+        case IPHC_ADDR_PREFIX_CTX:
+            assert(ctx != NULL);
+            ipv6_addr_init_prefix(addr, &ctx->prefix, ctx->prefix_len);
+            break;
+        default:
+            /* in-line or unspecified */
+            break;
+    }
+    return rule->inline_len;
+}
+
 static size_t _iphc_ipv6_decode(const uint8_t *iphc_hdr,
                                 const gnrc_netif_hdr_t *netif_hdr,
                                 gnrc_netif_t *iface, ipv6_hdr_t *ipv6_hdr)
 {
-    gnrc_sixlowpan_ctx_t *ctx = NULL;
+    const gnrc_sixlowpan_ctx_t *ctx = NULL;
+    const uint8_t iphc1 = iphc_hdr[IPHC1_IDX];
+    const uint8_t iphc2 = iphc_hdr[IPHC2_IDX];
     size_t payload_offset = SIXLOWPAN_IPHC_HDR_LEN;
+    int res;
 
-    if (iphc_hdr[IPHC2_IDX] & SIXLOWPAN_IPHC2_CID_EXT) {
+    if (iphc2 & SIXLOWPAN_IPHC2_CID_EXT) {
         payload_offset++;
     }
 
@@ -181,7 +290,7 @@ static size_t _iphc_ipv6_decode(const uint8_t *iphc_hdr,
     memset(ipv6_hdr, 0, sizeof(*ipv6_hdr));
     ipv6_hdr_set_version(ipv6_hdr);
 
-    switch (iphc_hdr[IPHC1_IDX] & SIXLOWPAN_IPHC1_TF) {
+    switch (iphc1 & SIXLOWPAN_IPHC1_TF) {
         case IPHC_TF_ECN_DSCP_FL:
             ipv6_hdr_set_tc(ipv6_hdr, iphc_hdr[payload_offset++]);
             ipv6_hdr->v_tc_fl.u8[1] |= iphc_hdr[payload_offset++] & 0x0f;
@@ -191,7 +300,6 @@ static size_t _iphc_ipv6_decode(const uint8_t *iphc_hdr,
 
         case IPHC_TF_ECN_FL:
             ipv6_hdr_set_tc_ecn(ipv6_hdr, iphc_hdr[payload_offset] >> 6);
-            ipv6_hdr_set_tc_dscp(ipv6_hdr, 0);
             ipv6_hdr->v_tc_fl.u8[1] |= iphc_hdr[payload_offset++] & 0x0f;
             ipv6_hdr->v_tc_fl.u8[2] |= iphc_hdr[payload_offset++];
             ipv6_hdr->v_tc_fl.u8[3] |= iphc_hdr[payload_offset++];
@@ -199,204 +307,85 @@ static size_t _iphc_ipv6_decode(const uint8_t *iphc_hdr,
 
         case IPHC_TF_ECN_DSCP:
             ipv6_hdr_set_tc(ipv6_hdr, iphc_hdr[payload_offset++]);
-            ipv6_hdr_set_fl(ipv6_hdr, 0);
             break;
 
         case IPHC_TF_ECN_ELIDE:
-            ipv6_hdr_set_tc(ipv6_hdr, 0);
-            ipv6_hdr_set_fl(ipv6_hdr, 0);
+            /* already zeroed */
             break;
     }
 
-    if (!(iphc_hdr[IPHC1_IDX] & SIXLOWPAN_IPHC1_NH)) {
+    if (!(iphc1 & SIXLOWPAN_IPHC1_NH)) {
         ipv6_hdr->nh = iphc_hdr[payload_offset++];
     }
 
-    switch (iphc_hdr[IPHC1_IDX] & SIXLOWPAN_IPHC1_HL) {
-        case IPHC_HL_INLINE:
-            ipv6_hdr->hl = iphc_hdr[payload_offset++];
-            break;
-
-        case IPHC_HL_1:
-            ipv6_hdr->hl = 1;
-            break;
-
-        case IPHC_HL_64:
-            ipv6_hdr->hl = 64;
-            break;
-
-        case IPHC_HL_255:
-            ipv6_hdr->hl = 255;
-            break;
+    if ((iphc1 & SIXLOWPAN_IPHC1_HL) == IPHC_HL_INLINE) {
+        ipv6_hdr->hl = iphc_hdr[payload_offset++];
+    }
+    else {
+        ipv6_hdr->hl = _iphc_hl[iphc1 & SIXLOWPAN_IPHC1_HL];
     }
 
-    if (iphc_hdr[IPHC2_IDX] & SIXLOWPAN_IPHC2_SAC) {
-        uint8_t sci = 0;
-
-        if (iphc_hdr[IPHC2_IDX] & SIXLOWPAN_IPHC2_CID_EXT) {
-            sci = iphc_hdr[CID_EXT_IDX] >> 4;
-        }
-
-        if (iphc_hdr[IPHC2_IDX] & SIXLOWPAN_IPHC2_SAM) {
-            ctx = gnrc_sixlowpan_ctx_lookup_id(sci);
+    if ((iphc2 & SIXLOWPAN_IPHC2_SAC) && (iphc2 & SIXLOWPAN_IPHC2_SAM)) {
+        uint8_t sci = (iphc2 & SIXLOWPAN_IPHC2_CID_EXT)
+                    ? (iphc_hdr[CID_EXT_IDX] >> 4) : 0;
 
-            if (ctx == NULL) {
-                DEBUG("6lo iphc: could not find source context\n");
-                return 0;
-            }
+        if ((ctx = gnrc_sixlowpan_ctx_lookup_id_decomp(sci)) == NULL) {
+            DEBUG("6lo iphc: could not find source context\n");
+            return 0;
         }
     }
 
-    iface = gnrc_netif_hdr_get_netif(netif_hdr);
-    switch (iphc_hdr[IPHC2_IDX] & (SIXLOWPAN_IPHC2_SAC | SIXLOWPAN_IPHC2_SAM)) {
-
-        case IPHC_SAC_SAM_FULL:
-            /* take full 128 from inline */
-            memcpy(&(ipv6_hdr->src), iphc_hdr + payload_offset, 16);
-            payload_offset += 16;
-            break;
-
-        case IPHC_SAC_SAM_64:
-            ipv6_addr_set_link_local_prefix(&ipv6_hdr->src);
-            memcpy(ipv6_hdr->src.u8 + 8, iphc_hdr + payload_offset, 8);
-            payload_offset += 8;
-            break;
-
-        case IPHC_SAC_SAM_16:
-            ipv6_addr_set_link_local_prefix(&ipv6_hdr->src);
-            ipv6_hdr->src.u32[2] = byteorder_htonl(0x000000ff);
-            ipv6_hdr->src.u16[6] = byteorder_htons(0xfe00);
-            memcpy(ipv6_hdr->src.u8 + 14, iphc_hdr + payload_offset, 2);
-            payload_offset += 2;
-            break;
-
-        case IPHC_SAC_SAM_L2:
-            if (gnrc_netif_hdr_ipv6_iid_from_src(
-                        iface, netif_hdr, (eui64_t *)(&ipv6_hdr->src.u64[1])
-                    ) < 0) {
-                DEBUG("6lo iphc: could not get source's IID\n");
-                return 0;
-            }
-            ipv6_addr_set_link_local_prefix(&ipv6_hdr->src);
-            break;
-
-        case IPHC_SAC_SAM_UNSPEC:
-            ipv6_addr_set_unspecified(&ipv6_hdr->src);
-            break;
-
-        case IPHC_SAC_SAM_CTX_64:
-            assert(ctx != NULL);
-            memcpy(ipv6_hdr->src.u8 + 8, iphc_hdr + payload_offset, 8);
-            ipv6_addr_init_prefix(&ipv6_hdr->src, &ctx->prefix,
-                                  ctx->prefix_len);
-            payload_offset += 8;
-            break;
-
-        case IPHC_SAC_SAM_CTX_16:
-            assert(ctx != NULL);
-            ipv6_hdr->src.u32[2] = byteorder_htonl(0x000000ff);
-            ipv6_hdr->src.u16[6] = byteorder_htons(0xfe00);
-            memcpy(ipv6_hdr->src.u8 + 14, iphc_hdr + payload_offset, 2);
-            ipv6_addr_init_prefix(&ipv6_hdr->src, &ctx->prefix,
-                                  ctx->prefix_len);
-            payload_offset += 2;
-            break;
-
-        case IPHC_SAC_SAM_CTX_L2:
-            assert(ctx != NULL);
-            if (gnrc_netif_hdr_ipv6_iid_from_src(
-                        iface, netif_hdr, (eui64_t *)(&ipv6_hdr->src.u64[1])
-                    ) < 0) {
-                DEBUG("6lo iphc: could not get source's IID\n");
-                return 0;
-            }
-            ipv6_addr_init_prefix(&ipv6_hdr->src, &ctx->prefix,
-                                  ctx->prefix_len);
-            break;
+    res = _iphc_ucast_decode(&ipv6_hdr->src,
+                             (iphc2 & (SIXLOWPAN_IPHC2_SAC |
+                                       SIXLOWPAN_IPHC2_SAM)) >> 4,
+                             ctx, iphc_hdr + payload_offset, iface,
+                             gnrc_netif_hdr_get_src_addr(netif_hdr),
+                             netif_hdr->src_l2addr_len);
+    if (res < 0) {
+        DEBUG("6lo iphc: could not get source's IID\n");
+        return 0;
     }
+    payload_offset += res;
 
-    if (iphc_hdr[IPHC2_IDX] & SIXLOWPAN_IPHC2_DAC) {
-        uint8_t dci = 0;
+    if ((iphc2 & SIXLOWPAN_IPHC2_DAC) &&
+        (iphc2 & (SIXLOWPAN_IPHC2_M | SIXLOWPAN_IPHC2_DAM))) {
+        uint8_t dci = (iphc2 & SIXLOWPAN_IPHC2_CID_EXT)
+                    ? (iphc_hdr[CID_EXT_IDX] & 0x0f) : 0;
 
-        if (iphc_hdr[IPHC2_IDX] & SIXLOWPAN_IPHC2_CID_EXT) {
-            dci = iphc_hdr[CID_EXT_IDX] & 0x0f;
+        if ((ctx = gnrc_sixlowpan_ctx_lookup_id_decomp(dci)) == NULL) {
+            DEBUG("6lo iphc: could not find destination context\n");
+            return 0;
         }
+    }
 
-        if (iphc_hdr[IPHC2_IDX] & (SIXLOWPAN_IPHC2_M | SIXLOWPAN_IPHC2_DAM)) {
-            ctx = gnrc_sixlowpan_ctx_lookup_id(dci);
-
-            if (ctx == NULL) {
-                DEBUG("6lo iphc: could not find destination context\n");
-                return 0;
-            }
+    if (!(iphc2 & SIXLOWPAN_IPHC2_M)) {
+        if ((iphc2 & (SIXLOWPAN_IPHC2_DAC | SIXLOWPAN_IPHC2_DAM)) ==
+            IPHC_M_DAC_DAM_U_UNSPEC) {
+            DEBUG("6lo iphc: reserved M, DAC, DAM combination\n");
+            return 0;
+        }
+        res = _iphc_ucast_decode(&ipv6_hdr->dst,
+                                 iphc2 & (SIXLOWPAN_IPHC2_DAC |
+                                          SIXLOWPAN_IPHC2_DAM),
+                                 ctx, iphc_hdr + payload_offset, iface,
+                                 gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                                 netif_hdr->dst_l2addr_len);
+        if (res < 0) {
+            DEBUG("6lo iphc: could not get destination's IID\n");
+            return 0;
         }
+        return payload_offset + res;
     }
 
-    switch (iphc_hdr[IPHC2_IDX] & (SIXLOWPAN_IPHC2_M | SIXLOWPAN_IPHC2_DAC |
-                                   SIXLOWPAN_IPHC2_DAM)) {
-        case IPHC_M_DAC_DAM_U_FULL:
+    switch (iphc2 & (SIXLOWPAN_IPHC2_DAC | SIXLOWPAN_IPHC2_DAM |
+                     SIXLOWPAN_IPHC2_M)) {
         case IPHC_M_DAC_DAM_M_FULL:
             memcpy(&(ipv6_hdr->dst.u8), iphc_hdr + payload_offset, 16);
             payload_offset += 16;
             break;
 
-        case IPHC_M_DAC_DAM_U_64:
-            ipv6_addr_set_link_local_prefix(&ipv6_hdr->dst);
-            memcpy(ipv6_hdr->dst.u8 + 8, iphc_hdr + payload_offset, 8);
-            payload_offset += 8;
-            break;
-
-        case IPHC_M_DAC_DAM_U_16:
-            ipv6_addr_set_link_local_prefix(&ipv6_hdr->dst);
-            ipv6_hdr->dst.u32[2] = byteorder_htonl(0x000000ff);
-            ipv6_hdr->dst.u16[6] = byteorder_htons(0xfe00);
-            memcpy(ipv6_hdr->dst.u8 + 14, iphc_hdr + payload_offset, 2);
-            payload_offset += 2;
-            break;
-
-        case IPHC_M_DAC_DAM_U_L2:
-            if (gnrc_netif_hdr_ipv6_iid_from_dst(
-                        iface, netif_hdr, (eui64_t *)(&ipv6_hdr->dst.u64[1])
-                    ) < 0) {
-                DEBUG("6lo iphc: could not get destination's IID\n");
-                return 0;
-            }
-            ipv6_addr_set_link_local_prefix(&ipv6_hdr->dst);
-            break;
-
-        case IPHC_M_DAC_DAM_U_CTX_64:
-            assert(ctx != NULL);
-            memcpy(ipv6_hdr->dst.u8 + 8, iphc_hdr + payload_offset, 8);
-            ipv6_addr_init_prefix(&ipv6_hdr->dst, &ctx->prefix,
-                                  ctx->prefix_len);
-            payload_offset += 8;
-            break;
-
-        case IPHC_M_DAC_DAM_U_CTX_16:
-            ipv6_hdr->dst.u32[2] = byteorder_htonl(0x000000ff);
-            ipv6_hdr->dst.u16[6] = byteorder_htons(0xfe00);
-            memcpy(ipv6_hdr->dst.u8 + 14, iphc_hdr + payload_offset, 2);
-            assert(ctx != NULL);
-            ipv6_addr_init_prefix(&ipv6_hdr->dst, &ctx->prefix,
-                                  ctx->prefix_len);
-            payload_offset += 2;
-            break;
-
-        case IPHC_M_DAC_DAM_U_CTX_L2:
-            if (gnrc_netif_hdr_ipv6_iid_from_dst(
-                        iface, netif_hdr, (eui64_t *)(&ipv6_hdr->dst.u64[1])
-                    ) < 0) {
-                DEBUG("6lo iphc: could not get destination's IID\n");
-                return 0;
-            }
-            assert(ctx != NULL);
-            ipv6_addr_init_prefix(&ipv6_hdr->dst, &ctx->prefix,
-                                  ctx->prefix_len);
-            break;
-
         case IPHC_M_DAC_DAM_M_48:
             /* ffXX::00XX:XXXX:XXXX */
-            ipv6_addr_set_unspecified(&ipv6_hdr->dst);
             ipv6_hdr->dst.u8[0] = 0xff;
             ipv6_hdr->dst.u8[1] = iphc_hdr[payload_offset++];
             memcpy(ipv6_hdr->dst.u8 + 11, iphc_hdr + payload_offset, 5);
@@ -405,7 +394,6 @@ static size_t _iphc_ipv6_decode(const uint8_t *iphc_hdr,
 
         case IPHC_M_DAC_DAM_M_32:
             /* ffXX::00XX:XXXX */
-            ipv6_addr_set_unspecified(&ipv6_hdr->dst);
             ipv6_hdr->dst.u8[0] = 0xff;
             ipv6_hdr->dst.u8[1] = iphc_hdr[payload_offset++];
             memcpy(ipv6_hdr->dst.u8 + 13, iphc_hdr + payload_offset, 3);
@@ -414,39 +402,30 @@ static size_t _iphc_ipv6_decode(const uint8_t *iphc_hdr,
 
         case IPHC_M_DAC_DAM_M_8:
             /* ff02::XX: */
-            ipv6_addr_set_unspecified(&ipv6_hdr->dst);
             ipv6_hdr->dst.u8[0] = 0xff;
             ipv6_hdr->dst.u8[1] = 0x02;
             ipv6_hdr->dst.u8[15] = iphc_hdr[payload_offset++];
             break;
 
-        case IPHC_M_DAC_DAM_M_UC_PREFIX:
-            do {
-                assert(ctx != NULL);
-                uint8_t orig_ctx_len = ctx->prefix_len;
-
-                ipv6_addr_set_unspecified(&ipv6_hdr->dst);
-
-                if (ctx->prefix_len > 64) {
-                    ctx->prefix_len = 64;
-                }
+        case IPHC_M_DAC_DAM_M_UC_PREFIX: {
+            /* ffXX:XXLL:PPPP:PPPP:PPPP:PPPP:XXXX:XXXX */
+            assert(ctx != NULL);
+            uint8_t prefix_len = (ctx->prefix_len > 64) ? 64 : ctx->prefix_len;
 
-                ipv6_hdr->dst.u8[0] = 0xff;
-                ipv6_hdr->dst.u8[1] = iphc_hdr[payload_offset++];
-                ipv6_hdr->dst.u8[2] = iphc_hdr[payload_offset++];
-                ipv6_hdr->dst.u8[3] = ctx->prefix_len;
-                ipv6_addr_init_prefix((ipv6_addr_t *)(ipv6_hdr->dst.u8 + 4),
-                                      &ctx->prefix, ctx->prefix_len);
-                memcpy(ipv6_hdr->dst.u8 + 12, iphc_hdr + payload_offset + 2, 4);
-
-                payload_offset += 4;
-                ctx->prefix_len = orig_ctx_len;
-            } while (0);    /* ANSI-C compatible block creation for orig_ctx_len allocation */
+            ipv6_hdr->dst.u8[0] = 0xff;
+            ipv6_hdr->dst.u8[1] = iphc_hdr[payload_offset++];
+            ipv6_hdr->dst.u8[2] = iphc_hdr[payload_offset++];
+            ipv6_hdr->dst.u8[3] = prefix_len;
+            ipv6_addr_init_prefix((ipv6_addr_t *)(ipv6_hdr->dst.u8 + 4),
+                                  &ctx->prefix, prefix_len);
+            memcpy(ipv6_hdr->dst.u8 + 12, iphc_hdr + payload_offset, 4);
+            payload_offset += 4;
             break;
+        }
 
         default:
-            DEBUG("6lo iphc: unspecified or reserved M, DAC, DAM combination\n");
-            break;
+            DEBUG("6lo iphc: reserved M, DAC, DAM combination\n");
+            return 0;
     }
     return payload_offset;
 }
@@ -476,26 +455,11 @@ static size_t _iphc_nhc_ipv6_ext_decode(gnrc_pktsnip_t *sixlo, size_t offset,
         }
     }
     ext_hdr = (ipv6_ext_t *)((uint8_t *)ipv6->data + *uncomp_hdr_len);
-    switch (ipv6_ext_nhc & NHC_IPV6_EXT_EID_MASK) {
-        case NHC_IPV6_EXT_EID_HOPOPT:
-            protnum = PROTNUM_IPV6_EXT_HOPOPT;
-            break;
-        case NHC_IPV6_EXT_EID_RH:
-            protnum = PROTNUM_IPV6_EXT_RH;
-            break;
-        case NHC_IPV6_EXT_EID_FRAG:
-            protnum = PROTNUM_IPV6_EXT_FRAG;
-            break;
-        case NHC_IPV6_EXT_EID_DST:
-            protnum = PROTNUM_IPV6_EXT_DST;
-            break;
-        case NHC_IPV6_EXT_EID_MOB:
-            protnum = PROTNUM_IPV6_EXT_MOB;
-            break;
-        default:
-            DEBUG("6lo iphc: unexpected extension header EID %u\n",
-                  (ipv6_ext_nhc & NHC_IPV6_EXT_EID_MASK) >> 1U);
-            return 0;
+    protnum = _iphc_nhc_ext_protnum[(ipv6_ext_nhc & NHC_IPV6_EXT_EID_MASK) >> 1];
+    if (protnum == PROTNUM_RESERVED) {
+        DEBUG("6lo iphc: unexpected extension header EID %u\n",
+              (ipv6_ext_nhc & NHC_IPV6_EXT_EID_MASK) >> 1U);
+        return 0;
     }
     ((uint8_t *)ipv6->data)[*prev_nh_offset] = protnum;
     if (!(ipv6_ext_nhc & NHC_IPV6_EXT_NH)) {
@@ -1595,6 +1559,173 @@ static ssize_t _nhc_udp_encode_snip(gnrc_pktsnip_t *pkt, uint8_t *nhc_data)
 }
 #endif
 
+#if CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE > 0
+/* IPHC dispatch, CID extension, traffic class and flow label, next header,
+ * hop limit, and two full addresses */
+#define IPHC_CACHE_HDR_MAX          (SIXLOWPAN_IPHC_HDR_LEN + \
+                                     SIXLOWPAN_IPHC_CID_EXT_LEN + 6U + \
+                                     (2U * sizeof(ipv6_addr_t)))
+
+/**
+ * @brief   Entry in the compressed header cache
+ */
+typedef struct {
+    gnrc_netif_t *iface;        /**< interface, NULL if entry is unused */
+    ipv6_hdr_t ipv6_hdr;        /**< uncompressed header (length is ignored) */
+    uint8_t l2addr[GNRC_NETIF_L2ADDR_MAXLEN];       /**< l2addr of iface */
+    uint8_t dst_l2addr[GNRC_NETIF_L2ADDR_MAXLEN];   /**< destination l2addr */
+    uint8_t l2addr_len;         /**< length of gnrc_netif_t::l2addr */
+    uint8_t dst_l2addr_len;     /**< length of the destination l2addr */
+    uint8_t iphc_hdr_len;       /**< length of the compressed header */
+    uint8_t iphc_hdr[IPHC_CACHE_HDR_MAX];   /**< compressed header */
+} _iphc_cache_t;
+
+/* only accessed by the 6LoWPAN thread, so no locking is required */
+static _iphc_cache_t _iphc_cache[CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE];
+static unsigned _iphc_cache_next;
+
+static bool _iphc_cache_ctx_valid(uint8_t cid, const ipv6_addr_t *addr,
+                                  uint8_t min_match)
+{
+    const gnrc_sixlowpan_ctx_t *ctx = gnrc_sixlowpan_ctx_lookup_id(cid);
+
+    /* the look-up also updates the lifetime of the context */
+    if ((ctx == NULL) || !(ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP)) {
+        return false;
+    }
+    if (min_match < ctx->prefix_len) {
+        min_match = ctx->prefix_len;
+    }
+    return ipv6_addr_match_prefix(&ctx->prefix, addr) >= min_match;
+}
+
+/**
+ * @brief   Checks if the contexts a cached header was compressed with are
+ *          still usable for compression
+ */
+static bool _iphc_cache_ctxs_valid(const _iphc_cache_t *entry)
+{
+    const uint8_t *iphc_hdr = entry->iphc_hdr;
+    const ipv6_hdr_t *ipv6_hdr = &entry->ipv6_hdr;
+    uint8_t cids = (iphc_hdr[IPHC2_IDX] & SIXLOWPAN_IPHC2_CID_EXT)
+                 ? iphc_hdr[CID_EXT_IDX] : 0;
+
+    if ((iphc_hdr[IPHC2_IDX] & SIXLOWPAN_IPHC2_SAC) &&
+        (iphc_hdr[IPHC2_IDX] & SIXLOWPAN_IPHC2_SAM) &&
+        !_iphc_cache_ctx_valid(cids >> 4, &ipv6_hdr->src,
+                               SIXLOWPAN_IPHC_PREFIX_LEN)) {
+        return false;
+    }
+    if (!(iphc_hdr[IPHC2_IDX] & SIXLOWPAN_IPHC2_DAC)) {
+        return true;
+    }
+    if (iphc_hdr[IPHC2_IDX] & SIXLOWPAN_IPHC2_M) {
+        /* unicast prefix based multicast address */
+        ipv6_addr_t unicast_prefix = IPV6_ADDR_UNSPECIFIED;
+
+        memcpy(&unicast_prefix, &ipv6_hdr->dst.u8[4], sizeof(uint64_t));
+        return _iphc_cache_ctx_valid(cids & 0x0f, &unicast_prefix,
+                                     ipv6_hdr->dst.u8[3]);
+    }
+    return _iphc_cache_ctx_valid(cids & 0x0f, &ipv6_hdr->dst,
+                                 SIXLOWPAN_IPHC_PREFIX_LEN);
+}
+
+static bool _iphc_cache_match(const _iphc_cache_t *entry,
+                              const ipv6_hdr_t *ipv6_hdr,
+                              const gnrc_netif_hdr_t *netif_hdr,
+                              const gnrc_netif_t *iface)
+{
+    return (entry->iface == iface) &&
+           (entry->ipv6_hdr.v_tc_fl.u32 == ipv6_hdr->v_tc_fl.u32) &&
+           (entry->ipv6_hdr.nh == ipv6_hdr->nh) &&
+           (entry->ipv6_hdr.hl == ipv6_hdr->hl) &&
+           ipv6_addr_equal(&entry->ipv6_hdr.src, &ipv6_hdr->src) &&
+           ipv6_addr_equal(&entry->ipv6_hdr.dst, &ipv6_hdr->dst) &&
+           (entry->dst_l2addr_len == netif_hdr->dst_l2addr_len) &&
+           (memcmp(entry->dst_l2addr, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                   entry->dst_l2addr_len) == 0) &&
+           /* the IID the source address may be derived from */
+           (entry->l2addr_len == iface->l2addr_len) &&
+           (memcmp(entry->l2addr, iface->l2addr, entry->l2addr_len) == 0);
+}
+
+/**
+ * @brief   Gets the compressed IPv6 header of a packet from the cache
+ *
+ * @return  Length of the compressed header written to @p iphc_hdr on hit.
+ * @return  0 on miss.
+ */
+static size_t _iphc_cache_get(const ipv6_hdr_t *ipv6_hdr,
+                              const gnrc_netif_hdr_t *netif_hdr,
+                              const gnrc_netif_t *iface, uint8_t *iphc_hdr)
+{
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE; i++) {
+        _iphc_cache_t *entry = &_iphc_cache[i];
+
+        if (_iphc_cache_match(entry, ipv6_hdr, netif_hdr, iface)) {
+            if (!_iphc_cache_ctxs_valid(entry)) {
+                DEBUG("6lo iphc: cached header uses outdated context\n");
+                entry->iface = NULL;
+                return 0;
+            }
+            memcpy(iphc_hdr, entry->iphc_hdr, entry->iphc_hdr_len);
+            return entry->iphc_hdr_len;
+        }
+    }
+    return 0;
+}
+
+static void _iphc_cache_add(const ipv6_hdr_t *ipv6_hdr,
+                            const gnrc_netif_hdr_t *netif_hdr,
+                            gnrc_netif_t *iface, const uint8_t *iphc_hdr,
+                            size_t iphc_hdr_len)
+{
+    _iphc_cache_t *entry = &_iphc_cache[_iphc_cache_next];
+
+    if ((iphc_hdr_len > sizeof(entry->iphc_hdr)) ||
+        (netif_hdr->dst_l2addr_len > sizeof(entry->dst_l2addr))) {
+        return;
+    }
+    _iphc_cache_next = (_iphc_cache_next + 1) %
+                       CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE;
+    entry->iface = iface;
+    entry->ipv6_hdr = *ipv6_hdr;
+    entry->l2addr_len = iface->l2addr_len;
+    memcpy(entry->l2addr, iface->l2addr, iface->l2addr_len);
+    entry->dst_l2addr_len = netif_hdr->dst_l2addr_len;
+    memcpy(entry->dst_l2addr, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+           netif_hdr->dst_l2addr_len);
+    entry->iphc_hdr_len = iphc_hdr_len;
+    memcpy(entry->iphc_hdr, iphc_hdr, iphc_hdr_len);
+}
+#else   /* CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE > 0 */
+static inline size_t _iphc_cache_get(const ipv6_hdr_t *ipv6_hdr,
+                                     const gnrc_netif_hdr_t *netif_hdr,
+                                     const gnrc_netif_t *iface,
+                                     uint8_t *iphc_hdr)
+{
+    (void)ipv6_hdr;
+    (void)netif_hdr;
+    (void)iface;
+    (void)iphc_hdr;
+    return 0;
+}
+
+static inline void _iphc_cache_add(const ipv6_hdr_t *ipv6_hdr,
+                                   const gnrc_netif_hdr_t *netif_hdr,
+                                   gnrc_netif_t *iface,
+                                   const uint8_t *iphc_hdr,
+                                   size_t iphc_hdr_len)
+{
+    (void)ipv6_hdr;
+    (void)netif_hdr;
+    (void)iface;
+    (void)iphc_hdr;
+    (void)iphc_hdr_len;
+}
+#endif  /* CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE > 0 */
+
 static inline bool _compressible(gnrc_pktsnip_t *hdr)
 {
     switch (hdr->type) {
@@ -1660,12 +1791,17 @@ static gnrc_pktsnip_t *_iphc_encode(gnrc_pktsnip_t *pkt,
     }
 
     iphc_hdr = dispatch->data;
-    inline_pos = _iphc_ipv6_encode(pkt, netif_hdr, iface, iphc_hdr);
-
+    inline_pos = _iphc_cache_get(pkt->next->data, netif_hdr, iface, iphc_hdr);
     if (inline_pos == 0) {
-        DEBUG("6lo iphc: error encoding IPv6 header\n");
-        gnrc_pktbuf_release(dispatch);
-        return NULL;
+        inline_pos = _iphc_ipv6_encode(pkt, netif_hdr, iface, iphc_hdr);
+
+        if (inline_pos == 0) {
+            DEBUG("6lo iphc: error encoding IPv6 header\n");
+            gnrc_pktbuf_release(dispatch);
+            return NULL;
+        }
+        _iphc_cache_add(pkt->next->data, netif_hdr, iface, iphc_hdr,
+                        inline_pos);
     }
 
     nh = ((ipv6_hdr_t *)pkt->next->data)->nh;
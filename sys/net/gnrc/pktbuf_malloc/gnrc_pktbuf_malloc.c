@@ -112,6 +112,37 @@ gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t s
     return pkt;
 }
 
+gnrc_pktsnip_t *gnrc_pktbuf_add_snips(gnrc_pktsnip_t *next, const size_t *sizes,
+                                      const gnrc_nettype_t *types, unsigned num)
+{
+    gnrc_pktsnip_t *pkt = next;
+
+    assert(num > 0);
+    mutex_lock(&gnrc_pktbuf_mutex);
+    /* malloc'd sections can not be freed in parts, so allocate each snip on
+     * its own */
+    for (unsigned i = num; i > 0; i--) {
+        gnrc_pktsnip_t *snip = NULL;
+
+        if (sizes[i - 1] <= CONFIG_GNRC_PKTBUF_SIZE) {
+            snip = _create_snip(pkt, NULL, sizes[i - 1], types[i - 1]);
+        }
+        if (snip == NULL) {
+            while (pkt != next) {
+                snip = pkt->next;
+                _free(pkt->data);
+                _free(pkt);
+                pkt = snip;
+            }
+            mutex_unlock(&gnrc_pktbuf_mutex);
+            return NULL;
+        }
+        pkt = snip;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return pkt;
+}
+
 static gnrc_pktsnip_t *_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
 {
     gnrc_pktsnip_t *header;
@@ -96,6 +96,49 @@ gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t s
     return pkt;
 }
 
+gnrc_pktsnip_t *gnrc_pktbuf_add_snips(gnrc_pktsnip_t *next, const size_t *sizes,
+                                      const gnrc_nettype_t *types, unsigned num)
+{
+    gnrc_pktsnip_t *pkt, *snip;
+    uint8_t *chunk;
+    size_t size = 0;
+
+    assert(num > 0);
+    for (unsigned i = 0; i < num; i++) {
+        size += _align(sizeof(gnrc_pktsnip_t)) + _align(sizes[i]);
+    }
+    if (size > CONFIG_GNRC_PKTBUF_SIZE) {
+        DEBUG("pktbuf: size (%" PRIuSIZE ") > CONFIG_GNRC_PKTBUF_SIZE (%u)\n",
+              size, CONFIG_GNRC_PKTBUF_SIZE);
+        return NULL;
+    }
+    mutex_lock(&gnrc_pktbuf_mutex);
+    /* every part of the chunk is aligned, so all snips and their data can be
+     * freed on their own later on */
+    chunk = _pktbuf_alloc(size);
+    if (chunk == NULL) {
+        DEBUG("pktbuf: error allocating new packet snips\n");
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    /* We cast to uintptr_t as intermediate step to silence -Wcast-align */
+    pkt = snip = (gnrc_pktsnip_t *)(uintptr_t)chunk;
+    for (unsigned i = 0; i < num; i++) {
+        gnrc_pktsnip_t *tmp = snip;
+        void *data = NULL;
+
+        chunk += _align(sizeof(gnrc_pktsnip_t));
+        if (sizes[i] > 0) {
+            data = chunk;
+            chunk += _align(sizes[i]);
+        }
+        snip = (i < (num - 1)) ? (gnrc_pktsnip_t *)(uintptr_t)chunk : next;
+        _set_pktsnip(tmp, snip, data, sizes[i], types[i]);
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return pkt;
+}
+
 gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
 {
     gnrc_pktsnip_t *marked_snip;
@@ -201,6 +201,29 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
                        const sock_ip_ep_t *remote, uint8_t nh)
 {
     gnrc_pktsnip_t *pkt;
+
+    switch (local->family) {
+#ifdef SOCK_HAS_IPV6
+        case AF_INET6:
+            pkt = gnrc_pktbuf_add(payload, NULL, sizeof(ipv6_hdr_t),
+                                  GNRC_NETTYPE_IPV6);
+            break;
+#endif
+        default:
+            gnrc_pktbuf_release(payload);
+            return -EAFNOSUPPORT;
+    }
+    if (pkt == NULL) {
+        gnrc_pktbuf_release(payload);
+        return -ENOMEM;
+    }
+    return gnrc_sock_send_pkt(pkt, local, remote, nh);
+}
+
+ssize_t gnrc_sock_send_pkt(gnrc_pktsnip_t *pkt, sock_ip_ep_t *local,
+                           const sock_ip_ep_t *remote, uint8_t nh)
+{
+    gnrc_pktsnip_t *payload = pkt->next;
     kernel_pid_t iface = KERNEL_PID_UNDEF;
     gnrc_nettype_t type;
     size_t payload_len = gnrc_pkt_len(payload);
@@ -212,13 +235,13 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
 #endif
 
     if (local->family != remote->family) {
-        gnrc_pktbuf_release(payload);
+        gnrc_pktbuf_release(pkt);
         return -EAFNOSUPPORT;
     }
 
 #if IS_USED(MODULE_GNRC_TX_SYNC)
-    if (gnrc_tx_sync_append(payload, &tx_sync)) {
-        gnrc_pktbuf_release(payload);
+    if (gnrc_tx_sync_append(pkt, &tx_sync)) {
+        gnrc_pktbuf_release(pkt);
         return -ENOMEM;
     }
 #endif
@@ -226,12 +249,10 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
     switch (local->family) {
 #ifdef SOCK_HAS_IPV6
         case AF_INET6: {
-            ipv6_hdr_t *hdr;
-            pkt = gnrc_ipv6_hdr_build(payload, (ipv6_addr_t *)&local->addr.ipv6,
-                                      (ipv6_addr_t *)&remote->addr.ipv6);
-            if (pkt == NULL) {
-                return -ENOMEM;
-            }
+            ipv6_hdr_t *hdr = pkt->data;
+
+            gnrc_ipv6_hdr_init(hdr, (ipv6_addr_t *)&local->addr.ipv6,
+                               (ipv6_addr_t *)&remote->addr.ipv6);
             if (payload->type == GNRC_NETTYPE_UNDEF) {
                 payload->type = GNRC_NETTYPE_IPV6;
                 type = GNRC_NETTYPE_IPV6;
@@ -239,14 +260,13 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
             else {
                 type = payload->type;
             }
-            hdr = pkt->data;
             hdr->nh = nh;
             break;
         }
 #endif
         default:
             (void)nh;
-            gnrc_pktbuf_release(payload);
+            gnrc_pktbuf_release(pkt);
             return -EAFNOSUPPORT;
     }
     if (local->netif != SOCK_ADDR_ANY_NETIF) {
@@ -164,6 +164,18 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt, uint32_t time
  */
 ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
                        const sock_ip_ep_t *remote, uint8_t nh);
+
+/**
+ * @brief   Send a packet with an already allocated network layer header
+ *          internally
+ * @internal
+ *
+ * @param[in] pkt   Packet starting with an uninitialized header snip of the
+ *                  network layer protocol of sock_ip_ep_t::family of @p local.
+ *                  The header is initialized in place.
+ */
+ssize_t gnrc_sock_send_pkt(gnrc_pktsnip_t *pkt, sock_ip_ep_t *local,
+                           const sock_ip_ep_t *remote, uint8_t nh);
 /** @internal
  * @}
  */
@@ -21,6 +21,10 @@
 #include "net/sock/tcp.h"
 #include "sock_types.h"
 
+#ifdef SOCK_HAS_ASYNC_CTX
+#include "net/sock/async/event.h"
+#endif
+
 int sock_tcp_connect(sock_tcp_t *sock, const sock_tcp_ep_t *remote,
                      uint16_t local_port, uint16_t flags)
 {
@@ -67,13 +71,23 @@ void sock_tcp_disconnect(sock_tcp_t *sock)
 {
     /* Asserts defined by API. */
     assert(sock != NULL);
+#if defined(SOCK_HAS_ASYNC) && defined(MODULE_SOCK_TCP)
+    /* The user is not interested in the events of the teardown */
+    sock->async_cb = NULL;
+#endif
     gnrc_tcp_close(sock);
+#if defined(SOCK_HAS_ASYNC_CTX) && defined(MODULE_SOCK_TCP)
+    sock_event_close(sock_tcp_get_async_ctx(sock));
+#endif
 }
 
 void sock_tcp_stop_listen(sock_tcp_queue_t *queue)
 {
     /* Asserts defined by API. */
     assert(queue != NULL);
+#if defined(SOCK_HAS_ASYNC) && defined(MODULE_SOCK_TCP)
+    queue->async_cb = NULL;
+#endif
     gnrc_tcp_stop_listen(queue);
 }
 
@@ -144,3 +158,38 @@ ssize_t sock_tcp_write(sock_tcp_t *sock, const void *data, size_t len)
      * until at least some data was transmitted. */
     return gnrc_tcp_send(sock, data, len, 0);
 }
+
+#if defined(SOCK_HAS_ASYNC) && defined(MODULE_SOCK_TCP)
+void sock_tcp_set_cb(sock_tcp_t *sock, sock_tcp_cb_t cb, void *arg)
+{
+    sock->async_cb_arg = arg;
+    sock->async_cb = cb;
+
+    /* Report data received before the callback was set, e.g. between the
+     * handshake and sock_tcp_accept() */
+    if ((cb != NULL) && (sock->rcv_buf.avail > 0)) {
+        cb(sock, SOCK_ASYNC_MSG_RECV, arg);
+    }
+}
+
+void sock_tcp_queue_set_cb(sock_tcp_queue_t *queue, sock_tcp_queue_cb_t cb,
+                           void *arg)
+{
+    queue->async_cb_arg = arg;
+    queue->async_cb = cb;
+}
+
+#ifdef SOCK_HAS_ASYNC_CTX
+sock_async_ctx_t *sock_tcp_get_async_ctx(sock_tcp_t *sock)
+{
+    return &sock->async_ctx;
+}
+
+sock_async_ctx_t *sock_tcp_queue_get_async_ctx(sock_tcp_queue_t *queue)
+{
+    return &queue->async_ctx;
+}
+#endif  /* SOCK_HAS_ASYNC_CTX */
+#endif  /* defined(SOCK_HAS_ASYNC) && defined(MODULE_SOCK_TCP) */
+
+/** @} */
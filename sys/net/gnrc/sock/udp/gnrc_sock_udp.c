@@ -212,6 +212,30 @@ ssize_t sock_udp_recv_aux(sock_udp_t *sock, void *data, size_t max_len,
     return (nobufs) ? -ENOBUFS : ((res < 0) ? res : ret);
 }
 
+int sock_udp_recv_many(sock_udp_t *sock, sock_udp_msg_t *msgs, unsigned num,
+                       uint32_t timeout)
+{
+    unsigned i;
+
+    assert((msgs != NULL) && (num > 0));
+    for (i = 0; i < num; i++) {
+        /* only wait for the first message, the rest is taken from the mbox
+         * as far as available */
+        ssize_t res = sock_udp_recv_aux(sock, msgs[i].data, msgs[i].len,
+                                        (i == 0) ? timeout : 0,
+                                        msgs[i].remote, NULL);
+
+        if (res < 0) {
+            if (i == 0) {
+                return res;
+            }
+            break;
+        }
+        msgs[i].len = res;
+    }
+    return i;
+}
+
 static bool _accept_remote(const sock_udp_t *sock, const udp_hdr_t *hdr,
                            const sock_ip_ep_t *remote)
 {
@@ -330,18 +354,11 @@ ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **buf_ctx,
     return res;
 }
 
-ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
-                           const iolist_t *snips,
-                           const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+static int _prepare_send(sock_udp_t *sock, const sock_udp_ep_t *remote,
+                         sock_udp_aux_tx_t *aux, sock_ip_ep_t *local,
+                         uint16_t *src_port, sock_udp_ep_t *rem)
 {
     (void)aux;
-    int res;
-    gnrc_pktsnip_t *pkt, *payload = NULL;
-    uint16_t src_port = 0, dst_port;
-    sock_ip_ep_t local;
-    sock_udp_ep_t remote_cpy;
-    sock_ip_ep_t *rem;
-
     assert((sock != NULL) || (remote != NULL));
 
     if (remote != NULL) {
@@ -369,8 +386,8 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
      * cppcheck is being weird here anyways) */
     if ((sock == NULL) || (sock->local.family == AF_UNSPEC)) {
         /* no sock or sock currently unbound */
-        memset(&local, 0, sizeof(local));
-        if ((src_port = _get_dyn_port(sock)) == GNRC_SOCK_DYN_PORTRANGE_ERR) {
+        memset(local, 0, sizeof(*local));
+        if ((*src_port = _get_dyn_port(sock)) == GNRC_SOCK_DYN_PORTRANGE_ERR) {
             return -EADDRINUSE;
         }
         /* cppcheck-suppress nullPointer
@@ -378,14 +395,14 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
          * well, see above) */
         if (sock != NULL) {
             /* bind sock object implicitly */
-            sock->local.port = src_port;
+            sock->local.port = *src_port;
             if (remote == NULL) {
                 sock->local.family = sock->remote.family;
             }
             else {
                 sock->local.family = remote->family;
             }
-            gnrc_sock_create(&sock->reg, GNRC_NETTYPE_UDP, src_port);
+            gnrc_sock_create(&sock->reg, GNRC_NETTYPE_UDP, *src_port);
 #ifdef MODULE_GNRC_SOCK_CHECK_REUSE
             /* prepend to current socks */
             sock->reg.next = (gnrc_sock_reg_t *)_udp_socks;
@@ -394,53 +411,68 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
         }
     }
     else {
-        src_port = sock->local.port;
-        memcpy(&local, &sock->local, sizeof(local));
+        *src_port = sock->local.port;
+        memcpy(local, &sock->local, sizeof(*local));
     }
 #if IS_USED(MODULE_SOCK_AUX_LOCAL)
     /* user supplied local endpoint takes precedent */
     if ((aux != NULL) && (aux->flags & SOCK_AUX_SET_LOCAL)) {
-        local.family = aux->local.family;
-        local.netif = aux->local.netif;
-        src_port = aux->local.port;
-        memcpy(&local.addr, &aux->local.addr, sizeof(local.addr));
+        local->family = aux->local.family;
+        local->netif = aux->local.netif;
+        *src_port = aux->local.port;
+        memcpy(&local->addr, &aux->local.addr, sizeof(local->addr));
 
         aux->flags &= ~SOCK_AUX_SET_LOCAL;
     }
 #endif
     /* sock can't be NULL at this point */
     if (remote == NULL) {
-        rem = (sock_ip_ep_t *)&sock->remote;
-        dst_port = sock->remote.port;
+        memcpy(rem, &sock->remote, sizeof(*rem));
     }
     else {
-        rem = (sock_ip_ep_t *)&remote_cpy;
-        gnrc_ep_set(rem, (sock_ip_ep_t *)remote, sizeof(sock_udp_ep_t));
-        dst_port = remote->port;
+        gnrc_ep_set((sock_ip_ep_t *)rem, (sock_ip_ep_t *)remote,
+                    sizeof(sock_udp_ep_t));
     }
     /* check for matching address families in local and remote */
-    if (local.family == AF_UNSPEC) {
-        local.family = rem->family;
+    if (local->family == AF_UNSPEC) {
+        local->family = rem->family;
     }
-    else if (local.family != rem->family) {
+    else if (local->family != rem->family) {
         return -EINVAL;
     }
+    return 0;
+}
 
-    /* allocate snip for payload */
-    payload = gnrc_pktbuf_add(NULL, NULL, iolist_size(snips), GNRC_NETTYPE_UNDEF);
-    if (payload == NULL) {
-        return -ENOMEM;
-    }
+static gnrc_pktsnip_t *_alloc(size_t len)
+{
+    /* IPv6 header, UDP header and payload in one go */
+    const size_t sizes[] = { sizeof(ipv6_hdr_t), sizeof(udp_hdr_t), len };
+    const gnrc_nettype_t types[] = {
+        GNRC_NETTYPE_IPV6, GNRC_NETTYPE_UDP, GNRC_NETTYPE_UNDEF
+    };
 
-    /* copy payload data into payload snip */
-    iolist_to_buffer(snips, payload->data, payload->size);
+    return gnrc_pktbuf_add_snips(NULL, sizes, types, ARRAY_SIZE(sizes));
+}
+
+static ssize_t _send(sock_udp_t *sock, gnrc_pktsnip_t *pkt, size_t len,
+                     uint16_t src_port, sock_ip_ep_t *local,
+                     sock_udp_ep_t *rem)
+{
+    gnrc_pktsnip_t *payload = pkt->next->next;
+    udp_hdr_t *hdr = pkt->next->data;
+    ssize_t res;
 
-    pkt = gnrc_udp_hdr_build(payload, src_port, dst_port);
-    if (pkt == NULL) {
-        gnrc_pktbuf_release(payload);
+    assert(len <= payload->size);
+    /* shrinking gives the unused tail back to the packet buffer */
+    if (gnrc_pktbuf_realloc_data(payload, len) != 0) {
+        gnrc_pktbuf_release(pkt);
         return -ENOMEM;
     }
-    res = gnrc_sock_send(pkt, &local, rem, PROTNUM_UDP);
+    hdr->src_port = byteorder_htons(src_port);
+    hdr->dst_port = byteorder_htons(rem->port);
+    hdr->checksum = byteorder_htons(0);
+    /* IPv6 header was allocated in front of the UDP header already */
+    res = gnrc_sock_send_pkt(pkt, local, (sock_ip_ep_t *)rem, PROTNUM_UDP);
     if (res > 0) {
         res -= sizeof(udp_hdr_t);
     }
@@ -449,10 +481,68 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
         sock->reg.async_cb.udp(sock, SOCK_ASYNC_MSG_SENT,
                                sock->reg.async_cb_arg);
     }
+#else
+    (void)sock;
 #endif  /* SOCK_HAS_ASYNC */
     return res;
 }
 
+ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
+                           const iolist_t *snips,
+                           const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+{
+    int res;
+    gnrc_pktsnip_t *pkt;
+    uint16_t src_port = 0;
+    size_t len = iolist_size(snips);
+    sock_ip_ep_t local;
+    sock_udp_ep_t rem;
+
+    if ((res = _prepare_send(sock, remote, aux, &local, &src_port, &rem)) < 0) {
+        return res;
+    }
+    if ((pkt = _alloc(len)) == NULL) {
+        return -ENOMEM;
+    }
+    /* copy payload data into payload snip */
+    iolist_to_buffer(snips, pkt->next->next->data, len);
+    return _send(sock, pkt, len, src_port, &local, &rem);
+}
+
+int sock_udp_send_buf_alloc(void **data, void **buf_ctx, size_t len)
+{
+    gnrc_pktsnip_t *pkt;
+
+    assert((data != NULL) && (buf_ctx != NULL));
+    if ((pkt = _alloc(len)) == NULL) {
+        return -ENOMEM;
+    }
+    *data = pkt->next->next->data;
+    *buf_ctx = pkt;
+    return 0;
+}
+
+ssize_t sock_udp_send_buf_aux(sock_udp_t *sock, void *buf_ctx, size_t len,
+                              const sock_udp_ep_t *remote,
+                              sock_udp_aux_tx_t *aux)
+{
+    uint16_t src_port = 0;
+    sock_ip_ep_t local;
+    sock_udp_ep_t rem;
+    ssize_t res;
+
+    if ((res = _prepare_send(sock, remote, aux, &local, &src_port, &rem)) < 0) {
+        gnrc_pktbuf_release(buf_ctx);
+        return res;
+    }
+    return _send(sock, buf_ctx, len, src_port, &local, &rem);
+}
+
+void sock_udp_send_buf_free(void *buf_ctx)
+{
+    gnrc_pktbuf_release(buf_ctx);
+}
+
 #ifdef SOCK_HAS_ASYNC
 void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *arg)
 {
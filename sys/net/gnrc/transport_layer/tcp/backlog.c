@@ -0,0 +1,629 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief   SYN backlog and SYN cookies for GNRC TCP
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "evtimer.h"
+#include "kernel_defines.h"
+#include "macros/utils.h"
+#include "mutex.h"
+#include "random.h"
+#include "net/af.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/tcp/config.h"
+#include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_eventloop.h"
+#include "include/gnrc_tcp_fsm.h"
+#include "include/gnrc_tcp_option.h"
+#include "include/gnrc_tcp_pkt.h"
+#include "include/gnrc_tcp_rcvbuf.h"
+#include "include/gnrc_tcp_backlog.h"
+
+#if IS_USED(MODULE_GNRC_TCP_SYNCOOKIES)
+#include "hashes/sha256.h"
+#endif
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/**
+ * @brief Connection request held by the backlog.
+ */
+struct _gnrc_tcp_backlog_entry {
+    ipv6_addr_t local_addr;   /**< Local address */
+    ipv6_addr_t peer_addr;    /**< Peer address */
+    uint32_t iss;             /**< Initial send sequence number */
+    uint32_t irs;             /**< Initial receive sequence number */
+    uint32_t snd_wnd;         /**< Latest window of the peer */
+    uint32_t rcv_wnd;         /**< Window announced in the SYN+ACK */
+    uint32_t rcv_buf_limit;   /**< Receive buffer limit of the listening TCBs */
+    uint32_t ts_recent;       /**< Timestamp to echo to the peer */
+    uint32_t since;           /**< Arrival time of the SYN in milliseconds */
+    uint32_t due;             /**< Time of the next retransmission or handover */
+    uint32_t rto;             /**< Current SYN+ACK retransmission timeout */
+    uint16_t local_port;      /**< Local port */
+    uint16_t peer_port;       /**< Peer port */
+    uint16_t mss;             /**< MSS of the peer */
+    int8_t ll_iface;          /**< Interface of link-local peers, zero otherwise */
+    uint8_t options;          /**< Negotiated options */
+    uint8_t snd_wnd_scale;    /**< Shift count for windows of the peer */
+    uint8_t rcv_wnd_scale;    /**< Shift count for own windows */
+    bool used;                /**< Entry holds a connection request */
+    bool completed;           /**< The peer acknowledged the SYN+ACK */
+};
+
+typedef _gnrc_tcp_backlog_entry_t _backlog_entry_t;
+
+static mutex_t _backlog_lock = MUTEX_INIT;
+static _backlog_entry_t _backlog[CONFIG_GNRC_TCP_BACKLOG_SIZE];
+static evtimer_msg_event_t _backlog_timer;
+
+/* Parses SYNs and builds SYN+ACKs like a listening TCB would. SYN+ACKs are
+ * only built by the eventloop, so a single instance suffices */
+static gnrc_tcp_tcb_t _backlog_tcb;
+
+#if IS_USED(MODULE_GNRC_TCP_SYNCOOKIES)
+/* SYN cookies as of RFC 4987, section 3.6: 5 bit time counter, 3 bit MSS
+ * index and 24 bit MAC over the connection and the counter */
+#define COOKIE_COUNT_SHIFT  (16U)   /* counter advances every 65.5 seconds */
+#define COOKIE_COUNT_MASK   (0x1fU)
+
+static const uint16_t _cookie_mss[] = { 216, 536, 1220, 1440 };
+static uint8_t _cookie_secret[16];
+static bool _cookie_secret_set;
+
+static uint32_t _cookie(const ipv6_hdr_t *ip, const tcp_hdr_t *hdr,
+                        uint32_t irs, uint32_t count, uint8_t mss_idx)
+{
+    struct __attribute__((packed)) {
+        uint8_t secret[sizeof(_cookie_secret)];
+        ipv6_addr_t local_addr;
+        ipv6_addr_t peer_addr;
+        network_uint16_t local_port;
+        network_uint16_t peer_port;
+        uint32_t irs;
+        uint32_t count;
+    } in;
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+
+    if (!_cookie_secret_set) {
+        random_bytes(_cookie_secret, sizeof(_cookie_secret));
+        _cookie_secret_set = true;
+    }
+    memcpy(in.secret, _cookie_secret, sizeof(in.secret));
+    in.local_addr = ip->dst;
+    in.peer_addr = ip->src;
+    in.local_port = hdr->dst_port;
+    in.peer_port = hdr->src_port;
+    in.irs = irs;
+    in.count = count & COOKIE_COUNT_MASK;
+    sha256(&in, sizeof(in), digest);
+
+    return ((count & COOKIE_COUNT_MASK) << 27) | ((uint32_t)mss_idx << 24) |
+           ((uint32_t)digest[0] << 16) | ((uint32_t)digest[1] << 8) | digest[2];
+}
+
+/* Returns the MSS encoded in a valid cookie acknowledged by hdr, zero otherwise */
+static uint16_t _cookie_check(const ipv6_hdr_t *ip, const tcp_hdr_t *hdr)
+{
+    uint32_t iss = byteorder_ntohl(hdr->ack_num) - 1;
+    uint32_t irs = byteorder_ntohl(hdr->seq_num) - 1;
+    uint32_t count = evtimer_now_msec() >> COOKIE_COUNT_SHIFT;
+    uint8_t mss_idx = (iss >> 24) & 0x7;
+
+    if (mss_idx >= ARRAY_SIZE(_cookie_mss)) {
+        return 0;
+    }
+    /* Accept cookies of the current and the previous counter value */
+    for (uint32_t c = count - 1; c != count + 1; c++) {
+        if ((iss >> 27) == (c & COOKIE_COUNT_MASK) &&
+            _cookie(ip, hdr, irs, c, mss_idx) == iss) {
+            return _cookie_mss[mss_idx];
+        }
+    }
+    return 0;
+}
+#endif
+
+static int8_t _ll_iface(gnrc_pktsnip_t *pkt, const ipv6_addr_t *peer_addr)
+{
+    if (ipv6_addr_is_link_local(peer_addr)) {
+        gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_NETIF);
+
+        if (snp != NULL) {
+            return ((gnrc_netif_hdr_t *)snp->data)->if_pid;
+        }
+    }
+    return 0;
+}
+
+static _backlog_entry_t *_find(const ipv6_hdr_t *ip, const tcp_hdr_t *hdr)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_backlog); i++) {
+        _backlog_entry_t *entry = &_backlog[i];
+
+        if (entry->used &&
+            entry->local_port == byteorder_ntohs(hdr->dst_port) &&
+            entry->peer_port == byteorder_ntohs(hdr->src_port) &&
+            ipv6_addr_equal(&entry->peer_addr, &ip->src) &&
+            ipv6_addr_equal(&entry->local_addr, &ip->dst)) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static void _send(gnrc_pktsnip_t *pkt)
+{
+    if (!gnrc_netapi_dispatch_send(GNRC_NETTYPE_TCP, GNRC_NETREG_DEMUX_CTX_ALL, pkt)) {
+        gnrc_pktbuf_release(pkt);
+        TCP_DEBUG_ERROR("Can't dispatch to network layer.");
+    }
+}
+
+/* SYN+ACKs are rebuilt on each transmission instead of being kept in the
+ * packet buffer for retransmission */
+static void _send_syn_ack(const _backlog_entry_t *entry)
+{
+    gnrc_tcp_tcb_t *tcb = &_backlog_tcb;
+    gnrc_pktsnip_t *out_pkt = NULL;
+
+    memcpy(tcb->local_addr, &entry->local_addr, sizeof(ipv6_addr_t));
+    memcpy(tcb->peer_addr, &entry->peer_addr, sizeof(ipv6_addr_t));
+    tcb->ll_iface = entry->ll_iface;
+    tcb->local_port = entry->local_port;
+    tcb->peer_port = entry->peer_port;
+    tcb->rcv_wnd = entry->rcv_wnd;
+    tcb->rcv_buf_limit = entry->rcv_buf_limit;
+    tcb->options = entry->options;
+    tcb->rcv_wnd_scale = entry->rcv_wnd_scale;
+    tcb->ts_recent = entry->ts_recent;
+    if (_gnrc_tcp_pkt_build(tcb, &out_pkt, NULL, MSK_SYN_ACK, entry->iss, entry->irs + 1,
+                            NULL, 0) < 0) {
+        TCP_DEBUG_ERROR("Can't build SYN+ACK.");
+        return;
+    }
+    _send(out_pkt);
+}
+
+/* Schedules the timer for the next retransmission, handover or expiry */
+static void _sched(uint32_t now)
+{
+    int32_t next = INT32_MAX;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_backlog); i++) {
+        _backlog_entry_t *entry = &_backlog[i];
+
+        if (entry->used) {
+            int32_t due = entry->due - now;
+            int32_t expiry = entry->since + CONFIG_GNRC_TCP_CONNECTION_TIMEOUT_DURATION_MS - now;
+
+            next = MIN(next, MIN(due, expiry));
+        }
+    }
+    _gnrc_tcp_eventloop_unsched(&_backlog_timer);
+    if (next != INT32_MAX) {
+        _gnrc_tcp_eventloop_sched(&_backlog_timer, MAX(next, 0),
+                                  MSG_TYPE_BACKLOG_TIMEOUT, NULL);
+    }
+}
+
+/**
+ * @brief Searches a listening TCB for a connection.
+ *
+ * @param[in]  local_addr   Local address of the connection.
+ * @param[in]  local_port   Local port of the connection.
+ * @param[in]  peer_addr    Peer address of the connection.
+ * @param[in]  peer_port    Peer port of the connection.
+ * @param[out] lst          First TCB of the port in state LISTEN, NULL if all are busy.
+ * @param[out] tmpl         Any TCB listening on the port.
+ *
+ * @returns   True if a TCB listens on the port and no TCB handles the
+ *            connection itself.
+ */
+static bool _listener(const ipv6_addr_t *local_addr, uint16_t local_port,
+                      const ipv6_addr_t *peer_addr, uint16_t peer_port,
+                      gnrc_tcp_tcb_t **lst, gnrc_tcp_tcb_t **tmpl)
+{
+    _gnrc_tcp_common_tcb_list_t *list = _gnrc_tcp_common_get_tcb_list();
+    bool listening = false;
+
+    *lst = NULL;
+    *tmpl = NULL;
+    mutex_lock(&list->lock);
+    for (gnrc_tcp_tcb_t *tcb = list->head; tcb != NULL; tcb = tcb->next) {
+        if (tcb->address_family != AF_INET6 || tcb->local_port != local_port) {
+            continue;
+        }
+        if (tcb->peer_port == peer_port &&
+            ipv6_addr_equal((ipv6_addr_t *)tcb->peer_addr, peer_addr)) {
+            listening = false;
+            break;
+        }
+        if ((tcb->status & STATUS_LISTENING) &&
+            ((tcb->status & STATUS_ALLOW_ANY_ADDR) ||
+             ipv6_addr_equal((ipv6_addr_t *)tcb->local_addr, local_addr))) {
+            listening = true;
+            *tmpl = tcb;
+            if (*lst == NULL && _gnrc_tcp_fsm_get_state(tcb) == FSM_STATE_LISTEN) {
+                *lst = tcb;
+            }
+        }
+    }
+    mutex_unlock(&list->lock);
+    return listening;
+}
+
+/* Hands completed connections, oldest first, to listening TCBs */
+static void _handover(void)
+{
+    gnrc_tcp_tcb_t *lst;
+    gnrc_tcp_tcb_t *tmpl;
+
+    while (1) {
+        uint32_t now = evtimer_now_msec();
+        _backlog_entry_t *oldest = NULL;
+        _backlog_entry_t key;
+
+        mutex_lock(&_backlog_lock);
+        for (unsigned i = 0; i < ARRAY_SIZE(_backlog); i++) {
+            _backlog_entry_t *entry = &_backlog[i];
+
+            if (entry->used && entry->completed && (int32_t)(now - entry->due) >= 0 &&
+                (oldest == NULL || (int32_t)(entry->since - oldest->since) < 0)) {
+                oldest = entry;
+            }
+        }
+        if (oldest != NULL) {
+            /* Wait for the next kick if no TCB is available */
+            oldest->due = oldest->since + CONFIG_GNRC_TCP_CONNECTION_TIMEOUT_DURATION_MS;
+            key = *oldest;
+        }
+        mutex_unlock(&_backlog_lock);
+
+        if (oldest == NULL) {
+            break;
+        }
+        if (_listener(&key.local_addr, key.local_port, &key.peer_addr, key.peer_port,
+                      &lst, &tmpl) && lst != NULL) {
+            _gnrc_tcp_fsm(lst, FSM_EVENT_RCVD_BACKLOG_PKT, NULL, oldest, 0);
+        }
+    }
+}
+
+static void _syn(gnrc_pktsnip_t *pkt, const ipv6_hdr_t *ip, tcp_hdr_t *hdr,
+                 uint32_t wnd, uint32_t limit)
+{
+    gnrc_tcp_tcb_t *tcb = &_backlog_tcb;
+    _backlog_entry_t *entry = NULL;
+    _backlog_entry_t cookie;
+    _gnrc_tcp_option_seg_t opts;
+    uint32_t now = evtimer_now_msec();
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_backlog); i++) {
+        if (!_backlog[i].used) {
+            entry = &_backlog[i];
+            break;
+        }
+    }
+#if IS_USED(MODULE_GNRC_TCP_SYNCOOKIES)
+    /* Backlog is full: encode the connection in the ISS instead */
+    if (entry == NULL) {
+        entry = &cookie;
+    }
+#else
+    (void) cookie;
+    if (entry == NULL) {
+        TCP_DEBUG_INFO("Backlog is full, drop SYN.");
+        return;
+    }
+#endif
+
+    /* Negotiate options, assume our own MSS if the peer announces none */
+    tcb->state = FSM_STATE_LISTEN;
+    tcb->mss = CONFIG_GNRC_TCP_MSS;
+    tcb->rcv_buf_limit = limit;
+    if (_gnrc_tcp_option_parse(tcb, hdr, &opts) < 0) {
+        TCP_DEBUG_ERROR("Failed to parse TCP header options.");
+        return;
+    }
+
+    memcpy(&entry->local_addr, &ip->dst, sizeof(ipv6_addr_t));
+    memcpy(&entry->peer_addr, &ip->src, sizeof(ipv6_addr_t));
+    entry->irs = byteorder_ntohl(hdr->seq_num);
+    entry->snd_wnd = byteorder_ntohs(hdr->window);
+    entry->rcv_wnd = wnd;
+    entry->rcv_buf_limit = limit;
+    entry->ts_recent = tcb->ts_recent;
+    entry->since = now;
+    entry->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    entry->due = now + entry->rto;
+    entry->local_port = byteorder_ntohs(hdr->dst_port);
+    entry->peer_port = byteorder_ntohs(hdr->src_port);
+    entry->mss = tcb->mss;
+    entry->ll_iface = _ll_iface(pkt, &ip->src);
+    entry->options = tcb->options;
+    entry->snd_wnd_scale = tcb->snd_wnd_scale;
+    entry->rcv_wnd_scale = tcb->rcv_wnd_scale;
+    entry->completed = false;
+
+    if (entry != &cookie) {
+        entry->iss = random_uint32();
+        entry->used = true;
+        _sched(now);
+    }
+#if IS_USED(MODULE_GNRC_TCP_SYNCOOKIES)
+    else {
+        /* Options besides the MSS can not be restored from a cookie */
+        uint8_t mss_idx = 0;
+
+        while ((mss_idx + 1U < ARRAY_SIZE(_cookie_mss)) &&
+               (_cookie_mss[mss_idx + 1] <= entry->mss)) {
+            mss_idx++;
+        }
+        entry->options = 0;
+        entry->iss = _cookie(ip, hdr, entry->irs, now >> COOKIE_COUNT_SHIFT, mss_idx);
+        TCP_DEBUG_INFO("Backlog is full, send SYN cookie.");
+    }
+#endif
+    _send_syn_ack(entry);
+}
+
+int _gnrc_tcp_backlog_receive(gnrc_pktsnip_t *pkt)
+{
+    TCP_DEBUG_ENTER;
+    gnrc_pktsnip_t *ip_snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_IPV6);
+    gnrc_pktsnip_t *tcp_snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
+    gnrc_tcp_tcb_t *lst = NULL;
+    gnrc_tcp_tcb_t *tmpl = NULL;
+    bool valid = false;
+
+    if (ip_snp == NULL || tcp_snp == NULL) {
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+
+    ipv6_hdr_t *ip = ip_snp->data;
+    tcp_hdr_t *hdr = tcp_snp->data;
+    uint16_t ctl = byteorder_ntohs(hdr->off_ctl);
+
+    if (!_listener(&ip->dst, byteorder_ntohs(hdr->dst_port),
+                   &ip->src, byteorder_ntohs(hdr->src_port), &lst, &tmpl)) {
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+
+    mutex_lock(&_backlog_lock);
+    _backlog_entry_t *entry = _find(ip, hdr);
+
+    if (ctl & MSK_RST) {
+        /* Peer aborted its connection request */
+        if (entry != NULL && byteorder_ntohl(hdr->seq_num) == entry->irs + 1) {
+            entry->used = false;
+        }
+        mutex_unlock(&_backlog_lock);
+        TCP_DEBUG_LEAVE;
+        return 1;
+    }
+    if ((ctl & MSK_SYN_ACK) == MSK_SYN) {
+        /* Answer retransmitted SYNs with the SYN+ACK sent before. The
+         * receive buffer of the listening TCBs determines the window */
+        if (entry != NULL) {
+            _send_syn_ack(entry);
+        }
+        else {
+            _syn(pkt, ip, hdr, (tmpl->rcv_buf.size > 0) ? tmpl->rcv_buf.size
+                                                        : _gnrc_tcp_rcvbuf_limit(tmpl),
+                 tmpl->rcv_buf_limit);
+        }
+        mutex_unlock(&_backlog_lock);
+        TCP_DEBUG_LEAVE;
+        return 1;
+    }
+    if ((ctl & MSK_SYN_ACK) == MSK_ACK) {
+        if (entry != NULL) {
+            valid = (byteorder_ntohl(hdr->ack_num) == entry->iss + 1);
+        }
+#if IS_USED(MODULE_GNRC_TCP_SYNCOOKIES)
+        else {
+            valid = (_cookie_check(ip, hdr) > 0);
+        }
+#endif
+    }
+    mutex_unlock(&_backlog_lock);
+
+    /* Let the caller reset the connection on invalid acknowledgments */
+    if (!valid) {
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+
+    /* Handshake completed: hand the connection to a listening TCB ... */
+    if (lst != NULL && _gnrc_tcp_fsm(lst, FSM_EVENT_RCVD_BACKLOG_PKT, pkt, NULL, 0) != -EBUSY) {
+        TCP_DEBUG_LEAVE;
+        return 1;
+    }
+
+    /* ... or keep it until a TCB of the port listens again. Segments of the
+     * peer are dropped meanwhile, it retransmits them after the handover */
+    mutex_lock(&_backlog_lock);
+    entry = _find(ip, hdr);
+    if (entry == NULL) {
+        /* A connection encoded in a SYN cookie has no entry to wait in, let
+         * the caller reset it instead of silently dropping the handshake */
+        mutex_unlock(&_backlog_lock);
+        TCP_DEBUG_INFO("No listening TCB available for SYN cookie.");
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+    if (!entry->completed) {
+        entry->completed = true;
+        entry->snd_wnd = (uint32_t)byteorder_ntohs(hdr->window) << entry->snd_wnd_scale;
+        entry->due = entry->since + CONFIG_GNRC_TCP_CONNECTION_TIMEOUT_DURATION_MS;
+        _sched(evtimer_now_msec());
+    }
+    mutex_unlock(&_backlog_lock);
+    TCP_DEBUG_INFO("No listening TCB available, connection waits in backlog.");
+    TCP_DEBUG_LEAVE;
+    return 1;
+}
+
+int _gnrc_tcp_backlog_adopt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
+                            _gnrc_tcp_backlog_entry_t *entry)
+{
+    TCP_DEBUG_ENTER;
+    ipv6_hdr_t *ip = NULL;
+    tcp_hdr_t *hdr = NULL;
+    int ret = -ENOENT;
+
+    mutex_lock(&_backlog_lock);
+    if (pkt != NULL) {
+        ip = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_IPV6)->data;
+        hdr = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP)->data;
+        entry = _find(ip, hdr);
+        if (entry != NULL && byteorder_ntohl(hdr->ack_num) != entry->iss + 1) {
+            entry = NULL;
+        }
+    }
+    else if (!entry->used || !entry->completed) {
+        entry = NULL;
+    }
+
+    if (entry != NULL) {
+        memcpy(tcb->local_addr, &entry->local_addr, sizeof(ipv6_addr_t));
+        memcpy(tcb->peer_addr, &entry->peer_addr, sizeof(ipv6_addr_t));
+        tcb->ll_iface = entry->ll_iface;
+        tcb->local_port = entry->local_port;
+        tcb->peer_port = entry->peer_port;
+        tcb->iss = entry->iss;
+        tcb->irs = entry->irs;
+        tcb->snd_wnd = entry->snd_wnd;
+        tcb->mss = entry->mss;
+        tcb->options = entry->options;
+        tcb->snd_wnd_scale = entry->snd_wnd_scale;
+        tcb->rcv_wnd_scale = entry->rcv_wnd_scale;
+        tcb->ts_recent = entry->ts_recent;
+        entry->used = false;
+        _sched(evtimer_now_msec());
+        ret = 0;
+    }
+#if IS_USED(MODULE_GNRC_TCP_SYNCOOKIES)
+    else if (pkt != NULL && _find(ip, hdr) == NULL) {
+        uint16_t mss = _cookie_check(ip, hdr);
+
+        if (mss > 0) {
+            memcpy(tcb->local_addr, &ip->dst, sizeof(ipv6_addr_t));
+            memcpy(tcb->peer_addr, &ip->src, sizeof(ipv6_addr_t));
+            tcb->ll_iface = _ll_iface(pkt, &ip->src);
+            tcb->local_port = byteorder_ntohs(hdr->dst_port);
+            tcb->peer_port = byteorder_ntohs(hdr->src_port);
+            tcb->iss = byteorder_ntohl(hdr->ack_num) - 1;
+            tcb->irs = byteorder_ntohl(hdr->seq_num) - 1;
+            tcb->snd_wnd = byteorder_ntohs(hdr->window);
+            tcb->mss = mss;
+            tcb->options = 0;
+            tcb->snd_wnd_scale = 0;
+            tcb->rcv_wnd_scale = 0;
+            tcb->ts_recent = 0;
+            ret = 0;
+        }
+    }
+#endif
+    mutex_unlock(&_backlog_lock);
+
+    if (ret == 0) {
+        tcb->rcv_nxt = tcb->irs + 1;
+        /* SYN+ACK is acknowledged by pkt or was acknowledged before */
+        tcb->snd_una = (pkt != NULL) ? tcb->iss : tcb->iss + 1;
+        tcb->snd_nxt = tcb->iss + 1;
+        tcb->snd_wl1 = tcb->irs + 1;
+        tcb->snd_wl2 = tcb->iss + 1;
+    }
+    TCP_DEBUG_LEAVE;
+    return ret;
+}
+
+void _gnrc_tcp_backlog_kick(const gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    uint32_t now = evtimer_now_msec();
+    bool waiting = false;
+
+    /* Let the eventloop hand over connections that wait for this port */
+    mutex_lock(&_backlog_lock);
+    for (unsigned i = 0; i < ARRAY_SIZE(_backlog); i++) {
+        _backlog_entry_t *entry = &_backlog[i];
+
+        if (entry->used && entry->completed && entry->local_port == tcb->local_port) {
+            entry->due = now;
+            waiting = true;
+        }
+    }
+    if (waiting) {
+        _sched(now);
+    }
+    mutex_unlock(&_backlog_lock);
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_backlog_flush(uint16_t port)
+{
+    TCP_DEBUG_ENTER;
+    mutex_lock(&_backlog_lock);
+    for (unsigned i = 0; i < ARRAY_SIZE(_backlog); i++) {
+        if (_backlog[i].used && _backlog[i].local_port == port) {
+            _backlog[i].used = false;
+        }
+    }
+    mutex_unlock(&_backlog_lock);
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_backlog_timeout(void)
+{
+    TCP_DEBUG_ENTER;
+    uint32_t now = evtimer_now_msec();
+
+    mutex_lock(&_backlog_lock);
+    for (unsigned i = 0; i < ARRAY_SIZE(_backlog); i++) {
+        _backlog_entry_t *entry = &_backlog[i];
+
+        if (!entry->used) {
+            continue;
+        }
+        if ((now - entry->since) >= CONFIG_GNRC_TCP_CONNECTION_TIMEOUT_DURATION_MS) {
+            TCP_DEBUG_INFO("Connection request expired.");
+            entry->used = false;
+        }
+        else if (!entry->completed && (int32_t)(now - entry->due) >= 0) {
+            _send_syn_ack(entry);
+            entry->rto = MIN(entry->rto << 1, CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS);
+            entry->due = now + entry->rto;
+        }
+    }
+    mutex_unlock(&_backlog_lock);
+
+    _handover();
+
+    mutex_lock(&_backlog_lock);
+    _sched(evtimer_now_msec());
+    mutex_unlock(&_backlog_lock);
+    TCP_DEBUG_LEAVE;
+}
+
+/** @} */
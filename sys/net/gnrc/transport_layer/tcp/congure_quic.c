@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief   QUIC congestion control for GNRC TCP
+ */
+
+#include "kernel_defines.h"
+#include "mutex.h"
+#include "congure/quic.h"
+#include "net/gnrc/tcp/config.h"
+
+#include "net/gnrc/tcp/congestion.h"
+
+/* initial window as of RFC 9002, section 7.2 */
+#if (10U * CONFIG_GNRC_TCP_MSS) > 14720U
+#define TCP_CONGURE_QUIC_INIT_WND   ((2U * CONFIG_GNRC_TCP_MSS) > 14720U \
+                                     ? (2U * CONFIG_GNRC_TCP_MSS) : 14720U)
+#else
+#define TCP_CONGURE_QUIC_INIT_WND   (10U * CONFIG_GNRC_TCP_MSS)
+#endif
+
+static mutex_t _tcp_congures_quic_lock = MUTEX_INIT;
+static congure_quic_snd_t _tcp_congures_quic[CONFIG_GNRC_TCP_CONNECTIONS_MAX];
+static const congure_quic_snd_consts_t _tcp_congure_quic_consts = {
+    /* cong_event_cb to resend a segment is not needed since GNRC TCP resends
+     * the oldest segment itself when reporting it as lost or timed out */
+    .init_wnd = TCP_CONGURE_QUIC_INIT_WND,
+    .min_wnd = 2U * CONFIG_GNRC_TCP_MSS,
+    .init_rtt = 333U,
+    .max_msg_size = CONFIG_GNRC_TCP_MSS,
+    .pc_thresh = 3000,
+    .granularity = CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
+    .loss_reduction_numerator = 1,
+    .loss_reduction_denominator = 2,
+    .inter_msg_interval_numerator = 5,
+    .inter_msg_interval_denominator = 4,
+};
+
+congure_snd_t *gnrc_tcp_congure_snd_get(void)
+{
+    congure_snd_t *res = NULL;
+
+    mutex_lock(&_tcp_congures_quic_lock);
+    for (unsigned i = 0; i < ARRAY_SIZE(_tcp_congures_quic); i++) {
+        if (_tcp_congures_quic[i].super.driver == NULL) {
+            congure_quic_snd_setup(&_tcp_congures_quic[i],
+                                   &_tcp_congure_quic_consts);
+            res = &_tcp_congures_quic[i].super;
+            break;
+        }
+    }
+    mutex_unlock(&_tcp_congures_quic_lock);
+    return res;
+}
+
+/** @} */
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief   TCP Reno (and ABE) congestion control for GNRC TCP
+ */
+
+#include "kernel_defines.h"
+#include "mutex.h"
+#include "congure/abe.h"
+#include "congure/reno.h"
+#include "net/gnrc/tcp/config.h"
+#include "net/gnrc/tcp/tcb.h"
+
+#include "net/gnrc/tcp/congestion.h"
+
+#if IS_USED(MODULE_CONGURE_ABE)
+typedef congure_abe_snd_t _tcp_congure_snd_t;
+#else
+typedef congure_reno_snd_t _tcp_congure_snd_t;
+#endif
+
+/* initial window bounds and slow start threshold as of RFC 5681, section 3.1 */
+#define TCP_CONGURE_RENO_CONSTS { \
+        .fr = _fr, \
+        .same_wnd_adv = _same_wnd_adv, \
+        .init_mss = CONFIG_GNRC_TCP_MSS, \
+        .cwnd_lower = 1095U, \
+        .cwnd_upper = 2190U, \
+        .init_ssthresh = CONGURE_WND_SIZE_MAX, \
+        .frthresh = 3U, \
+    }
+
+static void _fr(congure_reno_snd_t *c);
+static bool _same_wnd_adv(congure_reno_snd_t *c, congure_snd_ack_t *ack);
+
+static mutex_t _tcp_congures_lock = MUTEX_INIT;
+static _tcp_congure_snd_t _tcp_congures[CONFIG_GNRC_TCP_CONNECTIONS_MAX];
+#if IS_USED(MODULE_CONGURE_ABE)
+static const congure_abe_snd_consts_t _tcp_congure_abe_consts = {
+    .reno = TCP_CONGURE_RENO_CONSTS,
+    .abe_multiplier_numerator = CONFIG_CONGURE_ABE_MULTIPLIER_NUMERATOR_DEFAULT,
+    .abe_multiplier_denominator = CONFIG_CONGURE_ABE_MULTIPLIER_DENOMINATOR_DEFAULT,
+};
+#else
+static const congure_reno_snd_consts_t _tcp_congure_reno_consts = TCP_CONGURE_RENO_CONSTS;
+#endif
+
+congure_snd_t *gnrc_tcp_congure_snd_get(void)
+{
+    congure_snd_t *res = NULL;
+
+    mutex_lock(&_tcp_congures_lock);
+    for (unsigned i = 0; i < ARRAY_SIZE(_tcp_congures); i++) {
+        if (_tcp_congures[i].super.driver == NULL) {
+#if IS_USED(MODULE_CONGURE_ABE)
+            congure_abe_snd_setup(&_tcp_congures[i],
+                                  &_tcp_congure_abe_consts);
+#else
+            congure_reno_snd_setup(&_tcp_congures[i],
+                                   &_tcp_congure_reno_consts);
+#endif
+            res = &_tcp_congures[i].super;
+            break;
+        }
+    }
+    mutex_unlock(&_tcp_congures_lock);
+    return res;
+}
+
+static void _fr(congure_reno_snd_t *c)
+{
+    (void)c;
+    /* GNRC TCP counts duplicate ACKs itself and resends the oldest segment
+     * when it reports it as lost, so do nothing */
+    return;
+}
+
+static bool _same_wnd_adv(congure_reno_snd_t *c, congure_snd_ack_t *ack)
+{
+    gnrc_tcp_tcb_t *tcb = c->super.ctx;
+
+    return tcb->snd_wnd == ack->wnd;
+}
+
+/** @} */
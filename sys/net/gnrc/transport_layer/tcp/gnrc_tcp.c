@@ -31,6 +31,7 @@
 #include "net/gnrc/netif.h"
 #include "net/gnrc/tcp.h"
 #include "net/sock.h"
+#include "include/gnrc_tcp_backlog.h"
 #include "include/gnrc_tcp_common.h"
 #include "include/gnrc_tcp_fsm.h"
 #include "include/gnrc_tcp_pkt.h"
@@ -335,9 +336,39 @@ void gnrc_tcp_tcb_queue_init(gnrc_tcp_tcb_queue_t *queue)
     mutex_init(&queue->lock);
     queue->tcbs = NULL;
     queue->tcbs_len = 0;
+#if defined(SOCK_HAS_ASYNC) && defined(MODULE_SOCK_TCP)
+    queue->async_cb = NULL;
+    queue->async_cb_arg = NULL;
+#endif
     TCP_DEBUG_LEAVE;
 }
 
+int gnrc_tcp_tcb_set_rcv_buf_size(gnrc_tcp_tcb_t *tcb, size_t size)
+{
+    TCP_DEBUG_ENTER;
+    assert(tcb != NULL);
+
+    int ret = 0;
+
+    if ((size == 0) || (size > CONFIG_GNRC_TCP_RCV_BUF_POOL_SIZE)) {
+        TCP_DEBUG_ERROR("-EINVAL: Invalid receive buffer size.");
+        TCP_DEBUG_LEAVE;
+        return -EINVAL;
+    }
+
+    mutex_lock(&(tcb->function_lock));
+    if (_gnrc_tcp_fsm_get_state(tcb) != FSM_STATE_CLOSED) {
+        TCP_DEBUG_ERROR("-EISCONN: TCB already in use.");
+        ret = -EISCONN;
+    }
+    else {
+        tcb->rcv_buf_limit = size;
+    }
+    mutex_unlock(&(tcb->function_lock));
+    TCP_DEBUG_LEAVE;
+    return ret;
+}
+
 int gnrc_tcp_open(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *remote, uint16_t local_port)
 {
     /* Sanity checking */
@@ -528,6 +559,9 @@ int gnrc_tcp_listen(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t *tcbs, size_t tc
 #endif
             tcb->local_port = local->port;
             tcb->status |= STATUS_LISTENING;
+#if defined(SOCK_HAS_ASYNC) && defined(MODULE_SOCK_TCP)
+            tcb->queue = queue;
+#endif
 
             /* Open connection */
             ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_OPEN, NULL, NULL, 0);
@@ -725,8 +759,8 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                     MSG_TYPE_USER_SPEC_TIMEOUT, &mbox);
     }
 
-    /* Loop until something was sent and acked */
-    while (ret == 0 || tcb->pkt_retransmit != NULL) {
+    /* Loop until something was queued for transmission */
+    while (ret == 0) {
         state = _gnrc_tcp_fsm_get_state(tcb);
 
         /* Check if the connections state is closed. If so, a reset was received */
@@ -749,9 +783,13 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                         MSG_TYPE_PROBE_TIMEOUT, &mbox);
         }
 
-        /* Try to send data in case there nothing has been sent and we are not probing */
-        if (ret == 0 && !probing_mode) {
+        /* Try to send data in case we are not probing. Return as soon as
+         * something was queued, the retransmission mechanism takes over. */
+        if (!probing_mode) {
             ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (void *) data, len);
+            if (ret > 0) {
+                break;
+            }
         }
 
         /* Wait for responses */
@@ -815,13 +853,21 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
     return ret;
 }
 
-ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
-                      const uint32_t timeout_duration_ms)
+/**
+ * @brief Common implementation of gnrc_tcp_recv() and gnrc_tcp_recv_buf().
+ *
+ * @param[in,out] tcb                   TCB holding the connection information.
+ * @param[in]     event                 FSM event reading the received data.
+ * @param[out]    data                  Buffer passed to the FSM event.
+ * @param[in]     max_len               Maximum amount of bytes to read.
+ * @param[in]     timeout_duration_ms   Timeout for receive in milliseconds.
+ *
+ * @returns   See gnrc_tcp_recv().
+ */
+static ssize_t _recv(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event, void *data,
+                     const size_t max_len, const uint32_t timeout_duration_ms)
 {
     TCP_DEBUG_ENTER;
-    assert(tcb != NULL);
-    assert(data != NULL);
-
     msg_t msg;
     msg_t msg_queue[TCP_MSG_QUEUE_SIZE];
     mbox_t mbox = MBOX_INIT(msg_queue, TCP_MSG_QUEUE_SIZE);
@@ -852,7 +898,7 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
     /* If FIN was received (CLOSE_WAIT), no further data can be received. */
     /* Copy received data into given buffer and return number of bytes. Can be zero. */
     if (state == FSM_STATE_CLOSE_WAIT) {
-        ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_RECV, NULL, data, max_len);
+        ret = _gnrc_tcp_fsm(tcb, event, NULL, data, max_len);
         mutex_unlock(&(tcb->function_lock));
         TCP_DEBUG_LEAVE;
         return ret;
@@ -860,7 +906,7 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
 
     /* If this call is non-blocking (timeout_duration_ms == 0): Try to read data and return */
     if (timeout_duration_ms == 0) {
-        ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_RECV, NULL, data, max_len);
+        ret = _gnrc_tcp_fsm(tcb, event, NULL, data, max_len);
         if (ret == 0) {
             TCP_DEBUG_ERROR("-EAGAIN: Not data available, try later again.");
             ret = -EAGAIN;
@@ -892,7 +938,7 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
         }
 
         /* Try to read available data */
-        ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_RECV, NULL, data, max_len);
+        ret = _gnrc_tcp_fsm(tcb, event, NULL, data, max_len);
 
         /* If FIN was received (CLOSE_WAIT), no further data can be received. Leave event loop */
         if (state == FSM_STATE_CLOSE_WAIT) {
@@ -936,6 +982,41 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
     return ret;
 }
 
+ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
+                      const uint32_t timeout_duration_ms)
+{
+    TCP_DEBUG_ENTER;
+    assert(tcb != NULL);
+    assert(data != NULL);
+
+    ssize_t ret = _recv(tcb, FSM_EVENT_CALL_RECV, data, max_len, timeout_duration_ms);
+    TCP_DEBUG_LEAVE;
+    return ret;
+}
+
+ssize_t gnrc_tcp_recv_buf(gnrc_tcp_tcb_t *tcb, void **data, const size_t max_len,
+                          const uint32_t timeout_duration_ms)
+{
+    TCP_DEBUG_ENTER;
+    assert(tcb != NULL);
+    assert(data != NULL);
+
+    ssize_t ret = _recv(tcb, FSM_EVENT_CALL_RECV_BUF, data, max_len, timeout_duration_ms);
+    TCP_DEBUG_LEAVE;
+    return ret;
+}
+
+void gnrc_tcp_recv_buf_consume(gnrc_tcp_tcb_t *tcb, size_t len)
+{
+    TCP_DEBUG_ENTER;
+    assert(tcb != NULL);
+
+    mutex_lock(&(tcb->function_lock));
+    _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_RECV_CONSUME, NULL, NULL, len);
+    mutex_unlock(&(tcb->function_lock));
+    TCP_DEBUG_LEAVE;
+}
+
 void gnrc_tcp_close(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
@@ -978,6 +1059,13 @@ void gnrc_tcp_stop_listen(gnrc_tcp_tcb_queue_t *queue)
         mutex_unlock(&(tcb->function_lock));
     }
 
+#if IS_USED(MODULE_GNRC_TCP_BACKLOG)
+    /* Drop connection requests nobody is going to accept */
+    if (queue->tcbs_len > 0) {
+        _gnrc_tcp_backlog_flush(queue->tcbs[0].local_port);
+    }
+#endif
+
     /* Cleanup */
     queue->tcbs = NULL;
     queue->tcbs_len = 0;
@@ -23,6 +23,7 @@
 #include "net/af.h"
 #include "net/tcp.h"
 #include "net/gnrc.h"
+#include "include/gnrc_tcp_backlog.h"
 #include "include/gnrc_tcp_common.h"
 #include "include/gnrc_tcp_pkt.h"
 #include "include/gnrc_tcp_fsm.h"
@@ -207,6 +208,15 @@ static int _receive(gnrc_pktsnip_t *pkt)
 #endif
     }
 
+#if IS_USED(MODULE_GNRC_TCP_BACKLOG)
+    /* Connection requests to listening ports are answered by the backlog */
+    if (syn && _gnrc_tcp_backlog_receive(pkt) > 0) {
+        gnrc_pktbuf_release(pkt);
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+#endif
+
     /* Find TCB to for this packet */
     _gnrc_tcp_common_tcb_list_t *list = _gnrc_tcp_common_get_tcb_list();
     mutex_lock(&list->lock);
@@ -256,6 +266,14 @@ static int _receive(gnrc_pktsnip_t *pkt)
     }
     /* No fitting TCB has been found. Respond with reset */
     else {
+#if IS_USED(MODULE_GNRC_TCP_BACKLOG)
+        /* ... unless the packet completes a handshake of the backlog */
+        if (_gnrc_tcp_backlog_receive(pkt) > 0) {
+            gnrc_pktbuf_release(pkt);
+            TCP_DEBUG_LEAVE;
+            return 0;
+        }
+#endif
         if ((ctl & MSK_RST) != MSK_RST) {
             _gnrc_tcp_pkt_build_reset_from_pkt(&reset, pkt);
             if (gnrc_netapi_send(_tcp_eventloop_pid, reset) < 1) {
@@ -340,6 +358,14 @@ static void *_eventloop(__attribute__((unused)) void *arg)
                               FSM_EVENT_CALL_OPEN, NULL, NULL, 0);
                 break;
 
+#if IS_USED(MODULE_GNRC_TCP_BACKLOG)
+            /* Retransmit SYN+ACKs and drop expired connection requests of the backlog */
+            case MSG_TYPE_BACKLOG_TIMEOUT:
+                TCP_DEBUG_INFO("Received MSG_TYPE_BACKLOG_TIMEOUT.");
+                _gnrc_tcp_backlog_timeout();
+                break;
+#endif
+
             default:
                 TCP_DEBUG_ERROR("Received unexpected message.");
         }
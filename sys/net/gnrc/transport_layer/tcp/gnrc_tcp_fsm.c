@@ -20,10 +20,13 @@
 #include <utlist.h>
 #include <errno.h>
 #include "random.h"
+#include "macros/utils.h"
 #include "net/af.h"
 #include "net/gnrc.h"
+#include "net/gnrc/tcp/congestion.h"
 #include "evtimer.h"
 #include "evtimer_msg.h"
+#include "include/gnrc_tcp_backlog.h"
 #include "include/gnrc_tcp_common.h"
 #include "include/gnrc_tcp_eventloop.h"
 #include "include/gnrc_tcp_pkt.h"
@@ -92,11 +95,7 @@ static uint16_t _get_random_local_port(void)
 static int _clear_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
-        _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
-    }
+    _gnrc_tcp_pkt_clear_retransmit(tcb);
     TCP_DEBUG_LEAVE;
     return 0;
 }
@@ -161,6 +160,10 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
 
                 /* Free potentially allocated receive buffer */
                 _gnrc_tcp_rcvbuf_release_buffer(tcb);
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+                gnrc_tcp_congure_snd_free(tcb->congure);
+                tcb->congure = NULL;
+#endif
                 TCP_DEBUG_INFO("Connection closed");
             }
             /* Re-open connection as listenng */
@@ -195,6 +198,10 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
                 LL_PREPEND(list->head, tcb);
             }
             mutex_unlock(&list->lock);
+#if IS_USED(MODULE_GNRC_TCP_BACKLOG)
+            /* Fetch the next connection waiting in the backlog */
+            _gnrc_tcp_backlog_kick(tcb);
+#endif
             break;
 
         case FSM_STATE_SYN_SENT:
@@ -237,6 +244,13 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             if (tcb->status & STATUS_LISTENING) {
                 _gnrc_tcp_eventloop_unsched(&tcb->event_timeout);
             }
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+            /* Start congestion control from scratch for each new connection */
+            if ((tcb->state == FSM_STATE_SYN_SENT || tcb->state == FSM_STATE_SYN_RCVD) &&
+                tcb->congure != NULL) {
+                tcb->congure->driver->init(tcb->congure, tcb);
+            }
+#endif
             tcb->status |= STATUS_NOTIFY_USER;
             break;
 
@@ -273,7 +287,20 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
         return -ENOMEM;
     }
 
-    tcb->rcv_wnd = CONFIG_GNRC_TCP_DEFAULT_WINDOW;
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+    /* Allocate congestion control state */
+    if (tcb->congure == NULL) {
+        tcb->congure = gnrc_tcp_congure_snd_get();
+        if (tcb->congure == NULL) {
+            _gnrc_tcp_rcvbuf_release_buffer(tcb);
+            TCP_DEBUG_ERROR("-ENOMEM: Can't allocate congestion control state.");
+            TCP_DEBUG_LEAVE;
+            return -ENOMEM;
+        }
+    }
+#endif
+
+    tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
 
     if (tcb->status & STATUS_LISTENING) {
         /* Passive open, T: CLOSED -> LISTEN */
@@ -308,6 +335,9 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
 /**
  * @brief FSM Handling function for sending data.
  *
+ * @note Sends segments until @p len bytes were sent, the retransmission queue
+ *       is full or the send window is exhausted.
+ *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in,out] buf   Buffer containing data to send.
  * @param[in]     len   Maximum Number of Bytes to send from @p buf.
@@ -317,27 +347,81 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
 static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     TCP_DEBUG_ENTER;
-    size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
+    size_t sent = 0;
+    uint32_t wnd = tcb->snd_wnd;
+    uint32_t seg_max = (tcb->mss < CONFIG_GNRC_TCP_MSS) ? tcb->mss : CONFIG_GNRC_TCP_MSS;
+
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+    /* Send window is the minimum of peer window and congestion window */
+    if (tcb->congure != NULL && tcb->congure->cwnd < wnd) {
+        wnd = tcb->congure->cwnd;
+    }
+#endif
 
-    /* Check if window is open and all packets were transmitted */
-    if (payload > 0 && tcb->snd_wnd > 0 && tcb->pkt_retransmit == NULL) {
-        /* Calculate segment size */
-        payload = (payload < CONFIG_GNRC_TCP_MSS) ? payload : CONFIG_GNRC_TCP_MSS;
-        payload = (payload < tcb->mss) ? payload : tcb->mss;
-        payload = (payload < len) ? payload : len;
+    while (sent < len && tcb->rtx_len < CONFIG_GNRC_TCP_SND_QUEUE_SIZE) {
+        uint32_t in_flight = tcb->snd_nxt - tcb->snd_una;
+
+        /* Check if window is open */
+        if (in_flight >= wnd) {
+            break;
+        }
 
         /* Calculate payload size for this segment */
+        size_t payload = wnd - in_flight;
+        payload = (payload < seg_max) ? payload : seg_max;
+        payload = (payload < (len - sent)) ? payload : (len - sent);
+
+        /* Avoid sending small segments while data is unacknowledged
+         * (RFC 1122, section 4.2.3.4) */
+        if (payload < seg_max && in_flight > 0) {
+            break;
+        }
+
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
-        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
-                            tcb->snd_nxt, tcb->rcv_nxt, buf, payload);
-        _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
+        if (_gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
+                                tcb->snd_nxt, tcb->rcv_nxt,
+                                (uint8_t *)buf + sent, payload) < 0) {
+            break;
+        }
+        if (_gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false) < 0) {
+            gnrc_pktbuf_release(out_pkt);
+            break;
+        }
         _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
-        TCP_DEBUG_LEAVE;
-        return payload;
+        sent += payload;
     }
     TCP_DEBUG_LEAVE;
-    return 0;
+    return sent;
+}
+
+/**
+ * @brief Update the receive window after the user consumed received data.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _rcv_wnd_update(gnrc_tcp_tcb_t *tcb)
+{
+    /* Give receive buffer auto-tuning a chance to grow the buffer */
+    _gnrc_tcp_rcvbuf_adjust(tcb);
+
+    /* Hold back window updates until the receive buffer was shrunk */
+    if (tcb->status & STATUS_RCV_BUF_SHRINK) {
+        return;
+    }
+
+    /* If receive buffer can store more than CONFIG_GNRC_TCP_MSS or half of its size
+     * (RFC 1122, section 4.2.3.3): set window to free buffer size */
+    if (ringbuffer_get_free(&tcb->rcv_buf) >= MIN(CONFIG_GNRC_TCP_MSS, tcb->rcv_buf.size / 2)) {
+        tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
+
+        /* Send ACK to announce window update */
+        gnrc_pktsnip_t *out_pkt = NULL;
+        uint16_t seq_con = 0;
+        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
+                            tcb->rcv_nxt, NULL, 0);
+        _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+    }
 }
 
 /**
@@ -361,19 +445,55 @@ static int _fsm_call_recv(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
     /* Read data into 'buf' up to 'len' bytes from receive buffer */
     size_t rcvd = ringbuffer_get(&(tcb->rcv_buf), buf, len);
 
-    /* If receive buffer can store more than CONFIG_GNRC_TCP_MSS: set window to free buffer size */
-    if (ringbuffer_get_free(&tcb->rcv_buf) >= CONFIG_GNRC_TCP_MSS) {
-        tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
+    _rcv_wnd_update(tcb);
+    TCP_DEBUG_LEAVE;
+    return rcvd;
+}
 
-        /* Send ACK to announce window update */
-        gnrc_pktsnip_t *out_pkt = NULL;
-        uint16_t seq_con = 0;
-        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
-                            tcb->rcv_nxt, NULL, 0);
-        _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+/**
+ * @brief FSM handling function for accessing received data in place.
+ *
+ * @param[in,out] tcb    TCB holding the connection information.
+ * @param[out]    data   Set to the oldest received byte in the receive buffer.
+ * @param[in]     len    Maximum number of bytes to access.
+ *
+ * @returns   Number of contiguous bytes behind @p data.
+ */
+static int _fsm_call_recv_buf(gnrc_tcp_tcb_t *tcb, void **data, size_t len)
+{
+    TCP_DEBUG_ENTER;
+    ringbuffer_t *rb = &(tcb->rcv_buf);
+
+    if (ringbuffer_empty(rb)) {
+        TCP_DEBUG_LEAVE;
+        return 0;
     }
+
+    /* Data wrapping around the end of the ring is returned by the next call */
+    len = MIN(len, MIN(rb->avail, rb->size - rb->start));
+    *data = &(rb->buf[rb->start]);
     TCP_DEBUG_LEAVE;
-    return rcvd;
+    return len;
+}
+
+/**
+ * @brief FSM handling function for releasing data accessed in place.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     len   Number of bytes to release.
+ *
+ * @returns   Number of released bytes.
+ */
+static int _fsm_call_recv_consume(gnrc_tcp_tcb_t *tcb, size_t len)
+{
+    TCP_DEBUG_ENTER;
+    size_t consumed = ringbuffer_remove(&(tcb->rcv_buf), len);
+
+    if (consumed) {
+        _rcv_wnd_update(tcb);
+    }
+    TCP_DEBUG_LEAVE;
+    return consumed;
 }
 
 /**
@@ -463,13 +583,14 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     uint32_t seg_seq = 0;            /* Sequence number of the incoming packet*/
     uint32_t seg_ack = 0;            /* Acknowledgment number of the incoming packet */
     uint32_t seg_wnd = 0;            /* Receive window of the incoming packet */
+    _gnrc_tcp_option_seg_t opts;     /* Options of the incoming packet */
 
     /* Search for TCP header. */
     snp = gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_TCP);
     tcp_hdr_t *tcp_hdr = (tcp_hdr_t *) snp->data;
 
     /* Parse packet options, return if they are malformed */
-    if (_gnrc_tcp_option_parse(tcb, tcp_hdr) < 0) {
+    if (_gnrc_tcp_option_parse(tcb, tcp_hdr, &opts) < 0) {
         TCP_DEBUG_ERROR("Failed to parse TCP header options.");
         TCP_DEBUG_LEAVE;
         return 0;
@@ -480,6 +601,9 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     seg_seq = byteorder_ntohl(tcp_hdr->seq_num);
     seg_ack = byteorder_ntohl(tcp_hdr->ack_num);
     seg_wnd = byteorder_ntohs(tcp_hdr->window);
+    if (!(ctl & MSK_SYN)) {
+        seg_wnd <<= tcb->snd_wnd_scale;
+    }
 
     /* Extract network layer header */
 #ifdef MODULE_GNRC_IPV6
@@ -615,7 +739,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             tcb->irs = seg_seq;
             if (ctl & MSK_ACK) {
                 tcb->snd_una = seg_ack;
-                _gnrc_tcp_pkt_acknowledge(tcb, seg_ack);
+                _gnrc_tcp_pkt_acknowledge(tcb, seg_ack, &opts);
             }
             /* Set local network layer address accordingly */
 #ifdef MODULE_GNRC_IPV6
@@ -654,8 +778,10 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     else {
         uint32_t seg_len = _gnrc_tcp_pkt_get_seg_len(in_pkt);
         uint32_t pay_len = _gnrc_tcp_pkt_get_pay_len(in_pkt);
-        /* 1) Verify sequence number ... */
-        if (_gnrc_tcp_pkt_chk_seq_num(tcb, seg_seq, pay_len)) {
+        /* 1) Verify sequence number and timestamp (RFC 7323, section 5.3) ... */
+        if (_gnrc_tcp_pkt_chk_seq_num(tcb, seg_seq, pay_len) ||
+            ((tcb->options & OPTION_TS) && opts.has_ts && !(ctl & MSK_RST) &&
+             LSS_32_BIT(opts.ts_val, tcb->ts_recent))) {
             /* ... if invalid, and RST not set, reply with pure ACK, return */
             if ((ctl & MSK_RST) != MSK_RST) {
                 _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK,
@@ -665,6 +791,11 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             TCP_DEBUG_LEAVE;
             return 0;
         }
+        /* Remember timestamp to echo, if the segment is not beyond the left
+         * window edge (RFC 7323, section 4.3) */
+        if ((tcb->options & OPTION_TS) && opts.has_ts && LEQ_32_BIT(seg_seq, tcb->rcv_nxt)) {
+            tcb->ts_recent = opts.ts_val;
+        }
         /* 2) Check RST: If RST is set ... */
         if (ctl & MSK_RST) {
             /* .. and state is SYN_RCVD and the connection is passive: SYN_RCVD -> LISTEN */
@@ -710,10 +841,32 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             if (tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_FIN_WAIT_1 ||
                 tcb->state == FSM_STATE_FIN_WAIT_2 || tcb->state == FSM_STATE_CLOSE_WAIT ||
                 tcb->state == FSM_STATE_CLOSING || tcb->state == FSM_STATE_LAST_ACK) {
+                /* Mark selectively acknowledged segments */
+                if ((tcb->options & OPTION_SACK_PERM) && opts.sack_num > 0) {
+                    _gnrc_tcp_pkt_sack(tcb, &opts);
+                }
                 /* Acknowledge previously sent data */
                 if (LSS_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
                     tcb->snd_una = seg_ack;
-                    _gnrc_tcp_pkt_acknowledge(tcb, seg_ack);
+                    tcb->dup_acks = 0;
+                    if (_gnrc_tcp_pkt_acknowledge(tcb, seg_ack, &opts) > 0) {
+                        /* Signal user after retransmission queue space was freed */
+                        tcb->status |= STATUS_NOTIFY_USER;
+                    }
+                }
+                /* Duplicate ACK (RFC 5681, section 2): Fast retransmit on threshold */
+                else if (seg_ack == tcb->snd_una && pay_len == 0 && tcb->rtx_len > 0 &&
+                         !(ctl & (MSK_SYN | MSK_FIN)) && seg_wnd == tcb->snd_wnd) {
+                    if (tcb->dup_acks < UINT8_MAX) {
+                        tcb->dup_acks += 1;
+                    }
+                    if (tcb->dup_acks == DUP_ACK_THRESHOLD) {
+                        _gnrc_tcp_pkt_fast_retransmit(tcb);
+                    }
+                    /* Resend further holes reported by SACK blocks */
+                    else if (tcb->dup_acks > DUP_ACK_THRESHOLD) {
+                        _gnrc_tcp_pkt_sack_retransmit(tcb);
+                    }
                 }
                 /* ACK received for something not yet sent: Reply with pure ACK */
                 else if (LSS_32_BIT(tcb->snd_nxt, seg_ack)) {
@@ -738,25 +891,25 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Additional processing */
                 /* Check additionally if previously sent FIN was acknowledged */
                 if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         _transition_to(tcb, FSM_STATE_FIN_WAIT_2);
                     }
                 }
                 /* If retransmission queue is empty, acknowledge close operation */
                 if (tcb->state == FSM_STATE_FIN_WAIT_2) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         /* Optional: Unblock user close operation */
                     }
                 }
                 /* If our FIN has been acknowledged: Transition to TIME_WAIT */
                 if (tcb->state == FSM_STATE_CLOSING) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         _transition_to(tcb, FSM_STATE_TIME_WAIT);
                     }
                 }
                 /* If our FIN was acknowledged and status is LAST_ACK: close connection */
                 if (tcb->state == FSM_STATE_LAST_ACK) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         _transition_to(tcb, FSM_STATE_CLOSED);
                         TCP_DEBUG_LEAVE;
                         return 0;
@@ -777,13 +930,27 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
 
                 /* Accept only data that is expected, to be received */
                 if (tcb->rcv_nxt == seg_seq) {
+                    uint32_t added = 0;
+
                     /* Copy contents into receive buffer */
                     while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
-                        tcb->rcv_nxt += ringbuffer_add(&(tcb->rcv_buf), snp->data, snp->size);
+                        added += ringbuffer_add(&(tcb->rcv_buf), snp->data, snp->size);
                         snp = snp->next;
                     }
-                    /* Shrink receive window */
-                    tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
+                    tcb->rcv_nxt += added;
+                    /* Shrink receive window, without reopening it while the
+                     * receive buffer waits to be shrunk */
+                    if (tcb->status & STATUS_RCV_BUF_SHRINK) {
+                        tcb->rcv_wnd -= MIN(added, tcb->rcv_wnd);
+                    }
+                    else {
+                        tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
+                    }
+                    /* Note that the peer was limited by the receive buffer */
+                    if ((tcb->rcv_wnd < CONFIG_GNRC_TCP_MSS) &&
+                        (tcb->rcv_buf.avail >= CONFIG_GNRC_TCP_MSS)) {
+                        tcb->status |= STATUS_RCV_BUF_FULL;
+                    }
                     /* Notify owner because new data is available */
                     tcb->status |= STATUS_NOTIFY_USER;
                 }
@@ -813,7 +980,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 _transition_to(tcb, FSM_STATE_CLOSE_WAIT);
             }
             else if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                if (tcb->pkt_retransmit == NULL) {
+                if (tcb->rtx_len == 0) {
                     _transition_to(tcb, FSM_STATE_TIME_WAIT);
                 }
                 else {
@@ -832,6 +999,54 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     return 0;
 }
 
+/**
+ * @brief FSM handling function for taking over a connection from the backlog.
+ *
+ * @param[in,out] tcb      Listening TCB taking over the connection.
+ * @param[in]     in_pkt   Packet completing the handshake or NULL.
+ * @param[in]     entry    Connection completed in the backlog, if @p in_pkt is NULL.
+ *
+ * @returns   Zero on success.
+ *            -EBUSY if @p tcb is not listening.
+ *            -ENOENT if the backlog holds no matching connection.
+ *            -EOPNOTSUPP if module gnrc_tcp_backlog is not used.
+ */
+static int _fsm_rcvd_backlog_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt, void *entry)
+{
+    TCP_DEBUG_ENTER;
+#if IS_USED(MODULE_GNRC_TCP_BACKLOG)
+    int ret = 0;
+
+    if (tcb->state != FSM_STATE_LISTEN) {
+        TCP_DEBUG_ERROR("-EBUSY: TCB is not listening.");
+        TCP_DEBUG_LEAVE;
+        return -EBUSY;
+    }
+    if (_gnrc_tcp_backlog_adopt(tcb, in_pkt, entry) < 0) {
+        TCP_DEBUG_ERROR("-ENOENT: No matching connection in backlog.");
+        TCP_DEBUG_LEAVE;
+        return -ENOENT;
+    }
+    /* T: LISTEN -> SYN_RCVD, the packet itself completes the handshake ... */
+    _transition_to(tcb, FSM_STATE_SYN_RCVD);
+    if (in_pkt != NULL) {
+        ret = _fsm_rcvd_pkt(tcb, in_pkt);
+    }
+    /* ... or the backlog did already: T: SYN_RCVD -> ESTABLISHED */
+    else {
+        _transition_to(tcb, FSM_STATE_ESTABLISHED);
+    }
+    TCP_DEBUG_LEAVE;
+    return ret;
+#else
+    (void) tcb;
+    (void) in_pkt;
+    (void) entry;
+    TCP_DEBUG_LEAVE;
+    return -EOPNOTSUPP;
+#endif
+}
+
 /**
  * @brief FSM handling function for timewait timeout handling.
  *
@@ -857,9 +1072,11 @@ static int _fsm_timeout_timewait(gnrc_tcp_tcb_t *tcb)
 static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
-        _gnrc_tcp_pkt_setup_retransmit(tcb, tcb->pkt_retransmit, true);
-        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit, 0, true);
+    if (tcb->rtx_len > 0) {
+        gnrc_pktsnip_t *pkt = tcb->rtx[0].pkt;
+
+        _gnrc_tcp_pkt_setup_retransmit(tcb, pkt, true);
+        _gnrc_tcp_pkt_send(tcb, pkt, 0, true);
     }
     else {
         TCP_DEBUG_INFO("Retransmission queue is empty.");
@@ -949,6 +1166,12 @@ static int _fsm_unprotected(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event,
         case FSM_EVENT_CALL_RECV :
             ret = _fsm_call_recv(tcb, buf, len);
             break;
+        case FSM_EVENT_CALL_RECV_BUF :
+            ret = _fsm_call_recv_buf(tcb, buf, len);
+            break;
+        case FSM_EVENT_CALL_RECV_CONSUME :
+            ret = _fsm_call_recv_consume(tcb, len);
+            break;
         case FSM_EVENT_CALL_CLOSE :
             ret = _fsm_call_close(tcb);
             break;
@@ -958,6 +1181,9 @@ static int _fsm_unprotected(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event,
         case FSM_EVENT_RCVD_PKT :
             ret = _fsm_rcvd_pkt(tcb, in_pkt);
             break;
+        case FSM_EVENT_RCVD_BACKLOG_PKT :
+            ret = _fsm_rcvd_backlog_pkt(tcb, in_pkt, buf);
+            break;
         case FSM_EVENT_TIMEOUT_TIMEWAIT :
             ret = _fsm_timeout_timewait(tcb);
             break;
@@ -978,6 +1204,57 @@ static int _fsm_unprotected(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event,
     return ret;
 }
 
+#if defined(SOCK_HAS_ASYNC) && defined(MODULE_SOCK_TCP)
+/**
+ * @brief Determines the asynchronous sock events caused by an FSM call.
+ *
+ * @param[in] tcb       TCB after the FSM call.
+ * @param[in] state     FSM state before the FSM call.
+ * @param[in] snd_una   Send unacknowledged before the FSM call.
+ * @param[in] rcv_nxt   Receive next before the FSM call.
+ *
+ * @returns   Events of the connection, SOCK_ASYNC_CONN_RECV is meant for the
+ *            listening queue of @p tcb.
+ */
+static sock_async_flags_t _async_flags(const gnrc_tcp_tcb_t *tcb,
+                                       _gnrc_tcp_fsm_state_t state,
+                                       uint32_t snd_una, uint32_t rcv_nxt)
+{
+    sock_async_flags_t flags = 0;
+    bool was_connected = (state >= FSM_STATE_ESTABLISHED);
+    bool is_connected = (tcb->state == FSM_STATE_ESTABLISHED ||
+                         tcb->state == FSM_STATE_CLOSE_WAIT);
+
+    /* Handshake completed */
+    if (is_connected && !was_connected) {
+        if ((tcb->status & STATUS_LISTENING) && state != FSM_STATE_SYN_SENT) {
+            flags |= SOCK_ASYNC_CONN_RECV;
+        }
+        else {
+            flags |= SOCK_ASYNC_CONN_RDY;
+        }
+    }
+    if (was_connected) {
+        /* Data or a FIN was received */
+        if (tcb->rcv_nxt != rcv_nxt) {
+            flags |= SOCK_ASYNC_MSG_RECV;
+        }
+        /* Data was acknowledged, there is room for more */
+        if (tcb->snd_una != snd_una) {
+            flags |= SOCK_ASYNC_MSG_SENT;
+        }
+    }
+    /* Peer closed, reset or timed out the connection */
+    if (tcb->state != state &&
+        (tcb->state == FSM_STATE_CLOSE_WAIT || tcb->state == FSM_STATE_CLOSED ||
+         tcb->state == FSM_STATE_LISTEN) &&
+        (was_connected || state == FSM_STATE_SYN_SENT)) {
+        flags |= SOCK_ASYNC_CONN_FIN;
+    }
+    return flags;
+}
+#endif
+
 int _gnrc_tcp_fsm(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event,
                   gnrc_pktsnip_t *in_pkt, void *buf, size_t len)
 {
@@ -985,6 +1262,12 @@ int _gnrc_tcp_fsm(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event,
     /* Lock FSM */
     mutex_lock(&(tcb->fsm_lock));
 
+#if defined(SOCK_HAS_ASYNC) && defined(MODULE_SOCK_TCP)
+    _gnrc_tcp_fsm_state_t state = tcb->state;
+    uint32_t snd_una = tcb->snd_una;
+    uint32_t rcv_nxt = tcb->rcv_nxt;
+#endif
+
     /* Call FSM */
     tcb->status &= ~STATUS_NOTIFY_USER;
     int32_t result = _fsm_unprotected(tcb, event, in_pkt, buf, len);
@@ -996,8 +1279,32 @@ int _gnrc_tcp_fsm(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event,
         msg.content.ptr = tcb;
         mbox_try_put(tcb->mbox, &msg);
     }
+
+#if defined(SOCK_HAS_ASYNC) && defined(MODULE_SOCK_TCP)
+    /* Report events caused by the peer or by timers, not by the user itself */
+    sock_async_flags_t flags = 0;
+    sock_tcp_cb_t cb = tcb->async_cb;
+    void *cb_arg = tcb->async_cb_arg;
+    gnrc_tcp_tcb_queue_t *queue = tcb->queue;
+
+    if (event >= FSM_EVENT_RCVD_PKT) {
+        flags = _async_flags(tcb, state, snd_una, rcv_nxt);
+    }
+#endif
+
     /* Unlock FSM */
     mutex_unlock(&(tcb->fsm_lock));
+
+#if defined(SOCK_HAS_ASYNC) && defined(MODULE_SOCK_TCP)
+    /* Callbacks may use the TCB, so call them without holding the FSM lock */
+    if ((flags & SOCK_ASYNC_CONN_RECV) && queue != NULL && queue->async_cb != NULL) {
+        queue->async_cb(queue, SOCK_ASYNC_CONN_RECV, queue->async_cb_arg);
+    }
+    flags &= ~SOCK_ASYNC_CONN_RECV;
+    if (flags && cb != NULL) {
+        cb(tcb, flags, cb_arg);
+    }
+#endif
     TCP_DEBUG_LEAVE;
     return result;
 }
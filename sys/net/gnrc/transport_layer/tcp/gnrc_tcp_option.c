@@ -16,17 +16,62 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  * @}
  */
+#include <string.h>
+#include "byteorder.h"
+#include "evtimer.h"
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_fsm.h"
 #include "include/gnrc_tcp_option.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
-int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
+/**
+ * @brief Reads a 32 bit value in network byte order from an option field.
+ *
+ * @param[in] ptr   Pointer to the first byte of the value.
+ *
+ * @returns   Value in host byte order.
+ */
+static inline uint32_t _get_u32(const uint8_t *ptr)
+{
+    return ((uint32_t)ptr[0] << 24) | ((uint32_t)ptr[1] << 16) |
+           ((uint32_t)ptr[2] << 8) | (uint32_t)ptr[3];
+}
+
+/**
+ * @brief Writes a 32 bit value in network byte order to an option field.
+ *
+ * @param[out] ptr   Pointer to the first byte of the value.
+ * @param[in]  val   Value in host byte order.
+ */
+static inline void _set_u32(uint8_t *ptr, uint32_t val)
+{
+    ptr[0] = val >> 24;
+    ptr[1] = val >> 16;
+    ptr[2] = val >> 8;
+    ptr[3] = val;
+}
+
+int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr, _gnrc_tcp_option_seg_t *seg)
 {
     TCP_DEBUG_ENTER;
+    uint16_t ctl = byteorder_ntohs(hdr->off_ctl);
+
+    seg->sack_num = 0;
+    seg->has_ts = false;
+
+    /* Options are negotiated on the SYN opening the connection only */
+    bool negotiate = (ctl & MSK_SYN) && (tcb->state == FSM_STATE_LISTEN ||
+                                         tcb->state == FSM_STATE_SYN_SENT);
+    if (negotiate) {
+        tcb->options = 0;
+        tcb->snd_wnd_scale = 0;
+        tcb->rcv_wnd_scale = 0;
+    }
+
     /* Extract offset value. Return if no options are set */
-    uint8_t offset = GET_OFFSET(byteorder_ntohs(hdr->off_ctl));
+    uint8_t offset = GET_OFFSET(ctl);
     if (offset <= TCP_HDR_OFFSET_MIN) {
         TCP_DEBUG_LEAVE;
         return 0;
@@ -64,6 +109,70 @@ int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
                 tcb->mss = (option->value[0] << 8) | option->value[1];
                 break;
 
+            case TCP_OPTION_KIND_WS:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length != TCP_OPTION_LENGTH_WS) {
+                    TCP_DEBUG_ERROR("Invalid window scale option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                TCP_DEBUG_INFO("Window scale option found.");
+                if (IS_USED(MODULE_GNRC_TCP_WND_SCALE) && negotiate) {
+                    tcb->options |= OPTION_WS;
+                    tcb->snd_wnd_scale = (option->value[0] < WND_SCALE_MAX)
+                                       ? option->value[0] : WND_SCALE_MAX;
+                    tcb->rcv_wnd_scale = _gnrc_tcp_option_rcv_wnd_scale(tcb);
+                }
+                break;
+
+            case TCP_OPTION_KIND_SACK_PERM:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length != TCP_OPTION_LENGTH_SACK_PERM) {
+                    TCP_DEBUG_ERROR("Invalid SACK permitted option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                TCP_DEBUG_INFO("SACK permitted option found.");
+                if (IS_USED(MODULE_GNRC_TCP_SACK) && negotiate) {
+                    tcb->options |= OPTION_SACK_PERM;
+                }
+                break;
+
+            case TCP_OPTION_KIND_SACK:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length < (TCP_OPTION_LENGTH_MIN + TCP_OPTION_LENGTH_SACK_BLOCK) ||
+                    ((option->length - TCP_OPTION_LENGTH_MIN) % TCP_OPTION_LENGTH_SACK_BLOCK)) {
+                    TCP_DEBUG_ERROR("Invalid SACK option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                TCP_DEBUG_INFO("SACK option found.");
+                for (unsigned i = TCP_OPTION_LENGTH_MIN;
+                     i < option->length && seg->sack_num < GNRC_TCP_OPTION_SACK_BLOCKS_MAX;
+                     i += TCP_OPTION_LENGTH_SACK_BLOCK) {
+                    seg->sack_left[seg->sack_num] = _get_u32(&opt_ptr[i]);
+                    seg->sack_right[seg->sack_num] = _get_u32(&opt_ptr[i + 4]);
+                    seg->sack_num++;
+                }
+                break;
+
+            case TCP_OPTION_KIND_TS:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length != TCP_OPTION_LENGTH_TS) {
+                    TCP_DEBUG_ERROR("Invalid timestamps option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                TCP_DEBUG_INFO("Timestamps option found.");
+                seg->has_ts = true;
+                seg->ts_val = _get_u32(&option->value[0]);
+                seg->ts_ecr = _get_u32(&option->value[4]);
+                if (IS_USED(MODULE_GNRC_TCP_TIMESTAMPS) && negotiate) {
+                    tcb->options |= OPTION_TS;
+                    tcb->ts_recent = seg->ts_val;
+                }
+                break;
+
             default:
                 if (opt_left >= TCP_OPTION_LENGTH_MIN) {
                     TCP_DEBUG_INFO("Valid, unsupported option found.");
@@ -83,3 +192,107 @@ int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
     TCP_DEBUG_LEAVE;
     return 0;
 }
+
+uint8_t _gnrc_tcp_option_build(const gnrc_tcp_tcb_t *tcb, uint8_t *buf, uint16_t ctl)
+{
+    TCP_DEBUG_ENTER;
+    uint8_t size = 0;
+    uint8_t options = 0;
+
+    if (ctl & MSK_RST) {
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+
+    /* An initial SYN offers all supported options, a SYN+ACK accepts the
+     * options offered by the peer. Afterwards only timestamps are sent. */
+    if ((ctl & MSK_SYN_ACK) == MSK_SYN) {
+        options = (IS_USED(MODULE_GNRC_TCP_WND_SCALE) ? OPTION_WS : 0) |
+                  (IS_USED(MODULE_GNRC_TCP_SACK) ? OPTION_SACK_PERM : 0) |
+                  (IS_USED(MODULE_GNRC_TCP_TIMESTAMPS) ? OPTION_TS : 0);
+    }
+    else if (ctl & MSK_SYN) {
+        options = tcb->options;
+    }
+    else {
+        options = tcb->options & OPTION_TS;
+    }
+
+    /* Options are padded with leading NOPs to start at 32 bit boundaries */
+    if (ctl & MSK_SYN) {
+        if (buf) {
+            network_uint32_t mss_option = byteorder_htonl(
+                _gnrc_tcp_option_build_mss(CONFIG_GNRC_TCP_MSS));
+
+            memcpy(&buf[size], &mss_option, sizeof(mss_option));
+        }
+        size += 4;
+    }
+    if (options & OPTION_WS) {
+        if (buf) {
+            buf[size] = TCP_OPTION_KIND_NOP;
+            buf[size + 1] = TCP_OPTION_KIND_WS;
+            buf[size + 2] = TCP_OPTION_LENGTH_WS;
+            /* A SYN+ACK confirms the shift count chosen with the SYN */
+            buf[size + 3] = (ctl & MSK_ACK) ? tcb->rcv_wnd_scale
+                                            : _gnrc_tcp_option_rcv_wnd_scale(tcb);
+        }
+        size += 4;
+    }
+    if (options & OPTION_SACK_PERM) {
+        if (buf) {
+            buf[size] = TCP_OPTION_KIND_NOP;
+            buf[size + 1] = TCP_OPTION_KIND_NOP;
+            buf[size + 2] = TCP_OPTION_KIND_SACK_PERM;
+            buf[size + 3] = TCP_OPTION_LENGTH_SACK_PERM;
+        }
+        size += 4;
+    }
+    if (options & OPTION_TS) {
+        if (buf) {
+            buf[size] = TCP_OPTION_KIND_NOP;
+            buf[size + 1] = TCP_OPTION_KIND_NOP;
+            buf[size + 2] = TCP_OPTION_KIND_TS;
+            buf[size + 3] = TCP_OPTION_LENGTH_TS;
+            _set_u32(&buf[size + 4], evtimer_now_msec());
+            /* The echo reply is only valid on segments acknowledging something */
+            _set_u32(&buf[size + 8], (ctl & MSK_ACK) ? tcb->ts_recent : 0);
+        }
+        size += 12;
+    }
+    TCP_DEBUG_LEAVE;
+    return size;
+}
+
+void _gnrc_tcp_option_update_ts(const gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
+{
+    TCP_DEBUG_ENTER;
+    uint16_t ctl = byteorder_ntohs(hdr->off_ctl);
+    uint8_t *opt_ptr = (uint8_t *) hdr + sizeof(tcp_hdr_t);
+    uint8_t opt_left = (GET_OFFSET(ctl) - TCP_HDR_OFFSET_MIN) * 4;
+
+    /* Options were written by _gnrc_tcp_option_build, skip over them */
+    while (opt_left >= TCP_OPTION_LENGTH_MIN) {
+        if (opt_ptr[0] == TCP_OPTION_KIND_EOL) {
+            break;
+        }
+        if (opt_ptr[0] == TCP_OPTION_KIND_NOP) {
+            opt_ptr += 1;
+            opt_left -= 1;
+            continue;
+        }
+        if (opt_ptr[1] < TCP_OPTION_LENGTH_MIN || opt_ptr[1] > opt_left) {
+            break;
+        }
+        if (opt_ptr[0] == TCP_OPTION_KIND_TS && opt_ptr[1] == TCP_OPTION_LENGTH_TS) {
+            _set_u32(&opt_ptr[2], evtimer_now_msec());
+            if (ctl & MSK_ACK) {
+                _set_u32(&opt_ptr[6], tcb->ts_recent);
+            }
+            break;
+        }
+        opt_left -= opt_ptr[1];
+        opt_ptr += opt_ptr[1];
+    }
+    TCP_DEBUG_LEAVE;
+}
@@ -24,6 +24,7 @@
 #include "evtimer_msg.h"
 #include "net/inet_csum.h"
 #include "net/gnrc.h"
+#include "net/gnrc/tcp/congestion.h"
 #include "include/gnrc_tcp_common.h"
 #include "include/gnrc_tcp_eventloop.h"
 #include "include/gnrc_tcp_option.h"
@@ -173,14 +174,15 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     tcp_hdr.checksum = byteorder_htons(0);
     tcp_hdr.seq_num = byteorder_htonl(seq_num);
     tcp_hdr.ack_num = byteorder_htonl(ack_num);
-    tcp_hdr.window = byteorder_htons(tcb->rcv_wnd);
     tcp_hdr.urgent_ptr = byteorder_htons(0);
 
+    /* Window field of SYNs is never scaled (RFC 7323, section 2.2) */
+    uint32_t wnd = tcb->rcv_wnd >> ((ctl & MSK_SYN) ? 0 : tcb->rcv_wnd_scale);
+    tcp_hdr.window = byteorder_htons((wnd > UINT16_MAX) ? UINT16_MAX : wnd);
+
     /* Calculate option field size. */
-    /* Add MSS option if SYN is sent */
-    if (ctl & MSK_SYN) {
-        offset += 1;
-    }
+    offset += _gnrc_tcp_option_build(tcb, NULL, ctl) / sizeof(network_uint32_t);
+
     /* Set offset and control bit accordingly */
     tcp_hdr.off_ctl = byteorder_htons(
         _gnrc_tcp_option_build_offset_control(offset, ctl));
@@ -210,16 +212,7 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
 
             /* Init options field with 'End Of List' - option (0) */
             memset(opt_ptr, TCP_OPTION_KIND_EOL, opt_left);
-
-            /* If SYN flag is set: Add MSS option */
-            if (ctl & MSK_SYN) {
-                network_uint32_t mss_option = byteorder_htonl(
-                    _gnrc_tcp_option_build_mss(CONFIG_GNRC_TCP_MSS));
-
-                memcpy(opt_ptr, &mss_option, sizeof(mss_option));
-            }
-            /* Increase opt_ptr and decrease opt_left, if other options are added */
-            /* NOTE: Add additional options here */
+            _gnrc_tcp_option_build(tcb, opt_ptr, ctl);
         }
         *(out_pkt) = tcp_snp;
     }
@@ -285,14 +278,38 @@ int _gnrc_tcp_pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt,
         return -EINVAL;
     }
 
-    /* If this is no retransmission, advance sequence number and measure time */
+    /* If this is no retransmission, advance sequence number */
     if (!retransmit) {
-        tcb->retries = 0;
         tcb->snd_nxt += seq_con;
-        tcb->rtt_start = evtimer_now_msec();
     }
-    else {
-        tcb->retries += 1;
+    /* Otherwise the timestamp must tell the peer when it was resent. The
+     * retransmission queue shares the packet, so the headers up to the TCP
+     * header are copied before they are written to */
+    else if (IS_USED(MODULE_GNRC_TCP_TIMESTAMPS) && (tcb->options & OPTION_TS)) {
+        gnrc_pktsnip_t *snp = gnrc_pktbuf_start_write(out_pkt);
+
+        if (snp == NULL) {
+            gnrc_pktbuf_release(out_pkt);
+            TCP_DEBUG_ERROR("-ENOMEM: Can't copy packet to update timestamp.");
+            TCP_DEBUG_LEAVE;
+            return -ENOMEM;
+        }
+        out_pkt = snp;
+        while (snp->type != GNRC_NETTYPE_TCP && snp->next != NULL) {
+            gnrc_pktsnip_t *next = gnrc_pktbuf_start_write(snp->next);
+
+            if (next == NULL) {
+                gnrc_pktbuf_release(out_pkt);
+                TCP_DEBUG_ERROR("-ENOMEM: Can't copy packet to update timestamp.");
+                TCP_DEBUG_LEAVE;
+                return -ENOMEM;
+            }
+            snp->next = next;
+            snp = next;
+        }
+        if (snp->type == GNRC_NETTYPE_TCP) {
+            _gnrc_tcp_option_update_ts(tcb, (tcp_hdr_t *) snp->data);
+        }
     }
 
     /* Pass packet down the network stack */
@@ -376,10 +393,148 @@ uint32_t _gnrc_tcp_pkt_get_pay_len(gnrc_pktsnip_t *pkt)
     return seg_len;
 }
 
+/**
+ * @brief Extracts the sequence number of a segment.
+ *
+ * @param[in] pkt   Packet to extract the sequence number from.
+ *
+ * @returns   Sequence number of @p pkt.
+ */
+static uint32_t _get_seq_num(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
+    assert(snp != NULL);
+    return byteorder_ntohl(((tcp_hdr_t *) snp->data)->seq_num);
+}
+
+/**
+ * @brief Calculates the RTO from the current round trip time estimation.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _calc_rto(gnrc_tcp_tcb_t *tcb)
+{
+    /* If there is no estimation yet: rto is 1 sec (Lower Bound) */
+    if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else {
+        tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
+                                    CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+    }
+}
+
+/**
+ * @brief Performs boundary checks on the current RTO.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _bound_rto(gnrc_tcp_tcb_t *tcb)
+{
+    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
+    }
+}
+
+/**
+ * @brief Reports a (re-)transmitted segment to congestion control.
+ *
+ * @param[in,out] tcb     TCB holding the connection information.
+ * @param[in,out] entry   Retransmission queue entry of the segment.
+ */
+static void _congure_report_sent(gnrc_tcp_tcb_t *tcb, gnrc_tcp_rtx_entry_t *entry)
+{
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+    uint32_t len = _gnrc_tcp_pkt_get_pay_len(entry->pkt);
+
+    /* Control segments without payload are not subject to congestion control */
+    if (tcb->congure != NULL && !entry->in_flight && len > 0) {
+        tcb->congure->driver->report_msg_sent(tcb->congure,
+                                              len * GNRC_TCP_CONGURE_UNIT);
+        entry->in_flight = true;
+    }
+#else
+    (void)tcb;
+    (void)entry;
+#endif
+}
+
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+/**
+ * @brief Adds a queued segment to a list of messages reported to congestion control.
+ *
+ * @param[in,out] list    List of messages.
+ * @param[out]    msg     Message to fill and add to @p list.
+ * @param[in,out] entry   Retransmission queue entry of the segment.
+ */
+static void _congure_add_msg(clist_node_t *list, congure_snd_msg_t *msg,
+                             gnrc_tcp_rtx_entry_t *entry)
+{
+    msg->send_time = entry->send_time;
+    msg->size = _gnrc_tcp_pkt_get_pay_len(entry->pkt) * GNRC_TCP_CONGURE_UNIT;
+    msg->resends = entry->resends;
+    clist_rpush(list, &msg->super);
+    entry->in_flight = false;
+}
+#endif
+
+/**
+ * @brief Reports all segments accounted for by congestion control as timed out.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _congure_report_timeout(gnrc_tcp_tcb_t *tcb)
+{
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+    congure_snd_msg_t msgs[GNRC_TCP_RTX_QUEUE_SIZE];
+    clist_node_t list = { NULL };
+
+    if (tcb->congure == NULL) {
+        return;
+    }
+    for (unsigned i = 0; i < tcb->rtx_len; i++) {
+        if (tcb->rtx[i].in_flight) {
+            _congure_add_msg(&list, &msgs[i], &tcb->rtx[i]);
+        }
+    }
+    if (list.next != NULL) {
+        tcb->congure->driver->report_msgs_timeout(tcb->congure,
+                                                  (congure_snd_msg_t *)&list);
+    }
+#else
+    (void)tcb;
+#endif
+}
+
+/**
+ * @brief Reports the oldest unacknowledged segment as lost to congestion control.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _congure_report_lost(gnrc_tcp_tcb_t *tcb)
+{
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+    congure_snd_msg_t msg;
+    clist_node_t list = { NULL };
+
+    if (tcb->congure != NULL && tcb->rtx[0].in_flight) {
+        _congure_add_msg(&list, &msg, &tcb->rtx[0]);
+        tcb->congure->driver->report_msgs_lost(tcb->congure,
+                                               (congure_snd_msg_t *)&list);
+    }
+#else
+    (void)tcb;
+#endif
+}
+
 int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
                                    const bool retransmit)
 {
     TCP_DEBUG_ENTER;
+    gnrc_tcp_rtx_entry_t *entry = NULL;
     gnrc_pktsnip_t *snp = NULL;
     uint32_t ctl = 0;
     uint32_t len = 0;
@@ -391,13 +546,6 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return -EINVAL;
     }
 
-    /* Check if retransmit queue is full and pkt is not already in retransmit queue */
-    if (tcb->pkt_retransmit != NULL && tcb->pkt_retransmit != pkt) {
-        TCP_DEBUG_ERROR("-ENOMEM: Retransmit queue is full.");
-        TCP_DEBUG_LEAVE;
-        return -ENOMEM;
-    }
-
     /* Extract control bits and segment length */
     snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
     if (snp == NULL) {
@@ -415,20 +563,47 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return 0;
     }
 
-    /* Assign pkt and increase users: every send attempt consumes a user */
-    tcb->pkt_retransmit = pkt;
+    if (!retransmit) {
+        /* Check if retransmit queue is full. Segments carrying payload must
+         * leave the last entry to a SYN or FIN */
+        if (tcb->rtx_len >= ((len > 0) ? CONFIG_GNRC_TCP_SND_QUEUE_SIZE
+                                       : GNRC_TCP_RTX_QUEUE_SIZE)) {
+            TCP_DEBUG_ERROR("-ENOMEM: Retransmit queue is full.");
+            TCP_DEBUG_LEAVE;
+            return -ENOMEM;
+        }
+        entry = &tcb->rtx[tcb->rtx_len++];
+        entry->pkt = pkt;
+        entry->resends = 0;
+        entry->in_flight = false;
+        entry->sacked = false;
+    }
+    else {
+        /* Only the oldest segment is retransmitted on timeout */
+        entry = &tcb->rtx[0];
+        if (tcb->rtx_len == 0 || entry->pkt != pkt) {
+            TCP_DEBUG_ERROR("-EINVAL: pkt is not the oldest queued segment.");
+            TCP_DEBUG_LEAVE;
+            return -EINVAL;
+        }
+        entry->resends += 1;
+    }
+    entry->send_time = evtimer_now_msec();
+
+    /* Increase users: every send attempt consumes a user */
     gnrc_pktbuf_hold(pkt, 1);
 
     /* RTO adjustment */
     if (!retransmit) {
-        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
-        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
-            tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-        }
-        else {
-            tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
-                                        CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+        _congure_report_sent(tcb, entry);
+
+        /* The timer covers the oldest segment: It is already running
+         * if other segments are unacknowledged */
+        if (tcb->rtx_len > 1) {
+            TCP_DEBUG_LEAVE;
+            return 0;
         }
+        _calc_rto(tcb);
     }
     else {
         /* If this is a retransmission: Double the rto (Timer Backoff) */
@@ -440,15 +615,25 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
             tcb->srtt = RTO_UNINITIALIZED;
             tcb->rtt_var = RTO_UNINITIALIZED;
         }
+        tcb->retries += 1;
+
+        /* Everything in flight is considered lost, resend all of it one
+         * segment per ACK (RFC 6582, section 3.2 step 4) */
+        _congure_report_timeout(tcb);
+        tcb->status |= STATUS_RECOVERY;
+        tcb->recover = tcb->snd_nxt;
+        tcb->high_rxt = _get_seq_num(pkt) + _gnrc_tcp_pkt_get_seg_len(pkt);
+        _congure_report_sent(tcb, entry);
+
+        /* The peer may have discarded data it selectively acknowledged
+         * (RFC 2018, section 8) */
+        for (unsigned i = 0; i < tcb->rtx_len; i++) {
+            tcb->rtx[i].sacked = false;
+        }
     }
 
     /* Perform boundary checks on current RTO before usage */
-    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-    }
-    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
-    }
+    _bound_rto(tcb);
 
     /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
     _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
@@ -457,60 +642,250 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
     return 0;
 }
 
-int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
+/**
+ * @brief Resends a queued segment during loss recovery.
+ *
+ * @param[in,out] tcb     TCB holding the connection information.
+ * @param[in,out] entry   Retransmission queue entry of the segment.
+ */
+static void _resend(gnrc_tcp_tcb_t *tcb, gnrc_tcp_rtx_entry_t *entry)
+{
+    entry->resends += 1;
+    entry->send_time = evtimer_now_msec();
+    tcb->high_rxt = _get_seq_num(entry->pkt) + _gnrc_tcp_pkt_get_seg_len(entry->pkt);
+    _congure_report_sent(tcb, entry);
+
+    /* Increase users: every send attempt consumes a user */
+    gnrc_pktbuf_hold(entry->pkt, 1);
+    _gnrc_tcp_pkt_send(tcb, entry->pkt, 0, true);
+}
+
+/**
+ * @brief Searches the oldest segment to resend during loss recovery.
+ *
+ * Segments that were selectively acknowledged or already resent during the
+ * current loss recovery are skipped (RFC 6675, section 4).
+ *
+ * @param[in] tcb     TCB holding the connection information.
+ * @param[in] force   Return the oldest candidate, even if no later segment was
+ *                    selectively acknowledged.
+ *
+ * @returns   Retransmission queue entry to resend. NULL if there is none.
+ */
+static gnrc_tcp_rtx_entry_t *_next_hole(gnrc_tcp_tcb_t *tcb, const bool force)
+{
+    unsigned last_sacked = 0;
+
+    /* Segments are considered lost if a later segment was received */
+    for (unsigned i = 0; i < tcb->rtx_len; i++) {
+        if (tcb->rtx[i].sacked) {
+            last_sacked = i;
+        }
+    }
+    for (unsigned i = 0; i < tcb->rtx_len; i++) {
+        gnrc_tcp_rtx_entry_t *entry = &tcb->rtx[i];
+
+        if (entry->sacked || LSS_32_BIT(_get_seq_num(entry->pkt), tcb->high_rxt)) {
+            continue;
+        }
+        return (force || i < last_sacked) ? entry : NULL;
+    }
+    return NULL;
+}
+
+int _gnrc_tcp_pkt_fast_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    uint32_t seg = 0;
-    gnrc_pktsnip_t *snp = NULL;
-    tcp_hdr_t *hdr;
+    gnrc_tcp_rtx_entry_t *entry = NULL;
+
+    /* Retransmission queue is empty. Nothing to retransmit */
+    if (tcb->rtx_len == 0) {
+        TCP_DEBUG_ERROR("-ENODATA: No packet to retransmit.");
+        TCP_DEBUG_LEAVE;
+        return -ENODATA;
+    }
+
+    /* Enter loss recovery, unless this is the retransmission after a
+     * partial ACK during loss recovery */
+    if (!(tcb->status & STATUS_RECOVERY)) {
+        _congure_report_lost(tcb);
+        tcb->status |= STATUS_RECOVERY;
+        tcb->recover = tcb->snd_nxt;
+        tcb->high_rxt = tcb->snd_una;
+    }
+    entry = _next_hole(tcb, true);
+    if (entry == NULL) {
+        TCP_DEBUG_ERROR("-ENODATA: All segments were resent already.");
+        TCP_DEBUG_LEAVE;
+        return -ENODATA;
+    }
+    _resend(tcb, entry);
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
+
+int _gnrc_tcp_pkt_sack_retransmit(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    gnrc_tcp_rtx_entry_t *entry = NULL;
+
+    if (tcb->status & STATUS_RECOVERY) {
+        entry = _next_hole(tcb, false);
+    }
+    if (entry == NULL) {
+        TCP_DEBUG_LEAVE;
+        return -ENODATA;
+    }
+    _resend(tcb, entry);
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
+
+void _gnrc_tcp_pkt_sack(gnrc_tcp_tcb_t *tcb, const _gnrc_tcp_option_seg_t *seg)
+{
+    TCP_DEBUG_ENTER;
+    for (unsigned i = 0; i < tcb->rtx_len; i++) {
+        gnrc_tcp_rtx_entry_t *entry = &tcb->rtx[i];
+        uint32_t start = _get_seq_num(entry->pkt);
+        uint32_t end = start + _gnrc_tcp_pkt_get_seg_len(entry->pkt);
+
+        /* Mark segments covered completely by a SACK block */
+        for (unsigned j = 0; j < seg->sack_num && !entry->sacked; j++) {
+            if (LEQ_32_BIT(seg->sack_left[j], start) && LEQ_32_BIT(end, seg->sack_right[j])) {
+                entry->sacked = true;
+            }
+        }
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack,
+                              const _gnrc_tcp_option_seg_t *seg)
+{
+    TCP_DEBUG_ENTER;
+    uint32_t now = evtimer_now_msec();
+    int32_t rtt = -1;
+    uint8_t acked = 0;
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+    congure_snd_msg_t msg = { .size = 0 };
+#endif
 
     /* Retransmission queue is empty. Nothing to ACK there */
-    if (tcb->pkt_retransmit == NULL) {
+    if (tcb->rtx_len == 0) {
         TCP_DEBUG_ERROR("-ENODATA: No packet to acknowledge.");
         TCP_DEBUG_LEAVE;
         return -ENODATA;
     }
 
-    snp = gnrc_pktsnip_search_type(tcb->pkt_retransmit, GNRC_NETTYPE_TCP);
-    if (snp == NULL) {
-        TCP_DEBUG_ERROR("-EINVAL: snp == NULL.");
+    /* Release all segments covered by ack, oldest first */
+    while (acked < tcb->rtx_len) {
+        gnrc_tcp_rtx_entry_t *entry = &tcb->rtx[acked];
+        uint32_t seg = _get_seq_num(entry->pkt) + _gnrc_tcp_pkt_get_seg_len(entry->pkt) - 1;
+
+        if (!LSS_32_BIT(seg, ack)) {
+            break;
+        }
+        /* Measure round trip time only on segments sent once (Karns Algorithm) */
+        if (entry->resends == 0) {
+            rtt = now - entry->send_time;
+        }
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+        /* Report all segments covered by this ACK as one message */
+        if (entry->in_flight) {
+            msg.send_time = entry->send_time;
+            msg.size += _gnrc_tcp_pkt_get_pay_len(entry->pkt) * GNRC_TCP_CONGURE_UNIT;
+            msg.resends = _max(msg.resends, entry->resends);
+        }
+#endif
+        gnrc_pktbuf_release(entry->pkt);
+        acked++;
+    }
+    if (acked == 0) {
         TCP_DEBUG_LEAVE;
-        return -EINVAL;
+        return 0;
     }
+    tcb->rtx_len -= acked;
+    memmove(tcb->rtx, &tcb->rtx[acked], tcb->rtx_len * sizeof(tcb->rtx[0]));
+    tcb->retries = 0;
 
-    hdr = (tcp_hdr_t *) snp->data;
+    /* The echoed timestamp measures the round trip time of retransmitted
+     * segments as well (RFC 7323, section 4.1) */
+    if ((tcb->options & OPTION_TS) && seg != NULL && seg->has_ts && seg->ts_ecr != 0) {
+        rtt = now - seg->ts_ecr;
+    }
 
-    /* There must be a packet, waiting to be acknowledged. */
-    seg = byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(
-        tcb->pkt_retransmit) - 1;
+    /* Use time only if there was no timer overflow */
+    if (rtt > 0) {
+        /* If this is the first sample taken */
+        if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
+            tcb->srtt = rtt;
+            tcb->rtt_var = (rtt >> 1);
+        }
+        /* If this is a subsequent sample */
+        else {
+            tcb->rtt_var = (tcb->rtt_var / CONFIG_GNRC_TCP_RTO_B_DIV) * (CONFIG_GNRC_TCP_RTO_B_DIV-1);
+            tcb->rtt_var += labs(tcb->srtt - rtt) / CONFIG_GNRC_TCP_RTO_B_DIV;
+            tcb->srtt = (tcb->srtt / CONFIG_GNRC_TCP_RTO_A_DIV) * (CONFIG_GNRC_TCP_RTO_A_DIV-1);
+            tcb->srtt += rtt / CONFIG_GNRC_TCP_RTO_A_DIV;
+        }
+    }
 
-        /* If segment can be acknowledged -> stop timer, release packet from pktbuf and update rto. */
-    if (LSS_32_BIT(seg, ack)) {
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+    if (tcb->congure != NULL && msg.size > 0) {
+        /* Relative sequence numbers let the first ACK compare as new ACK */
+        congure_snd_ack_t ack_info = {
+            .recv_time = now,
+            .id = ack - tcb->iss,
+            .clean = true,
+        };
+        tcb->congure->driver->report_msg_acked(tcb->congure, &msg, &ack_info);
+    }
+#endif
+
+    /* Restart retransmission timer for the now oldest segment (RFC 6298, section 5.3) */
+    _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+    if (tcb->status & STATUS_RECOVERY) {
+        /* Full ACK: Leave loss recovery */
+        if (LEQ_32_BIT(tcb->recover, ack)) {
+            tcb->status &= ~STATUS_RECOVERY;
+        }
+        /* Partial ACK: The next segment was lost as well, resend it right away */
+        else if (tcb->rtx_len > 0) {
+            _gnrc_tcp_pkt_fast_retransmit(tcb);
+        }
+    }
+    if (tcb->rtx_len > 0) {
+        _calc_rto(tcb);
+        _bound_rto(tcb);
+        _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
+                                  MSG_TYPE_RETRANSMISSION, tcb);
+    }
+    TCP_DEBUG_LEAVE;
+    return acked;
+}
+
+void _gnrc_tcp_pkt_clear_retransmit(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    if (tcb->rtx_len > 0) {
         _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
-
-        /* Measure round trip time */
-        int32_t rtt = evtimer_now_msec() - tcb->rtt_start;
-
-        /* Use time only if there was no timer overflow and no retransmission (Karns Algorithm) */
-        if (tcb->retries == 0 && rtt > 0) {
-            /* If this is the first sample taken */
-            if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
-                tcb->srtt = rtt;
-                tcb->rtt_var = (rtt >> 1);
-            }
-            /* If this is a subsequent sample */
-            else {
-                tcb->rtt_var = (tcb->rtt_var / CONFIG_GNRC_TCP_RTO_B_DIV) * (CONFIG_GNRC_TCP_RTO_B_DIV-1);
-                tcb->rtt_var += labs(tcb->srtt - rtt) / CONFIG_GNRC_TCP_RTO_B_DIV;
-                tcb->srtt = (tcb->srtt / CONFIG_GNRC_TCP_RTO_A_DIV) * (CONFIG_GNRC_TCP_RTO_A_DIV-1);
-                tcb->srtt += rtt / CONFIG_GNRC_TCP_RTO_A_DIV;
-            }
+    }
+    for (unsigned i = 0; i < tcb->rtx_len; i++) {
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+        if (tcb->congure != NULL && tcb->rtx[i].in_flight) {
+            uint32_t len = _gnrc_tcp_pkt_get_pay_len(tcb->rtx[i].pkt);
+
+            tcb->congure->driver->report_msg_discarded(tcb->congure,
+                                                       len * GNRC_TCP_CONGURE_UNIT);
         }
+#endif
+        gnrc_pktbuf_release(tcb->rtx[i].pkt);
+        tcb->rtx[i].pkt = NULL;
     }
+    tcb->rtx_len = 0;
+    tcb->dup_acks = 0;
+    tcb->status &= ~STATUS_RECOVERY;
     TCP_DEBUG_LEAVE;
-    return 0;
 }
 
 uint16_t _gnrc_tcp_pkt_calc_csum(const gnrc_pktsnip_t *hdr,
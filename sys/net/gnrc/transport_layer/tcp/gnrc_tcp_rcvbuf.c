@@ -17,28 +17,45 @@
  */
 #include <errno.h>
 #include <mutex.h>
+#include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
+#include "bitfield.h"
+#include "kernel_defines.h"
+#include "macros/utils.h"
 #include "net/gnrc/tcp/config.h"
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_fsm.h"
 #include "include/gnrc_tcp_rcvbuf.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
 /**
- * @brief Receive buffer entry.
+ * @brief Size of a receive buffer pool block.
  */
-typedef struct {
-    uint8_t used;                          /**< Flag: Is buffer in use? */
-    uint8_t buffer[GNRC_TCP_RCV_BUF_SIZE]; /**< Receive buffer storage */
-} _rcvbuf_entry_t;
+#define RCV_BUF_BLOCK_SIZE  (CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE)
+
+/**
+ * @brief Number of blocks in the receive buffer pool.
+ */
+#define RCV_BUF_BLOCKS      ((CONFIG_GNRC_TCP_RCV_BUF_POOL_SIZE + RCV_BUF_BLOCK_SIZE - 1) / \
+                             RCV_BUF_BLOCK_SIZE)
+
+/**
+ * @brief Smallest receive buffer size auto-tuning shrinks idle connections to.
+ */
+#define RCV_BUF_MIN_SIZE    (CONFIG_GNRC_TCP_MSS)
 
 /**
- * @brief Struct holding receive buffers.
+ * @brief Struct holding the receive buffer pool.
+ *
+ * A receive buffer occupies a contiguous run of blocks, allocated first fit.
  */
 typedef struct {
-    mutex_t lock;                                         /**< Access lock */
-    _rcvbuf_entry_t entries[CONFIG_GNRC_TCP_RCV_BUFFERS]; /**< Buffers */
+    mutex_t lock;                                           /**< Access lock */
+    BITFIELD(used, RCV_BUF_BLOCKS);                         /**< Blocks in use */
+    uint8_t pool[RCV_BUF_BLOCKS * RCV_BUF_BLOCK_SIZE];      /**< Buffer storage */
 } _rcvbuf_t;
 
 /**
@@ -46,21 +63,58 @@ typedef struct {
  */
 static _rcvbuf_t _static_buf;
 
+/**
+ * @brief Number of blocks needed to store @p size bytes.
+ */
+static inline size_t _blocks(size_t size)
+{
+    return (size + RCV_BUF_BLOCK_SIZE - 1) / RCV_BUF_BLOCK_SIZE;
+}
+
+/**
+ * @brief Index of the first block of an allocated receive buffer.
+ */
+static inline size_t _first_block(const uint8_t *buf)
+{
+    return (size_t)(buf - _static_buf.pool) / RCV_BUF_BLOCK_SIZE;
+}
+
+/**
+ * @brief Mark a run of blocks as used or unused. The lock must be held.
+ */
+static void _blocks_mark(size_t first, size_t num, bool used)
+{
+    for (size_t i = first; i < first + num; ++i) {
+        if (used) {
+            bf_set(_static_buf.used, i);
+        }
+        else {
+            bf_unset(_static_buf.used, i);
+        }
+    }
+}
+
 /**
  * @brief Allocate receive buffer.
  *
+ * @param[in] size   Size of the receive buffer in bytes.
+ *
  * @returns   Not NULL if a receive buffer was allocated.
  *            NULL if allocation failed.
  */
-static void* _rcvbuf_alloc(void)
+static uint8_t *_rcvbuf_alloc(size_t size)
 {
     TCP_DEBUG_ENTER;
-    void *result = NULL;
+    uint8_t *result = NULL;
+    size_t num = _blocks(size);
+    size_t run = 0;
+
     mutex_lock(&(_static_buf.lock));
-    for (size_t i = 0; i < CONFIG_GNRC_TCP_RCV_BUFFERS; ++i) {
-        if (_static_buf.entries[i].used == 0) {
-            _static_buf.entries[i].used = 1;
-            result = (void *)(_static_buf.entries[i].buffer);
+    for (size_t i = 0; i < RCV_BUF_BLOCKS; ++i) {
+        run = bf_isset(_static_buf.used, i) ? 0 : run + 1;
+        if (run == num) {
+            _blocks_mark(i + 1 - num, num, true);
+            result = &(_static_buf.pool[(i + 1 - num) * RCV_BUF_BLOCK_SIZE]);
             break;
         }
     }
@@ -72,28 +126,165 @@ static void* _rcvbuf_alloc(void)
 /**
  * @brief Release allocated receive buffer.
  *
- * @param[in] buf   Pointer to buffer that should be released.
+ * @param[in] buf    Pointer to buffer that should be released.
+ * @param[in] size   Size of the buffer in bytes.
  */
-static void _rcvbuf_free(void * const buf)
+static void _rcvbuf_free(uint8_t *buf, size_t size)
 {
     TCP_DEBUG_ENTER;
     mutex_lock(&(_static_buf.lock));
-    for (size_t i = 0; i < CONFIG_GNRC_TCP_RCV_BUFFERS; ++i) {
-        if ((_static_buf.entries[i].used == 1) && (buf == _static_buf.entries[i].buffer)) {
-            _static_buf.entries[i].used = 0;
+    _blocks_mark(_first_block(buf), _blocks(size), false);
+    mutex_unlock(&(_static_buf.lock));
+    TCP_DEBUG_LEAVE;
+}
+
+#if IS_USED(MODULE_GNRC_TCP_RCVBUF_AUTOTUNE)
+/**
+ * @brief Check if a run of blocks is unused. The lock must be held.
+ */
+static bool _blocks_unused(size_t first, size_t num)
+{
+    if (first + num > RCV_BUF_BLOCKS) {
+        return false;
+    }
+    for (size_t i = first; i < first + num; ++i) {
+        if (bf_isset(_static_buf.used, i)) {
+            return false;
         }
     }
+    return true;
+}
+
+/**
+ * @brief Shrink the receive buffer of an idle connection to its minimum size.
+ *
+ * The right edge of a window offered to the peer must not move left
+ * (RFC 1122, section 4.2.2.16). If the peer may still send more than the
+ * minimum size, the buffer is only marked to be shrunk: the window is not
+ * reopened until the peer used up the space beyond the minimum size, and the
+ * buffer is shrunk on a later call once the user consumed all data.
+ *
+ * @pre The FSM lock of @p tcb must be held.
+ *
+ * @param[in,out] tcb   TCB holding the receive buffer.
+ *
+ * @returns   True if pool memory was released.
+ */
+static bool _shrink(gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t size = MIN(_gnrc_tcp_rcvbuf_limit(tcb), RCV_BUF_MIN_SIZE);
+    size_t num = _blocks(tcb->rcv_buf.size);
+    bool synchronized = (tcb->state != FSM_STATE_CLOSED) &&
+                        (tcb->state != FSM_STATE_LISTEN);
+
+    if ((tcb->rcv_buf_raw == NULL) || (num <= _blocks(size))) {
+        tcb->status &= ~STATUS_RCV_BUF_SHRINK;
+        return false;
+    }
+    if (synchronized && (tcb->rcv_wnd > size)) {
+        tcb->status |= STATUS_RCV_BUF_SHRINK;
+        return false;
+    }
+    /* Data waiting for the user can't be moved behind its back. Give up
+     * instead of holding back window updates the user may wait for */
+    if (!ringbuffer_empty(&tcb->rcv_buf)) {
+        tcb->status &= ~STATUS_RCV_BUF_SHRINK;
+        return false;
+    }
+    mutex_lock(&(_static_buf.lock));
+    _blocks_mark(_first_block(tcb->rcv_buf_raw) + _blocks(size), num - _blocks(size), false);
     mutex_unlock(&(_static_buf.lock));
-    TCP_DEBUG_LEAVE;
+
+    ringbuffer_init(&tcb->rcv_buf, (char *) tcb->rcv_buf_raw, size);
+    tcb->status &= ~(STATUS_RCV_BUF_SHRINK | STATUS_RCV_BUF_FULL);
+    if (!synchronized) {
+        tcb->rcv_wnd = size;
+    }
+    TCP_DEBUG_INFO("Shrunk receive buffer of idle connection.");
+    return true;
+}
+
+/**
+ * @brief Shrink the receive buffers of all idle connections except @p tcb.
+ *
+ * Connections whose FSM is currently busy are skipped, so that this function
+ * never blocks on a lock held by another thread.
+ *
+ * @param[in] tcb   TCB that requests pool memory.
+ *
+ * @returns   True if pool memory was released.
+ */
+static bool _reclaim(gnrc_tcp_tcb_t *tcb)
+{
+    _gnrc_tcp_common_tcb_list_t *list = _gnrc_tcp_common_get_tcb_list();
+    bool released = false;
+
+    if (!mutex_trylock(&list->lock)) {
+        return false;
+    }
+    for (gnrc_tcp_tcb_t *iter = list->head; iter; iter = iter->next) {
+        if ((iter != tcb) && mutex_trylock(&iter->fsm_lock)) {
+            released |= _shrink(iter);
+            mutex_unlock(&iter->fsm_lock);
+        }
+    }
+    mutex_unlock(&list->lock);
+    return released;
+}
+
+/**
+ * @brief Double the receive buffer size, up to _gnrc_tcp_rcvbuf_limit().
+ *
+ * @pre The FSM lock of @p tcb must be held.
+ *
+ * @param[in,out] tcb   TCB holding the receive buffer.
+ */
+static void _grow(gnrc_tcp_tcb_t *tcb)
+{
+    ringbuffer_t *rb = &tcb->rcv_buf;
+    uint32_t size = MIN(2 * rb->size, _gnrc_tcp_rcvbuf_limit(tcb));
+    size_t first = _first_block(tcb->rcv_buf_raw);
+    size_t num = _blocks(rb->size);
+
+    if (size <= rb->size) {
+        return;
+    }
+
+    /* Grow in place if the buffered data does not wrap around and the
+     * following blocks are unused */
+    mutex_lock(&(_static_buf.lock));
+    if ((rb->start + rb->avail <= rb->size) &&
+        _blocks_unused(first + num, _blocks(size) - num)) {
+        _blocks_mark(first + num, _blocks(size) - num, true);
+        rb->size = size;
+        mutex_unlock(&(_static_buf.lock));
+        TCP_DEBUG_INFO("Grew receive buffer in place.");
+        return;
+    }
+    mutex_unlock(&(_static_buf.lock));
+
+    /* Otherwise move the buffered data into a larger buffer */
+    uint8_t *buf = _rcvbuf_alloc(size);
+    if ((buf == NULL) && _reclaim(tcb)) {
+        buf = _rcvbuf_alloc(size);
+    }
+    if (buf == NULL) {
+        return;
+    }
+    unsigned avail = ringbuffer_get(rb, (char *) buf, rb->avail);
+    _rcvbuf_free(tcb->rcv_buf_raw, rb->size);
+    tcb->rcv_buf_raw = buf;
+    ringbuffer_init(rb, (char *) buf, size);
+    rb->avail = avail;
+    TCP_DEBUG_INFO("Moved receive buffer to grow it.");
 }
+#endif
 
 void _gnrc_tcp_rcvbuf_init(void)
 {
     TCP_DEBUG_ENTER;
     mutex_init(&(_static_buf.lock));
-    for (size_t i = 0; i < CONFIG_GNRC_TCP_RCV_BUFFERS; ++i) {
-        _static_buf.entries[i].used = 0;
-    }
+    memset(_static_buf.used, 0, sizeof(_static_buf.used));
     TCP_DEBUG_LEAVE;
 }
 
@@ -101,14 +292,30 @@ int _gnrc_tcp_rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
     if (tcb->rcv_buf_raw == NULL) {
-        tcb->rcv_buf_raw = _rcvbuf_alloc();
+        uint32_t size = _gnrc_tcp_rcvbuf_limit(tcb);
+#if IS_USED(MODULE_GNRC_TCP_RCVBUF_AUTOTUNE)
+        /* Start with the default size, take memory from idle connections
+         * or fall back to the minimum size if the pool runs short */
+        size = MIN(size, GNRC_TCP_RCV_BUF_SIZE);
+        tcb->rcv_buf_raw = _rcvbuf_alloc(size);
+        if ((tcb->rcv_buf_raw == NULL) && _reclaim(tcb)) {
+            tcb->rcv_buf_raw = _rcvbuf_alloc(size);
+        }
+        if (tcb->rcv_buf_raw == NULL) {
+            size = MIN(size, RCV_BUF_MIN_SIZE);
+            tcb->rcv_buf_raw = _rcvbuf_alloc(size);
+        }
+#else
+        tcb->rcv_buf_raw = _rcvbuf_alloc(size);
+#endif
         if (tcb->rcv_buf_raw == NULL) {
             TCP_DEBUG_ERROR("-ENOMEM: Failed to allocate receive buffer.");
             TCP_DEBUG_LEAVE;
             return -ENOMEM;
         }
         else {
-            ringbuffer_init(&tcb->rcv_buf, (char *) tcb->rcv_buf_raw, GNRC_TCP_RCV_BUF_SIZE);
+            ringbuffer_init(&tcb->rcv_buf, (char *) tcb->rcv_buf_raw, size);
+            tcb->status &= ~(STATUS_RCV_BUF_SHRINK | STATUS_RCV_BUF_FULL);
         }
     }
     TCP_DEBUG_LEAVE;
@@ -119,8 +326,27 @@ void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
     if (tcb->rcv_buf_raw != NULL) {
-        _rcvbuf_free(tcb->rcv_buf_raw);
+        _rcvbuf_free(tcb->rcv_buf_raw, tcb->rcv_buf.size);
         tcb->rcv_buf_raw = NULL;
+        tcb->status &= ~(STATUS_RCV_BUF_SHRINK | STATUS_RCV_BUF_FULL);
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_rcvbuf_adjust(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+#if IS_USED(MODULE_GNRC_TCP_RCVBUF_AUTOTUNE)
+    /* A buffer waiting to be shrunk is not grown again */
+    if (tcb->status & STATUS_RCV_BUF_SHRINK) {
+        _shrink(tcb);
+    }
+    else if ((tcb->rcv_buf_raw != NULL) && (tcb->status & STATUS_RCV_BUF_FULL)) {
+        tcb->status &= ~STATUS_RCV_BUF_FULL;
+        _grow(tcb);
     }
+#else
+    (void) tcb;
+#endif
     TCP_DEBUG_LEAVE;
 }
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#pragma once
+
+/**
+ * @ingroup     net_gnrc_tcp
+ *
+ * @{
+ *
+ * @file
+ * @brief       SYN backlog of listening ports.
+ *
+ * Connection requests to a listening port are answered by the backlog instead
+ * of a listening TCB. A listening TCB takes over a connection from the backlog
+ * once the peer completed the three-way handshake. Connections completed while
+ * all TCBs of a port were busy wait in the backlog until a TCB is reopened.
+ */
+
+#include "net/gnrc/pkt.h"
+#include "net/gnrc/tcp/tcb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Connection request held by the backlog.
+ */
+typedef struct _gnrc_tcp_backlog_entry _gnrc_tcp_backlog_entry_t;
+
+/**
+ * @brief Handles a received packet addressed to a listening port.
+ *
+ * @note Must be called from the TCP eventloop. Takes the TCB list lock.
+ *
+ * @param[in] pkt   Received packet, the TCP header must be marked.
+ *
+ * @returns   Positive value if the backlog consumed @p pkt.
+ *            Zero if @p pkt must be handled by the regular TCB lookup. This
+ *            includes acknowledgments of SYN cookies while no TCB of the
+ *            port listens, so that the connection is reset.
+ */
+int _gnrc_tcp_backlog_receive(gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief Loads a connection completed in the backlog into a listening TCB.
+ *
+ * On success @p tcb holds the connection state of FSM state SYN_RCVD. If
+ * @p pkt is given, processing it afterwards completes the handshake.
+ *
+ * @note Must be called with the FSM lock of @p tcb held.
+ *
+ * @param[in,out] tcb     Listening TCB taking over the connection.
+ * @param[in]     pkt     Packet acknowledging the SYN+ACK sent by the backlog
+ *                        or NULL to take over @p entry.
+ * @param[in]     entry   Connection that was completed while no TCB was
+ *                        listening. Ignored if @p pkt is given.
+ *
+ * @returns   Zero on success.
+ *            -ENOENT if the backlog holds no matching connection.
+ */
+int _gnrc_tcp_backlog_adopt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
+                            _gnrc_tcp_backlog_entry_t *entry);
+
+/**
+ * @brief Notifies the backlog that @p tcb is listening again.
+ *
+ * Makes the eventloop hand the oldest connection completed for the port of
+ * @p tcb over to a listening TCB.
+ *
+ * @param[in] tcb   TCB that entered state LISTEN.
+ */
+void _gnrc_tcp_backlog_kick(const gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Drops all connection requests to a port.
+ *
+ * @param[in] port   Local port that is no longer listening.
+ */
+void _gnrc_tcp_backlog_flush(uint16_t port);
+
+/**
+ * @brief Retransmits due SYN+ACKs, hands over completed connections and
+ *        drops expired connection requests.
+ *
+ * @note Called by the TCP eventloop on @ref MSG_TYPE_BACKLOG_TIMEOUT.
+ */
+void _gnrc_tcp_backlog_timeout(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
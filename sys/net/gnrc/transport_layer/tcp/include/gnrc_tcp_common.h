@@ -46,8 +46,27 @@ extern "C" {
 #define STATUS_NOTIFY_USER    (1 << 2) /**< Internal: Status bitmask NOTIFY_USER */
 #define STATUS_ACCEPTED       (1 << 3) /**< Internal: Status bitmask ACCEPTED */
 #define STATUS_LOCKED         (1 << 4) /**< Internal: Status bitmask LOCKED */
+#define STATUS_RECOVERY       (1 << 5) /**< Internal: Status bitmask RECOVERY */
+#define STATUS_RCV_BUF_FULL   (1 << 6) /**< Internal: Status bitmask RCV_BUF_FULL */
+#define STATUS_RCV_BUF_SHRINK (1 << 7) /**< Internal: Status bitmask RCV_BUF_SHRINK */
 /** @} */
 
+/**
+ * @brief Flags of TCP options negotiated with the peer
+ * @{
+ */
+#define OPTION_WS        (1 << 0) /**< Internal: Options bitmask Window Scale */
+#define OPTION_SACK_PERM (1 << 1) /**< Internal: Options bitmask SACK Permitted */
+#define OPTION_TS        (1 << 2) /**< Internal: Options bitmask Timestamps */
+/** @} */
+
+/**
+ * @brief Maximum window scale shift count.
+ *
+ * @see https://tools.ietf.org/html/rfc7323#section-2.3
+ */
+#define WND_SCALE_MAX (14U) /**< Internal: Constant maximum window scale */
+
 /**
  * @brief Defines for "eventloop" thread settings.
  * @{
@@ -85,6 +104,7 @@ extern "C" {
 #define MSG_TYPE_RETRANSMISSION     (GNRC_NETAPI_MSG_TYPE_ACK + 104) /**< Internal: message id */
 #define MSG_TYPE_TIMEWAIT           (GNRC_NETAPI_MSG_TYPE_ACK + 105) /**< Internal: message id */
 #define MSG_TYPE_NOTIFY_USER        (GNRC_NETAPI_MSG_TYPE_ACK + 106) /**< Internal: message id */
+#define MSG_TYPE_BACKLOG_TIMEOUT    (GNRC_NETAPI_MSG_TYPE_ACK + 107) /**< Internal: message id */
 /** @} */
 
 /**
@@ -92,6 +112,13 @@ extern "C" {
  */
 #define RTO_UNINITIALIZED (-1) /**< Internal: Constant RTO uninitialized */
 
+/**
+ * @brief Number of duplicate ACKs triggering a fast retransmit.
+ *
+ * @see https://tools.ietf.org/html/rfc5681#section-3.2
+ */
+#define DUP_ACK_THRESHOLD (3U) /**< Internal: Constant fast retransmit threshold */
+
 /**
  * @brief Overflow tolerant comparison operators for sequence and
           acknowledgement number comparison.
@@ -19,15 +19,38 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "assert.h"
 #include "net/tcp.h"
+#include "net/gnrc/tcp/config.h"
 #include "net/gnrc/tcp/tcb.h"
+#include "gnrc_tcp_common.h"
+#include "gnrc_tcp_rcvbuf.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief Maximum number of SACK blocks evaluated per segment.
+ *
+ * @see https://tools.ietf.org/html/rfc2018#section-3
+ */
+#define GNRC_TCP_OPTION_SACK_BLOCKS_MAX (4U)
+
+/**
+ * @brief Option values carried by a single received segment.
+ */
+typedef struct {
+    uint32_t ts_val;    /**< Timestamp value, if has_ts is set */
+    uint32_t ts_ecr;    /**< Timestamp echo reply, if has_ts is set */
+    uint32_t sack_left[GNRC_TCP_OPTION_SACK_BLOCKS_MAX];  /**< Left edges of SACK blocks */
+    uint32_t sack_right[GNRC_TCP_OPTION_SACK_BLOCKS_MAX]; /**< Right edges of SACK blocks */
+    uint8_t sack_num;   /**< Number of SACK blocks */
+    bool has_ts;        /**< Segment carries a timestamps option */
+} _gnrc_tcp_option_seg_t;
+
 /**
  * @brief Helper function to build the MSS option.
  *
@@ -41,6 +64,24 @@ static inline uint32_t _gnrc_tcp_option_build_mss(uint16_t mss)
             ((uint32_t) TCP_OPTION_LENGTH_MSS << 16) | mss);
 }
 
+/**
+ * @brief Helper function to calculate the own window scale shift count.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Smallest shift count announcing the largest receive buffer
+ *            the connection may use.
+ */
+static inline uint8_t _gnrc_tcp_option_rcv_wnd_scale(const gnrc_tcp_tcb_t *tcb)
+{
+    uint8_t shift = 0;
+
+    while (((_gnrc_tcp_rcvbuf_limit(tcb) >> shift) > UINT16_MAX) && (shift < WND_SCALE_MAX)) {
+        shift++;
+    }
+    return shift;
+}
+
 /**
  * @brief Helper function to build the combined option and control flag field.
  *
@@ -58,13 +99,37 @@ static inline uint16_t _gnrc_tcp_option_build_offset_control(uint16_t nopts, uin
 /**
  * @brief Parses options of a given TCP header.
  *
+ * Options of a SYN received in state LISTEN or SYN_SENT are stored in @p tcb as
+ * negotiated options.
+ *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in]     hdr   TCP header to be parsed.
+ * @param[out]    seg   Option values of this segment.
  *
  * @returns   Zero on success.
  *            Negative value on error.
  */
-int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr);
+int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr, _gnrc_tcp_option_seg_t *seg);
+
+/**
+ * @brief Writes the options of an outgoing segment.
+ *
+ * @param[in]  tcb   TCB holding the connection information.
+ * @param[out] buf   Buffer to write the options to. If NULL, only the size is
+ *                   calculated.
+ * @param[in]  ctl   Control bits of the outgoing segment.
+ *
+ * @returns   Size of the options in bytes, always a multiple of four.
+ */
+uint8_t _gnrc_tcp_option_build(const gnrc_tcp_tcb_t *tcb, uint8_t *buf, uint16_t ctl);
+
+/**
+ * @brief Refreshes the timestamps option of a segment before it is resent.
+ *
+ * @param[in]     tcb   TCB holding the connection information.
+ * @param[in,out] hdr   TCP header of the segment.
+ */
+void _gnrc_tcp_option_update_ts(const gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr);
 
 #ifdef __cplusplus
 }
@@ -22,6 +22,7 @@
 #include <stdint.h>
 #include "net/gnrc.h"
 #include "net/gnrc/tcp/tcb.h"
+#include "gnrc_tcp_option.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -69,9 +70,12 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
  * @param[in]     out_pkt      Pointer to packet to send.
  * @param[in]     seq_con      Sequence number consumption of the packet to send.
  * @param[in]     retransmit   Flag so mark that packet this is a retransmission.
+ *                             The timestamps of a retransmission are updated
+ *                             in a copy of its headers.
  *
  * @returns   Zero on success.
  *            -EINVAL if out_pkt was NULL.
+ *            -ENOMEM if the headers of a retransmission could not be copied.
  */
 int _gnrc_tcp_pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt,
                        const uint16_t seq_con, const bool retransmit);
@@ -110,27 +114,78 @@ uint32_t _gnrc_tcp_pkt_get_pay_len(gnrc_pktsnip_t *pkt);
 /**
  * @brief Adds a packet to the retransmission mechanism.
  *
+ * @note The retransmission timer covers the oldest segment in the
+ *       retransmission queue. Only this segment can be retransmitted.
+ *
  * @param[in,out] tcb          TCB holding the connection information.
  * @param[in]     pkt          Packet to add to the retransmission mechanism.
  * @param[in]     retransmit   Flag used to indicate that @p pkt is a retransmit.
  *
  * @returns   Zero on success.
  *            -ENOMEM if the retransmission queue is full.
- *            -EINVAL if pkt is null.
+ *            -EINVAL if pkt is null or @p retransmit is set and @p pkt is not
+ *            the oldest segment in the retransmission queue.
  */
 int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
                                    const bool retransmit);
 
 /**
- * @brief Acknowledges and removes packet from the retransmission mechanism.
+ * @brief Retransmits the oldest segment, that was neither selectively
+ *        acknowledged nor resent during the current loss recovery, without
+ *        waiting for the retransmission timer.
+ *
+ * @see https://tools.ietf.org/html/rfc5681#section-3.2
+ * @see https://tools.ietf.org/html/rfc6582#section-3.2
  *
  * @param[in,out] tcb   TCB holding the connection information.
- * @param[in]     ack   Acknowldegment number used to acknowledge packets.
  *
  * @returns   Zero on success.
+ *            -ENODATA if there is nothing to retransmit.
+ */
+int _gnrc_tcp_pkt_fast_retransmit(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Retransmits the next segment during loss recovery, that is followed
+ *        by a selectively acknowledged segment.
+ *
+ * @see https://tools.ietf.org/html/rfc6675#section-5
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ *
+ * @returns   Zero on success.
+ *            -ENODATA if no segment is considered lost.
+ */
+int _gnrc_tcp_pkt_sack_retransmit(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Marks segments in the retransmission queue as selectively acknowledged.
+ *
+ * @see https://tools.ietf.org/html/rfc2018
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     seg   Option values of the received segment.
+ */
+void _gnrc_tcp_pkt_sack(gnrc_tcp_tcb_t *tcb, const _gnrc_tcp_option_seg_t *seg);
+
+/**
+ * @brief Acknowledges and removes packets from the retransmission mechanism.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     ack   Acknowldegment number used to acknowledge packets.
+ * @param[in]     seg   Option values of the acknowledging segment. May be NULL.
+ *
+ * @returns   Number of segments removed from the retransmission queue.
  *            -ENODATA if there is nothing to acknowledge.
  */
-int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack);
+int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack,
+                              const _gnrc_tcp_option_seg_t *seg);
+
+/**
+ * @brief Removes all packets from the retransmission mechanism.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_pkt_clear_retransmit(gnrc_tcp_tcb_t *tcb);
 
 /**
  * @brief Calculates checksum over payload, TCP header and network layer header.
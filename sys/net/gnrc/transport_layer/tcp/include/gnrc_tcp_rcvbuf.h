@@ -19,12 +19,26 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  */
 
+#include "net/gnrc/tcp/config.h"
 #include "net/gnrc/tcp/tcb.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief Maximum size of the receive buffer of a TCB.
+ *
+ * @param[in] tcb   TCB to get the maximum receive buffer size of.
+ *
+ * @returns   Size set by gnrc_tcp_tcb_set_rcv_buf_size() or
+ *            @ref GNRC_TCP_RCV_BUF_SIZE if none was set.
+ */
+static inline uint32_t _gnrc_tcp_rcvbuf_limit(const gnrc_tcp_tcb_t *tcb)
+{
+    return (tcb->rcv_buf_limit) ? tcb->rcv_buf_limit : GNRC_TCP_RCV_BUF_SIZE;
+}
+
 /**
  * @brief Initializes global receive buffer.
  */
@@ -33,13 +47,33 @@ void _gnrc_tcp_rcvbuf_init(void);
 /**
  * @brief Allocate receive buffer and assign it to TCB.
  *
+ * The receive buffer is allocated with the size returned by
+ * _gnrc_tcp_rcvbuf_limit(). With module `gnrc_tcp_rcvbuf_autotune`, it starts
+ * with at most @ref GNRC_TCP_RCV_BUF_SIZE bytes, or less if the pool is short
+ * on memory, and grows later on.
+ *
  * @param[in,out] tcb   TCB that acquires receive buffer.
  *
  * @returns   Zero  on success.
- *            -ENOMEM if all receive buffers are currently used.
+ *            -ENOMEM if the receive buffer pool is exhausted.
  */
 int _gnrc_tcp_rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb);
 
+/**
+ * @brief Adjust the receive buffer size after the user consumed data.
+ *
+ * With module `gnrc_tcp_rcvbuf_autotune`, the receive buffer grows up to
+ * _gnrc_tcp_rcvbuf_limit() if it ran full since the last call. A receive
+ * buffer marked with STATUS_RCV_BUF_SHRINK is shrunk instead, once the peer
+ * used up the window offered beyond the minimum size and the user consumed
+ * all data. Otherwise this function does nothing.
+ *
+ * @pre The FSM lock of @p tcb must be held.
+ *
+ * @param[in,out] tcb   TCB holding the receive buffer to adjust.
+ */
+void _gnrc_tcp_rcvbuf_adjust(gnrc_tcp_tcb_t *tcb);
+
 /**
  * @brief Release allocated receive buffer.
  *
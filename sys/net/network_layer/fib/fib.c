@@ -20,6 +20,7 @@
  */
 
 #include <assert.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdalign.h>
 #include <stdlib.h>
@@ -68,6 +69,276 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
     *target = xtimer_now_usec64() + (ms * US_PER_MS);
 }
 
+#if IS_USED(MODULE_FIB_TRIE)
+static_assert((UNIVERSAL_ADDRESS_SIZE + 1) * 8 <= UINT8_MAX,
+              "fib_trie_node_t::len is too small for UNIVERSAL_ADDRESS_SIZE");
+
+/**
+ * @brief returns the bit at position @p pos of a prefix tree key
+ */
+static inline unsigned fib_trie_bit(const uint8_t *key, unsigned pos)
+{
+    return (key[pos >> 3] >> (7 - (pos & 0x7))) & 0x1;
+}
+
+/**
+ * @brief returns the number of equal leading bits of two prefix tree keys,
+ *        at most @p max
+ */
+static unsigned fib_trie_common_bits(const uint8_t *a, const uint8_t *b,
+                                     unsigned max)
+{
+    for (unsigned i = 0; (i << 3) < max; i++) {
+        uint8_t diff = a[i] ^ b[i];
+
+        if (diff != 0) {
+            unsigned bits = i << 3;
+
+            while (!(diff & 0x80)) {
+                diff <<= 1;
+                bits++;
+            }
+            return (bits < max) ? bits : max;
+        }
+    }
+    return max;
+}
+
+/**
+ * @brief writes the prefix tree key for the given address to @p key
+ */
+static void fib_trie_set_key(uint8_t *key, const uint8_t *addr, size_t addr_size)
+{
+    key[0] = addr_size;
+    memcpy(&key[1], addr, addr_size);
+    memset(&key[1 + addr_size], 0, UNIVERSAL_ADDRESS_SIZE - addr_size);
+}
+
+static inline bool fib_trie_is_branch(const fib_table_t *table,
+                                      const fib_trie_node_t *node)
+{
+    return node >= &table->trie[table->size];
+}
+
+static inline fib_entry_t *fib_trie_entry(fib_table_t *table,
+                                          const fib_trie_node_t *node)
+{
+    return &table->data.entries[node - table->trie];
+}
+
+/**
+ * @brief allocates a branch node of the prefix tree
+ *
+ * Branch nodes always have two children, so a table of `size` entries never
+ * needs more than `size - 1` of them.
+ */
+static fib_trie_node_t *fib_trie_alloc_branch(fib_table_t *table)
+{
+    for (size_t i = table->size; i < FIB_TRIE_NODES_NUMOF(table->size); i++) {
+        if (table->trie[i].child[0] == NULL) {
+            return &table->trie[i];
+        }
+    }
+    assert(false);
+    return NULL;
+}
+
+static inline void fib_trie_free_branch(fib_trie_node_t *node)
+{
+    memset(node, 0, sizeof(*node));
+}
+
+/**
+ * @brief adds the given (newly created) entry to the prefix tree
+ */
+static void fib_trie_add(fib_table_t *table, fib_entry_t *entry)
+{
+    fib_trie_node_t *node = &table->trie[entry - table->data.entries];
+    fib_trie_node_t **link = &table->trie_root;
+    size_t addr_size = entry->global->address_size;
+    bool is_all_zeros_addr = true;
+
+    for (size_t i = 0; i < addr_size; i++) {
+        if (entry->global->address[i] != 0) {
+            is_all_zeros_addr = false;
+            break;
+        }
+    }
+    memset(node, 0, sizeof(*node));
+    fib_trie_set_key(node->key, entry->global->address, addr_size);
+    if (is_all_zeros_addr) {
+        /* default route, matches any address of the same size */
+        node->len = 8;
+    }
+    else if (entry->global_flags & FIB_FLAG_NET_PREFIX_MASK) {
+        unsigned prefix_len = (entry->global_flags & FIB_FLAG_NET_PREFIX_MASK)
+                              >> FIB_FLAG_NET_PREFIX_SHIFT;
+
+        node->len = 8 + ((prefix_len < (addr_size << 3)) ? prefix_len
+                                                          : (addr_size << 3));
+    }
+    else {
+        node->len = 8 + (addr_size << 3);
+    }
+
+    while (*link != NULL) {
+        fib_trie_node_t *cur = *link;
+        unsigned common = fib_trie_common_bits(node->key, cur->key,
+                                               (node->len < cur->len) ? node->len
+                                                                      : cur->len);
+
+        if ((common == cur->len) && (common == node->len)) {
+            if (fib_trie_is_branch(table, cur)) {
+                /* take over the position of the branch node */
+                node->child[0] = cur->child[0];
+                node->child[1] = cur->child[1];
+                *link = node;
+                fib_trie_free_branch(cur);
+            }
+            else {
+                /* same key as an existing entry */
+                node->next = cur->next;
+                cur->next = node;
+            }
+            return;
+        }
+        else if (common == cur->len) {
+            link = &cur->child[fib_trie_bit(node->key, cur->len)];
+        }
+        else if (common == node->len) {
+            node->child[fib_trie_bit(cur->key, node->len)] = cur;
+            *link = node;
+            return;
+        }
+        else {
+            fib_trie_node_t *branch = fib_trie_alloc_branch(table);
+
+            memcpy(branch->key, node->key, sizeof(branch->key));
+            branch->len = common;
+            branch->child[fib_trie_bit(node->key, common)] = node;
+            branch->child[fib_trie_bit(cur->key, common)] = cur;
+            *link = branch;
+            return;
+        }
+    }
+    *link = node;
+}
+
+/**
+ * @brief removes the given entry from the prefix tree
+ */
+static void fib_trie_remove(fib_table_t *table, fib_entry_t *entry)
+{
+    fib_trie_node_t *node = &table->trie[entry - table->data.entries];
+    fib_trie_node_t **link = &table->trie_root;
+    fib_trie_node_t **parent_link = NULL;
+
+    while ((*link != NULL) && ((*link)->len < node->len)) {
+        parent_link = link;
+        link = &(*link)->child[fib_trie_bit(node->key, (*link)->len)];
+    }
+    assert(*link != NULL);
+
+    fib_trie_node_t *head = *link;
+
+    if (head != node) {
+        /* node is not part of the tree itself, just unlink it from the
+         * entries with the same key */
+        while (head->next != node) {
+            head = head->next;
+            assert(head != NULL);
+        }
+        head->next = node->next;
+    }
+    else if (node->next != NULL) {
+        /* the next entry with the same key replaces node */
+        node->next->child[0] = node->child[0];
+        node->next->child[1] = node->child[1];
+        *link = node->next;
+    }
+    else if ((node->child[0] != NULL) && (node->child[1] != NULL)) {
+        fib_trie_node_t *branch = fib_trie_alloc_branch(table);
+
+        memcpy(branch, node, sizeof(*branch));
+        *link = branch;
+    }
+    else if ((node->child[0] != NULL) || (node->child[1] != NULL)) {
+        *link = (node->child[0] != NULL) ? node->child[0] : node->child[1];
+    }
+    else {
+        *link = NULL;
+        if ((parent_link != NULL) && fib_trie_is_branch(table, *parent_link)) {
+            /* branch node is left with only one child => replace it */
+            fib_trie_node_t *branch = *parent_link;
+
+            *parent_link = (branch->child[0] != NULL) ? branch->child[0]
+                                                      : branch->child[1];
+            fib_trie_free_branch(branch);
+        }
+    }
+    memset(node, 0, sizeof(*node));
+}
+
+static int fib_remove(fib_table_t *table, fib_entry_t *entry);
+
+/**
+ * @brief prefix tree variant of fib_find_entry()
+ */
+static int fib_trie_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
+                               fib_entry_t **entry_arr, size_t *entry_arr_size)
+{
+    uint64_t now = xtimer_now_usec64();
+    uint8_t key[UNIVERSAL_ADDRESS_SIZE + 1];
+    unsigned key_len = 8 + (dst_size << 3);
+    fib_entry_t *match;
+
+    *entry_arr_size = 0;
+    if (dst_size > UNIVERSAL_ADDRESS_SIZE) {
+        return -EHOSTUNREACH;
+    }
+    fib_trie_set_key(key, dst, dst_size);
+
+restart:
+    match = NULL;
+    for (fib_trie_node_t *node = table->trie_root;
+         (node != NULL) && (node->len <= key_len) &&
+         (fib_trie_common_bits(key, node->key, node->len) == node->len);
+         node = (node->len < key_len) ? node->child[fib_trie_bit(key, node->len)]
+                                      : NULL) {
+        if (fib_trie_is_branch(table, node)) {
+            continue;
+        }
+        for (fib_trie_node_t *tmp = node; tmp != NULL; tmp = tmp->next) {
+            fib_entry_t *entry = fib_trie_entry(table, tmp);
+
+            /* autoinvalidate if the entry lifetime is not set to not expire */
+            if ((entry->lifetime != FIB_LIFETIME_NO_EXPIRE) &&
+                (entry->lifetime < now)) {
+                /* removing changes the tree, so start over */
+                fib_remove(table, entry);
+                goto restart;
+            }
+            if (memcmp(entry->global->address, dst, dst_size) == 0) {
+                /* we will not find a better one so we return */
+                entry_arr[0] = entry;
+                *entry_arr_size = 1;
+                return 1;
+            }
+            /* all entries on the path but exact matches are prefixes or the
+             * default route, the deeper the better */
+            match = entry;
+        }
+    }
+
+    if (match == NULL) {
+        return -EHOSTUNREACH;
+    }
+    entry_arr[0] = match;
+    *entry_arr_size = 1;
+    return 0;
+}
+#endif /* MODULE_FIB_TRIE */
+
 /**
  * @brief returns pointer to the entry for the given destination address
  *
@@ -84,6 +355,12 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
  */
 static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
                           fib_entry_t **entry_arr, size_t *entry_arr_size) {
+#if IS_USED(MODULE_FIB_TRIE)
+    if (table->trie != NULL) {
+        return fib_trie_find_entry(table, dst, dst_size, entry_arr,
+                                   entry_arr_size);
+    }
+#endif
     uint64_t now = xtimer_now_usec64();
 
     size_t count = 0;
@@ -250,6 +527,23 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
                             uint8_t *next_hop, size_t next_hop_size, uint32_t
                             next_hop_flags, uint32_t lifetime)
 {
+#if IS_USED(MODULE_FIB_TRIE)
+    if (table->trie != NULL) {
+        /* look-ups do not visit all entries, so expired entries might not
+         * have been removed yet */
+        uint64_t now = xtimer_now_usec64();
+
+        for (size_t i = 0; i < table->size; ++i) {
+            if ((table->data.entries[i].lifetime != 0) &&
+                (table->data.entries[i].lifetime != FIB_LIFETIME_NO_EXPIRE) &&
+                (table->data.entries[i].lifetime < now)) {
+                fib_remove(table, &table->data.entries[i]);
+                break;
+            }
+        }
+    }
+#endif
+
     for (size_t i = 0; i < table->size; ++i) {
         if (table->data.entries[i].lifetime == 0) {
 
@@ -271,6 +565,11 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
                 else {
                     table->data.entries[i].lifetime = FIB_LIFETIME_NO_EXPIRE;
                 }
+#if IS_USED(MODULE_FIB_TRIE)
+                if (table->trie != NULL) {
+                    fib_trie_add(table, &table->data.entries[i]);
+                }
+#endif
 
                 return 0;
             }
@@ -283,13 +582,21 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
 /**
  * @brief removes the given entry
  *
+ * @param[in] table the FIB table the entry belongs to
  * @param[in] entry the entry to be removed
  *
  * @return 0 on success
  */
-static int fib_remove(fib_entry_t *entry)
+static int fib_remove(fib_table_t *table, fib_entry_t *entry)
 {
     if (entry->global != NULL) {
+#if IS_USED(MODULE_FIB_TRIE)
+        if (table->trie != NULL) {
+            fib_trie_remove(table, entry);
+        }
+#else
+        (void)table;
+#endif
         universal_address_rem(entry->global);
     }
 
@@ -462,7 +769,7 @@ void fib_remove_entry(fib_table_t *table, uint8_t *dst, size_t dst_size)
 
     if (ret == 1) {
         /* we must take the according entry and update the values */
-        fib_remove(entry[0]);
+        fib_remove(table, entry[0]);
     }
     else {
         /* we have ambiguous entries, i.e. count > 1
@@ -482,7 +789,7 @@ void fib_flush(fib_table_t *table, kernel_pid_t interface)
     for (size_t i = 0; i < table->size; ++i) {
         if ((interface == KERNEL_PID_UNDEF) ||
             (interface == table->data.entries[i].iface_id)) {
-            fib_remove(&table->data.entries[i]);
+            fib_remove(table, &table->data.entries[i]);
         }
     }
 
@@ -603,6 +910,13 @@ void fib_init(fib_table_t *table)
     }
     else {
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
+#if IS_USED(MODULE_FIB_TRIE)
+        if (table->trie != NULL) {
+            memset(table->trie, 0,
+                   FIB_TRIE_NODES_NUMOF(table->size) * sizeof(fib_trie_node_t));
+        }
+        table->trie_root = NULL;
+#endif
     }
     universal_address_init();
     mutex_unlock(&(table->mtx_access));
@@ -628,6 +942,13 @@ void fib_deinit(fib_table_t *table)
     }
     else {
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
+#if IS_USED(MODULE_FIB_TRIE)
+        if (table->trie != NULL) {
+            memset(table->trie, 0,
+                   FIB_TRIE_NODES_NUMOF(table->size) * sizeof(fib_trie_node_t));
+        }
+        table->trie_root = NULL;
+#endif
     }
     universal_address_reset();
     mutex_unlock(&(table->mtx_access));
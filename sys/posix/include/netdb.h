@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#pragma once
+
+/**
+ * @defgroup posix_netdb    POSIX network database
+ * @ingroup  posix
+ * @brief   Name resolution for RIOT
+ *
+ * `getaddrinfo()` resolves names with the @ref net_sock_dns_async, so
+ * concurrent calls for the same name share their queries, and an `AF_UNSPEC`
+ * call sends the A and the AAAA query at the same time.
+ *
+ * @see     [The Open Group Base Specification Issue 7]
+ *          (https://pubs.opengroup.org/onlinepubs/9699919799.2018edition/)
+ * @todo    Omitted from original specification for now:
+ *          - `getnameinfo()` and the host, network, protocol and service
+ *            databases
+ *          - services given by name, only port numbers are supported
+ *          - `AI_V4MAPPED`, `AI_ALL` and `AI_ADDRCONFIG`
+ * @{
+ *
+ * @file
+ * @brief   Definitions for network database operations
+ * @see     [The Open Group Base Specification Issue 7, 2018 edition,
+ *          <netdb.h>](https://pubs.opengroup.org/onlinepubs/9699919799.2018edition/basedefs/netdb.h.html)
+ */
+
+#ifdef CPU_NATIVE
+/* On native, the system's <netdb.h> is needed by the CPU itself, and RIOT's
+ * functions replace the system's. Hence, include the real netdb.h here. */
+__extension__
+#include_next <netdb.h>
+#else /* CPU_NATIVE */
+
+#include <sys/socket.h>
+
+#include "netinet/in.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Address information
+ */
+struct addrinfo {
+    int ai_flags;                   /**< Input flags */
+    int ai_family;                  /**< Address family of socket */
+    int ai_socktype;                /**< Socket type */
+    int ai_protocol;                /**< Protocol of socket */
+    socklen_t ai_addrlen;           /**< Length of socket address */
+    struct sockaddr *ai_addr;       /**< Socket address of socket */
+    char *ai_canonname;             /**< Canonical name of service location */
+    struct addrinfo *ai_next;       /**< Pointer to next in list */
+};
+
+/**
+ * @name    Flags for `ai_flags` of the hints to @ref getaddrinfo()
+ * @{
+ */
+#define AI_PASSIVE      (0x0001)    /**< Socket address is intended for `bind()` */
+#define AI_CANONNAME    (0x0002)    /**< Request for canonical name */
+#define AI_NUMERICHOST  (0x0004)    /**< Return numeric host address as name */
+#define AI_NUMERICSERV  (0x0400)    /**< Inhibit service name resolution */
+/** @} */
+
+/**
+ * @name    Error values of @ref getaddrinfo()
+ * @{
+ */
+#define EAI_BADFLAGS    (-1)        /**< The flags had an invalid value */
+#define EAI_NONAME      (-2)        /**< The name does not resolve */
+#define EAI_AGAIN       (-3)        /**< The name could not be resolved at this time */
+#define EAI_FAIL        (-4)        /**< A non-recoverable error occurred */
+#define EAI_FAMILY      (-6)        /**< The address family is not supported */
+#define EAI_SOCKTYPE    (-7)        /**< The socket type is not supported */
+#define EAI_SERVICE     (-8)        /**< The service is not supported */
+#define EAI_MEMORY      (-10)       /**< There was a memory allocation failure */
+#define EAI_SYSTEM      (-11)       /**< A system error occurred, see `errno` */
+#define EAI_OVERFLOW    (-12)       /**< An argument buffer overflowed */
+/** @} */
+
+/**
+ * @brief   Get address information
+ *
+ * Numeric addresses are converted without a DNS query. For `AF_UNSPEC`, the
+ * list starts with the IPv6 address of the name, followed by its IPv4
+ * address.
+ *
+ * @note    The DNS resolver calls back from an event thread. Calling this
+ *          function from the event thread of
+ *          @ref CONFIG_SOCK_DNS_ASYNC_EVENT_PRIO deadlocks.
+ *
+ * @param[in] nodename      A host name or a numeric address. May be NULL if
+ *                          @p servname is not NULL.
+ * @param[in] servname      A port number. May be NULL if @p nodename is not
+ *                          NULL.
+ * @param[in] hints         Preferred socket type, address family and flags.
+ *                          May be NULL.
+ * @param[out] res          List of the addresses, free with @ref freeaddrinfo()
+ *
+ * @return  0 on success
+ * @return  one of the `EAI_*` values on error
+ */
+int getaddrinfo(const char *restrict nodename, const char *restrict servname,
+                const struct addrinfo *restrict hints,
+                struct addrinfo **restrict res);
+
+/**
+ * @brief   Free address information
+ *
+ * @param[in] ai    List returned by @ref getaddrinfo()
+ */
+void freeaddrinfo(struct addrinfo *ai);
+
+/**
+ * @brief   Get the error message of @ref getaddrinfo()
+ *
+ * @param[in] ecode     One of the `EAI_*` values
+ *
+ * @return  The error message
+ */
+const char *gai_strerror(int ecode);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CPU_NATIVE */
+
+/** @} */
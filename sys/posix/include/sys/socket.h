@@ -21,7 +21,8 @@
  *          </a>
  *
  * @todo Omitted from original specification for now:
- * * struct msghdr, struct cmesghdr, and struct linger and all related defines
+ * * struct cmesghdr, and struct linger and all related defines
+ * * sendmsg() and recvmsg()
  * * getsockopt()/setsockopt() and all related defines.
  * * shutdown() and all related defines.
  * * sockatmark()
@@ -42,6 +43,7 @@
 #include <stdlib.h>
 #include <sys/types.h>
 #include <sys/uio.h>
+#include <time.h>
 
 #include "architecture.h"
 #include "net/af.h"
@@ -143,6 +145,27 @@ struct sockaddr_storage {
     uint8_t ss_data[SOCKADDR_MAX_DATA_LEN]; /**< Socket address */
 };
 
+/**
+ * @brief   Message header of a scatter/gather message
+ */
+struct msghdr {
+    void *msg_name;             /**< Optional address */
+    socklen_t msg_namelen;      /**< Size of address */
+    struct iovec *msg_iov;      /**< Scatter/gather array */
+    int msg_iovlen;             /**< Members in msg_iov */
+    void *msg_control;          /**< Ancillary data, not supported */
+    socklen_t msg_controllen;   /**< Ancillary data buffer len */
+    int msg_flags;              /**< Flags on received message */
+};
+
+/**
+ * @brief   Message for recvmmsg()
+ */
+struct mmsghdr {
+    struct msghdr msg_hdr;      /**< The message */
+    unsigned int msg_len;       /**< Number of bytes received */
+};
+
 /**
  * @brief   Accept a new connection on a socket
  * @details The accept() function shall extract the first connection on the
@@ -388,6 +411,35 @@ static inline ssize_t recv(int socket, void *buffer, size_t length, int flags)
     return recvfrom(socket, buffer, length, flags, NULL, NULL);
 }
 
+/**
+ * @brief   Receive multiple messages from a socket.
+ * @details Receives a batch of messages from a connectionless-mode socket,
+ *          like calling recvfrom() for each of them. Only the first message is
+ *          waited for, the call returns when no further message is available
+ *          (as with `MSG_WAITFORONE` of the Linux API).
+ *
+ * @note    This is a non-standard extension known from Linux. Only
+ *          `SOCK_DGRAM` sockets are supported and each message must have
+ *          exactly one I/O vector element.
+ *
+ * @param[in] socket        Specifies the socket file descriptor.
+ * @param[in,out] msgvec    The messages to receive. mmsghdr::msg_len is set to
+ *                          the length of each received message,
+ *                          msghdr::msg_name and msghdr::msg_namelen to its
+ *                          sender as with recvfrom().
+ * @param[in] vlen          Number of elements in @p msgvec.
+ * @param[in] flags         Specifies the type of message reception. Support
+ *                          for values other than 0 is not implemented yet.
+ * @param[in] timeout       Timeout for the first message. May be NULL to use
+ *                          the receive timeout of the socket.
+ *
+ * @return  Upon successful completion, recvmmsg() shall return the number of
+ *          messages received. Otherwise, -1 shall be returned and errno set to
+ *          indicate the error.
+ */
+int recvmmsg(int socket, struct mmsghdr *msgvec, unsigned int vlen, int flags,
+             struct timespec *timeout);
+
 /**
  * @brief   Send a message on a socket.
  * @details Shall send a message through a connection-mode or
@@ -0,0 +1,322 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief   Network database implementation
+ */
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netdb.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "modules.h"
+#include "mutex.h"
+#include "net/sock/dns_async.h"
+
+#define AI_SUPPORTED    (AI_PASSIVE | AI_CANONNAME | AI_NUMERICHOST | AI_NUMERICSERV)
+
+#ifndef INADDR_LOOPBACK
+#define INADDR_LOOPBACK ((in_addr_t)0x7f000001)
+#endif
+
+typedef struct {
+    struct addrinfo ai;
+    union {
+        struct sockaddr_in in;
+        struct sockaddr_in6 in6;
+    } addr;
+} _addrinfo_t;
+
+typedef struct {
+    sock_dns_async_req_t req;
+    mutex_t done;
+    int family;
+    int res;
+    uint8_t addr[sizeof(struct in6_addr)];
+} _lookup_t;
+
+static void _resolved(void *arg, int res, const void *addr)
+{
+    _lookup_t *lookup = arg;
+
+    lookup->res = res;
+    if (res > 0) {
+        memcpy(lookup->addr, addr, res);
+    }
+    mutex_unlock(&lookup->done);
+}
+
+static int _eai(int res)
+{
+    switch (res) {
+    case -ENXIO:
+        return EAI_NONAME;
+    case -ETIMEDOUT:
+    case -ENOBUFS:
+        return EAI_AGAIN;
+    case -ENOSPC:
+        return EAI_OVERFLOW;
+    case -EAFNOSUPPORT:
+        return EAI_FAMILY;
+    default:
+        return EAI_FAIL;
+    }
+}
+
+static int _parse_port(const char *servname, int flags, in_port_t *port)
+{
+    char *end;
+    unsigned long num;
+
+    if (servname == NULL) {
+        *port = 0;
+        return 0;
+    }
+    num = strtoul(servname, &end, 10);
+    if ((*servname == '\0') || (*end != '\0') || (num > UINT16_MAX)) {
+        /* there is no service database */
+        return (flags & AI_NUMERICSERV) ? EAI_NONAME : EAI_SERVICE;
+    }
+    *port = htons(num);
+    return 0;
+}
+
+static int _append(struct addrinfo ***tail, const struct addrinfo *hints,
+                   const char *canonname, int family, const void *addr,
+                   in_port_t port)
+{
+    size_t len = sizeof(_addrinfo_t);
+    _addrinfo_t *entry;
+
+    if (canonname) {
+        len += strlen(canonname) + 1;
+    }
+    if ((entry = calloc(1, len)) == NULL) {
+        return EAI_MEMORY;
+    }
+    entry->ai.ai_family = family;
+    entry->ai.ai_socktype = hints->ai_socktype;
+    entry->ai.ai_protocol = hints->ai_protocol;
+    entry->ai.ai_addr = (struct sockaddr *)&entry->addr;
+    if (family == AF_INET6) {
+        entry->ai.ai_addrlen = sizeof(entry->addr.in6);
+        entry->addr.in6.sin6_family = AF_INET6;
+        entry->addr.in6.sin6_port = port;
+        memcpy(&entry->addr.in6.sin6_addr, addr, sizeof(entry->addr.in6.sin6_addr));
+    }
+    else {
+        entry->ai.ai_addrlen = sizeof(entry->addr.in);
+        entry->addr.in.sin_family = AF_INET;
+        entry->addr.in.sin_port = port;
+        memcpy(&entry->addr.in.sin_addr, addr, sizeof(entry->addr.in.sin_addr));
+    }
+    if (canonname) {
+        entry->ai.ai_canonname = (char *)(entry + 1);
+        strcpy(entry->ai.ai_canonname, canonname);
+    }
+    **tail = &entry->ai;
+    *tail = &entry->ai.ai_next;
+    return 0;
+}
+
+static unsigned _families(int family, int *families)
+{
+    unsigned numof = 0;
+
+    /* IPv6 addresses come first */
+    if ((family == AF_INET6) ||
+        ((family == AF_UNSPEC) && IS_USED(MODULE_IPV6_ADDR))) {
+        families[numof++] = AF_INET6;
+    }
+    if ((family == AF_INET) ||
+        ((family == AF_UNSPEC) && IS_USED(MODULE_IPV4_ADDR))) {
+        families[numof++] = AF_INET;
+    }
+    return numof;
+}
+
+/* without a node name, the unspecified or the loopback address */
+static int _local(struct addrinfo ***tail, const struct addrinfo *hints,
+                  const int *families, unsigned numof, in_port_t port)
+{
+    static const struct in6_addr in6_any = IN6ADDR_ANY_INIT;
+    static const struct in6_addr in6_loopback = IN6ADDR_LOOPBACK_INIT;
+    bool passive = hints->ai_flags & AI_PASSIVE;
+    int res = 0;
+
+    for (unsigned i = 0; (i < numof) && !res; i++) {
+        if (families[i] == AF_INET6) {
+            res = _append(tail, hints, NULL, AF_INET6,
+                          passive ? &in6_any : &in6_loopback, port);
+        }
+        else {
+            struct in_addr in4 = {
+                .s_addr = htonl(passive ? INADDR_ANY : INADDR_LOOPBACK)
+            };
+            res = _append(tail, hints, NULL, AF_INET, &in4, port);
+        }
+    }
+    return res;
+}
+
+static int _resolve(struct addrinfo ***tail, const struct addrinfo *hints,
+                    const char *nodename, const int *families, unsigned numof,
+                    in_port_t port)
+{
+    const char *canonname = (hints->ai_flags & AI_CANONNAME) ? nodename : NULL;
+    _lookup_t lookups[2];
+    int err = EAI_NONAME;
+
+    /* the queries for all families are sent at the same time */
+    for (unsigned i = 0; i < numof; i++) {
+        _lookup_t *lookup = &lookups[i];
+
+        lookup->family = families[i];
+        mutex_init_locked(&lookup->done);
+        int res = sock_dns_query_async(&lookup->req, nodename, families[i],
+                                       _resolved, lookup);
+        if (res < 0) {
+            lookup->res = res;
+            mutex_unlock(&lookup->done);
+        }
+    }
+
+    /* wait for all callbacks, the lookups are on the stack */
+    for (unsigned i = 0; i < numof; i++) {
+        _lookup_t *lookup = &lookups[i];
+
+        mutex_lock(&lookup->done);
+        if (err == EAI_MEMORY) {
+            continue;
+        }
+        if (lookup->res > 0) {
+            err = _append(tail, hints, canonname, lookup->family, lookup->addr,
+                          port);
+            canonname = NULL;
+        }
+        else if ((err != 0) && (_eai(lookup->res) != EAI_NONAME)) {
+            /* a family without address does not hide a failure of another */
+            err = _eai(lookup->res);
+        }
+    }
+    return err;
+}
+
+int getaddrinfo(const char *restrict nodename, const char *restrict servname,
+                const struct addrinfo *restrict hints,
+                struct addrinfo **restrict res)
+{
+    static const struct addrinfo no_hints = { .ai_family = AF_UNSPEC };
+    struct addrinfo **tail = res;
+    int families[2];
+    unsigned numof;
+    in_port_t port;
+    int err;
+
+    *res = NULL;
+    if ((nodename == NULL) && (servname == NULL)) {
+        return EAI_NONAME;
+    }
+    if (hints == NULL) {
+        hints = &no_hints;
+    }
+    if (hints->ai_flags & ~AI_SUPPORTED) {
+        return EAI_BADFLAGS;
+    }
+    if ((hints->ai_socktype != 0) && (hints->ai_socktype != SOCK_DGRAM) &&
+        (hints->ai_socktype != SOCK_STREAM)) {
+        return EAI_SOCKTYPE;
+    }
+    if ((hints->ai_family != AF_UNSPEC) && (hints->ai_family != AF_INET) &&
+        (hints->ai_family != AF_INET6)) {
+        return EAI_FAMILY;
+    }
+    if ((err = _parse_port(servname, hints->ai_flags, &port)) != 0) {
+        return err;
+    }
+    numof = _families(hints->ai_family, families);
+
+    if (nodename == NULL) {
+        err = _local(&tail, hints, families, numof, port);
+    }
+    else {
+        uint8_t addr[sizeof(struct in6_addr)];
+        int family = AF_UNSPEC;
+
+        for (unsigned i = 0; (i < numof) && (family == AF_UNSPEC); i++) {
+            if (inet_pton(families[i], nodename, addr) == 1) {
+                family = families[i];
+            }
+        }
+        if (family != AF_UNSPEC) {
+            const char *canonname = (hints->ai_flags & AI_CANONNAME) ? nodename : NULL;
+
+            err = _append(&tail, hints, canonname, family, addr, port);
+        }
+        else if (hints->ai_flags & AI_NUMERICHOST) {
+            err = EAI_NONAME;
+        }
+        else {
+            err = _resolve(&tail, hints, nodename, families, numof, port);
+        }
+    }
+
+    if (err != 0) {
+        freeaddrinfo(*res);
+        *res = NULL;
+    }
+    return err;
+}
+
+void freeaddrinfo(struct addrinfo *ai)
+{
+    while (ai) {
+        struct addrinfo *next = ai->ai_next;
+
+        /* the address and the canonical name are part of the entry */
+        free(ai);
+        ai = next;
+    }
+}
+
+const char *gai_strerror(int ecode)
+{
+    switch (ecode) {
+    case 0:
+        return "Success";
+    case EAI_BADFLAGS:
+        return "Bad value for ai_flags";
+    case EAI_NONAME:
+        return "Name or service not known";
+    case EAI_AGAIN:
+        return "Temporary failure in name resolution";
+    case EAI_FAIL:
+        return "Non-recoverable failure in name resolution";
+    case EAI_FAMILY:
+        return "ai_family not supported";
+    case EAI_SOCKTYPE:
+        return "ai_socktype not supported";
+    case EAI_SERVICE:
+        return "Servname not supported for ai_socktype";
+    case EAI_MEMORY:
+        return "Memory allocation failure";
+    case EAI_SYSTEM:
+        return "System error";
+    case EAI_OVERFLOW:
+        return "Argument buffer overflow";
+    default:
+        return "Unknown error";
+    }
+}
+
+/** @} */
@@ -24,7 +24,7 @@
 #if IS_USED(MODULE_POSIX_SOCKETS)
 extern bool posix_socket_is(int fd);
 extern unsigned posix_socket_avail(int fd);
-extern void posix_socket_select(int fd);
+extern int posix_socket_select(int fd);
 #else   /* MODULE_POSIX_SOCKETS */
 static inline bool posix_socket_is(int fd)
 {
@@ -38,7 +38,7 @@ static inline unsigned posix_socket_avail(int fd)
     return 0;
 }
 
-static inline void posix_socket_select(int fd)
+static inline int posix_socket_select(int fd)
 {
     (void)fd;
     return 0;
@@ -25,10 +25,12 @@
 #include <string.h>
 
 #include "bitfield.h"
+#include "macros/utils.h"
 #include "mutex.h"
 #include "net/ipv4/addr.h"
 #include "net/ipv6/addr.h"
 #include "random.h"
+#include "timex.h"
 #include "vfs.h"
 
 #include "sys/socket.h"
@@ -52,6 +54,8 @@
 #define _ACTUAL_SOCKET_POOL_SIZE   (SOCKET_POOL_SIZE + \
                                     (SOCKET_POOL_SIZE * SOCKET_TCP_QUEUE_SIZE))
 #define SOCKET_BLKSIZE             (512)
+/* messages taken from the sock at once by recvmmsg() */
+#define SOCKET_MMSG_BATCH_SIZE     (4U)
 
 /**
  * @brief   Unitfied connection type.
@@ -370,7 +374,9 @@ static void _async_cb(void *sock, sock_async_flags_t type,
     socket_t *socket = arg;
 
     (void)sock;
-    if (type & SOCK_ASYNC_MSG_RECV) {
+    /* Incoming connections and the end of a stream make a socket readable,
+     * too */
+    if (type & (SOCK_ASYNC_MSG_RECV | SOCK_ASYNC_CONN_RECV | SOCK_ASYNC_CONN_FIN)) {
         atomic_fetch_add(&socket->available, 1);
 #if IS_USED(MODULE_POSIX_SELECT)
         if (socket->selecting_thread) {
@@ -512,6 +518,10 @@ int accept(int socket, struct sockaddr *restrict address,
     const uint32_t recv_timeout = SOCK_NO_TIMEOUT;
 #endif
 
+#if IS_USED(MODULE_SOCK_ASYNC)
+    const unsigned available = atomic_load(&s->available);
+#endif
+
     switch (s->type) {
     case SOCK_STREAM:
         new_s = _get_free_socket();
@@ -561,6 +571,10 @@ int accept(int socket, struct sockaddr *restrict address,
             new_s->queue_array_len = 0;
             new_s->sock = (socket_sock_t *)sock;
 #if IS_USED(MODULE_SOCK_ASYNC)
+            /* One pending connection less */
+            if (available > 0) {
+                atomic_fetch_sub(&s->available, 1);
+            }
             _sock_set_cb(new_s);
 #endif
             memset(&s->local, 0, sizeof(sock_tcp_ep_t));
@@ -948,6 +962,9 @@ static ssize_t socket_recvfrom(socket_t *s, void *restrict buffer,
 #else
     const uint32_t recv_timeout = SOCK_NO_TIMEOUT;
 #endif
+#if IS_USED(MODULE_SOCK_ASYNC) && defined(MODULE_SOCK_TCP)
+    const unsigned available = atomic_load(&s->available);
+#endif
 
     switch (s->type) {
 #ifdef MODULE_SOCK_IP
@@ -960,6 +977,13 @@ static ssize_t socket_recvfrom(socket_t *s, void *restrict buffer,
     case SOCK_STREAM:
         res = sock_tcp_read(&s->sock->tcp.sock, buffer, length,
                             recv_timeout);
+#if IS_USED(MODULE_SOCK_ASYNC)
+        /* A stream stays readable until a read leaves its receive buffer
+         * empty, events that arrived meanwhile are kept */
+        if ((res == -EAGAIN) || ((res > 0) && ((size_t)res < length))) {
+            atomic_fetch_sub(&s->available, available);
+        }
+#endif
         break;
 #endif
 #ifdef MODULE_SOCK_UDP
@@ -977,7 +1001,9 @@ static ssize_t socket_recvfrom(socket_t *s, void *restrict buffer,
     }
     if ((res >= 0) && (address != NULL) && (address_len != NULL)) {
 #ifdef MODULE_SOCK_ASYNC
-        atomic_fetch_sub(&s->available, 1);
+        if (s->type != SOCK_STREAM) {
+            atomic_fetch_sub(&s->available, 1);
+        }
 #endif
         switch (s->type) {
 #ifdef MODULE_SOCK_TCP
@@ -1111,6 +1137,120 @@ ssize_t sendto(int socket, const void *buffer, size_t length, int flags,
     return res;
 }
 
+#ifdef MODULE_SOCK_UDP
+static bool _mmsg_valid(const struct mmsghdr *msgvec, unsigned int vlen)
+{
+    for (unsigned i = 0; i < vlen; i++) {
+        /* the sock API takes one continuous buffer per message */
+        if (msgvec[i].msg_hdr.msg_iovlen != 1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static int _udp_recvmmsg(socket_t *s, struct mmsghdr *msgvec,
+                         unsigned int vlen, uint32_t recv_timeout)
+{
+    unsigned received = 0;
+    int res = 0;
+
+    while (received < vlen) {
+        sock_udp_msg_t msgs[SOCKET_MMSG_BATCH_SIZE];
+        sock_udp_ep_t eps[SOCKET_MMSG_BATCH_SIZE];
+        struct mmsghdr *batch = &msgvec[received];
+        unsigned num = MIN(vlen - received, SOCKET_MMSG_BATCH_SIZE);
+
+        for (unsigned i = 0; i < num; i++) {
+            msgs[i].data = batch[i].msg_hdr.msg_iov[0].iov_base;
+            msgs[i].len = batch[i].msg_hdr.msg_iov[0].iov_len;
+            msgs[i].remote = &eps[i];
+        }
+        /* only the first message is waited for */
+        res = sock_udp_recv_many(&s->sock->udp, msgs, num,
+                                 (received == 0) ? recv_timeout : 0);
+        if (res < 0) {
+            break;
+        }
+        for (int i = 0; i < res; i++) {
+            struct msghdr *hdr = &batch[i].msg_hdr;
+
+            batch[i].msg_len = msgs[i].len;
+            hdr->msg_flags = 0;
+            if (hdr->msg_name != NULL) {
+                struct sockaddr_storage sa;
+                socklen_t sa_len = _ep_to_sockaddr(&eps[i], &sa);
+
+                hdr->msg_namelen = _addr_truncate(hdr->msg_name,
+                                                  hdr->msg_namelen, &sa,
+                                                  sa_len);
+            }
+#if IS_USED(MODULE_SOCK_ASYNC)
+            atomic_fetch_sub(&s->available, 1);
+#endif
+        }
+        received += res;
+        if ((unsigned)res < num) {
+            /* no further messages available */
+            break;
+        }
+    }
+    return (received > 0) ? (int)received : res;
+}
+#endif
+
+int recvmmsg(int socket, struct mmsghdr *msgvec, unsigned int vlen, int flags,
+             struct timespec *timeout)
+{
+    socket_t *s;
+    int res;
+
+    (void)flags;
+    mutex_lock(&_socket_pool_mutex);
+    s = _get_socket(socket);
+    mutex_unlock(&_socket_pool_mutex);
+    if (s == NULL) {
+        errno = ENOTSOCK;
+        return -1;
+    }
+    switch (s->type) {
+#ifdef MODULE_SOCK_UDP
+    case SOCK_DGRAM: {
+#ifdef POSIX_SETSOCKOPT
+        uint32_t recv_timeout = s->recv_timeout;
+#else
+        uint32_t recv_timeout = SOCK_NO_TIMEOUT;
+#endif
+
+        if (!_mmsg_valid(msgvec, vlen)) {
+            errno = EINVAL;
+            return -1;
+        }
+        if (timeout != NULL) {
+            recv_timeout = (timeout->tv_sec * US_PER_SEC) +
+                           (timeout->tv_nsec / NS_PER_US);
+        }
+        if ((s->sock == NULL) && (_bind_connect(s, NULL, 0) < 0)) {
+            return -1;
+        }
+        res = _udp_recvmmsg(s, msgvec, vlen, recv_timeout);
+        break;
+    }
+#endif
+    default:
+        (void)msgvec;
+        (void)vlen;
+        (void)timeout;
+        res = -EOPNOTSUPP;
+        break;
+    }
+    if (res < 0) {
+        errno = -res;
+        return -1;
+    }
+    return res;
+}
+
 /*
  * This is a partial implementation of setsockopt for changing the receive
  * timeout value of a socket.
@@ -1198,10 +1338,10 @@ int posix_socket_select(int fd)
     socket_t *socket = _get_socket(fd);
 
     if (socket != NULL) {
-        if (socket->sock == NULL) {  /* socket is not connected */
+        /* bind implicitly, streams only get a sock by connect() or listen() */
+        if ((socket->sock == NULL) && (socket->type != SOCK_STREAM)) {
             int res;
 
-            /* bind implicitly */
             if ((res = _bind_connect(socket, NULL, 0)) < 0) {
                 return res;
             }
@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief   Shell command for the DNS cache statistics
+ */
+
+#include <stdio.h>
+
+#include "net/dns/cache.h"
+#include "shell.h"
+
+static int _dns_cache(int argc, char **argv)
+{
+    dns_cache_stats_t stats;
+
+    (void)argc;
+    (void)argv;
+    dns_cache_stats_get(&stats);
+    printf("entries: %u/%u\n", dns_cache_used_count(), CONFIG_DNS_CACHE_SIZE);
+    printf("hits: %lu, negative: %lu, stale: %lu, misses: %lu\n",
+           (long unsigned)stats.hits, (long unsigned)stats.negative_hits,
+           (long unsigned)stats.stale_hits, (long unsigned)stats.misses);
+    printf("evictions: %lu, expirations: %lu\n",
+           (long unsigned)stats.evictions, (long unsigned)stats.expirations);
+    return 0;
+}
+
+SHELL_COMMAND(dnscache, "DNS cache statistics", _dns_cache);
+
+/** @} */
@@ -52,6 +52,12 @@ static int _gnrc_6lo_frag_stats(int argc, char **argv)
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR_STATS */
     printf("frags complete: %u\n", stats->fragments);
     printf("dgs complete: %u\n", stats->datagrams);
+    printf("rbuf timeouts: %u, drops: %u\n", stats->rbuf_timeouts,
+           stats->rbuf_drops);
+    printf("reassembly time: avg: %luus, max: %luus\n",
+           (long unsigned)(stats->datagrams
+                           ? (stats->reass_time_sum / stats->datagrams) : 0),
+           (long unsigned)stats->reass_time_max);
     return 0;
 }
 
@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure the gcoap forward proxy with many concurrent clients
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "net/gcoap.h"
+#include "net/gcoap/forward_proxy.h"
+#include "net/ipv6/addr.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define CLIENTS_NUMOF       (16U)
+#define CLIENT_PORT         (30000U)
+#define ORIGIN_PORT         (5684U)
+/* time the origin server takes to answer */
+#define ORIGIN_DELAY_MS     (10U)
+#define ROUNDS              (20U)
+#define PROXY_URI           "coap://[::1]:5684/res/%u"
+
+typedef struct {
+    sock_udp_ep_t remote;
+    uint32_t due;
+    size_t len;
+    uint8_t buf[64];
+} _pending_t;
+
+static char _origin_stack[THREAD_STACKSIZE_DEFAULT];
+static _pending_t _pending[CLIENTS_NUMOF];
+static unsigned _pending_numof;
+static volatile unsigned _origin_requests;
+static sock_udp_t _clients[CLIENTS_NUMOF];
+
+/* answers every request after ORIGIN_DELAY_MS, no matter how many are pending */
+static void *_origin(void *arg)
+{
+    sock_udp_ep_t local = { .family = AF_INET6, .port = ORIGIN_PORT };
+    sock_udp_t sock;
+
+    (void)arg;
+    expect(sock_udp_create(&sock, &local, NULL, 0) == 0);
+    while (1) {
+        uint32_t now = ztimer_now(ZTIMER_MSEC);
+        uint32_t timeout = SOCK_NO_TIMEOUT;
+        uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+        uint8_t uri[CONFIG_NANOCOAP_URI_MAX];
+        coap_pkt_t pkt;
+
+        for (unsigned i = 0; i < _pending_numof;) {
+            _pending_t *p = &_pending[i];
+
+            if ((int32_t)(p->due - now) <= 0) {
+                sock_udp_send(&sock, p->buf, p->len, &p->remote);
+                *p = _pending[--_pending_numof];
+                continue;
+            }
+            if ((p->due - now) * US_PER_MS < timeout) {
+                timeout = (p->due - now) * US_PER_MS;
+            }
+            i++;
+        }
+
+        sock_udp_ep_t remote;
+        ssize_t res = sock_udp_recv(&sock, buf, sizeof(buf), timeout, &remote);
+        if ((res <= 0) || (coap_parse(&pkt, buf, res) < 0)) {
+            continue;
+        }
+        _origin_requests++;
+        expect(_pending_numof < CLIENTS_NUMOF);
+
+        _pending_t *p = &_pending[_pending_numof++];
+        ssize_t uri_len = coap_get_uri_path(&pkt, uri);
+        expect(uri_len > 0);
+        /* the payload is the path, without the terminating '\0' */
+        res = coap_reply_simple(&pkt, COAP_CODE_CONTENT, p->buf, sizeof(p->buf),
+                                COAP_FORMAT_TEXT, uri, uri_len - 1);
+        expect(res > 0);
+        p->len = res;
+        p->remote = remote;
+        p->due = ztimer_now(ZTIMER_MSEC) + ORIGIN_DELAY_MS;
+    }
+    return NULL;
+}
+
+static void _request(unsigned client, unsigned resource, unsigned round)
+{
+    sock_udp_ep_t proxy = { .family = AF_INET6, .port = CONFIG_GCOAP_PORT };
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE], token[4];
+    char uri[sizeof(PROXY_URI) + 8];
+    coap_pkt_t pkt;
+
+    memcpy(proxy.addr.ipv6, &ipv6_addr_loopback, sizeof(proxy.addr.ipv6));
+    byteorder_htobebufl(token, (round << 8) | client);
+    ssize_t len = coap_build_hdr((coap_hdr_t *)buf, COAP_TYPE_NON, token,
+                                 sizeof(token), COAP_METHOD_GET,
+                                 round * CLIENTS_NUMOF + client);
+    coap_pkt_init(&pkt, buf, sizeof(buf), len);
+    snprintf(uri, sizeof(uri), PROXY_URI, resource);
+    coap_opt_add_proxy_uri(&pkt, uri);
+    len = coap_opt_finish(&pkt, COAP_OPT_FINISH_NONE);
+    expect(sock_udp_send(&_clients[client], buf, len, &proxy) == len);
+}
+
+static void _response(unsigned client, unsigned resource, unsigned round)
+{
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    char path[16];
+    coap_pkt_t pkt;
+
+    ssize_t len = sock_udp_recv(&_clients[client], buf, sizeof(buf),
+                                US_PER_SEC, NULL);
+    expect(len > 0);
+    expect(coap_parse(&pkt, buf, len) == 0);
+    expect(coap_get_code_raw(&pkt) == COAP_CODE_CONTENT);
+    expect(byteorder_bebuftohl(coap_get_token(&pkt)) == ((round << 8) | client));
+    len = snprintf(path, sizeof(path), "/res/%u", resource);
+    expect((pkt.payload_len == len) && !memcmp(pkt.payload, path, len));
+}
+
+static void _run(const char *name, bool identical)
+{
+    unsigned origin_requests = _origin_requests;
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned round = 0; round < ROUNDS; round++) {
+        for (unsigned i = 0; i < CLIENTS_NUMOF; i++) {
+            _request(i, identical ? 0 : i, round);
+        }
+        for (unsigned i = 0; i < CLIENTS_NUMOF; i++) {
+            _response(i, identical ? 0 : i, round);
+        }
+    }
+    uint32_t usec = (ztimer_now(ZTIMER_USEC) - start) / ROUNDS;
+
+    printf("%s requests: %" PRIu32 " us per round, %u origin requests per round\n",
+           name, usec, (_origin_requests - origin_requests) / ROUNDS);
+}
+
+int main(void)
+{
+    thread_create(_origin_stack, sizeof(_origin_stack), THREAD_PRIORITY_MAIN - 1,
+                  0, _origin, NULL, "origin");
+    for (unsigned i = 0; i < CLIENTS_NUMOF; i++) {
+        sock_udp_ep_t local = { .family = AF_INET6, .port = CLIENT_PORT + i };
+
+        expect(sock_udp_create(&_clients[i], &local, NULL, 0) == 0);
+    }
+    printf("%u clients, %u workers, origin answers after %u ms\n\n",
+           CLIENTS_NUMOF,
+           IS_USED(MODULE_GCOAP_FORWARD_PROXY_WORKERS) ? CONFIG_GCOAP_FORWARD_PROXY_WORKERS : 0,
+           ORIGIN_DELAY_MS);
+
+    _run("distinct", false);
+    _run("identical", true);
+
+    puts("\n[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for requests in ("distinct", "identical"):
+        child.expect(r"{} requests: (\d+) us per round, (\d+) origin requests per round"
+                     .format(requests), timeout=30)
+    child.expect_exact("[SUCCESS]", timeout=30)
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
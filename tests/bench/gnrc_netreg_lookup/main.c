@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure look-up time of the network protocol registry
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "msg.h"
+#include "net/gnrc/netreg.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (100UL * 1000UL)
+#endif
+
+#define PORTS_MAX           (128U)
+#define PORT_BASE           (5683U)
+
+static gnrc_netreg_entry_t _entries[PORTS_MAX];
+static msg_t _msg_queue[2];
+static uint32_t _found;
+
+static void _lookup(uint32_t port)
+{
+    if (gnrc_netreg_lookup(GNRC_NETTYPE_UDP, port) != NULL) {
+        _found++;
+    }
+}
+
+static void _bench(unsigned ports)
+{
+    char name[16];
+
+    for (unsigned i = 0; i < ports; i++) {
+        gnrc_netreg_entry_init_pid(&_entries[i], PORT_BASE + i, thread_getpid());
+        expect(gnrc_netreg_register(GNRC_NETTYPE_UDP, &_entries[i]) == 0);
+    }
+    _found = 0;
+    snprintf(name, sizeof(name), "%u ports", ports);
+    /* the shared lock is held over all runs, to only measure the look-up */
+    gnrc_netreg_acquire_shared();
+    BENCHMARK_FUNC(name, BENCH_RUNS, _lookup(PORT_BASE));
+    gnrc_netreg_release_shared();
+    expect(_found == BENCH_RUNS);
+    for (unsigned i = 0; i < ports; i++) {
+        gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &_entries[i]);
+    }
+}
+
+int main(void)
+{
+    msg_init_queue(_msg_queue, ARRAY_SIZE(_msg_queue));
+    gnrc_netreg_init();
+
+    printf("gnrc_netreg look-up with %u hash buckets per type\n\n",
+           GNRC_NETREG_BUCKETS_NUMOF);
+    _bench(1);
+    _bench(16);
+    _bench(PORTS_MAX);
+
+    puts("\n[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,118 @@
+/*
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/* generated by pcap2frames.py, do not edit */
+
+static const uint8_t _frame0[] = {
+    0x7b, 0x33, 0x3a, 0x87, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01,
+};
+
+static const uint8_t _frame1[] = {
+    0x7f, 0x22, 0x00, 0x02, 0x00, 0x01, 0xf3, 0x12,
+    0xbe, 0xef, 0x58, 0x01, 0x12, 0x34, 0xa1, 0xb2,
+    0xc3, 0xd4, 0xb4, 0x74, 0x65, 0x6d, 0x70,
+};
+
+static const uint8_t _frame2[] = {
+    0x7e, 0xd5, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xf0, 0xc0, 0x00, 0x16, 0x33,
+    0xbe, 0xef, 0x58, 0x01, 0x12, 0x34, 0xa1, 0xb2,
+    0xc3, 0xd4, 0xb4, 0x74, 0x65, 0x6d, 0x70,
+};
+
+static const uint8_t _frame3[] = {
+    0x7e, 0x77, 0xf1, 0xc0, 0x01, 0x33, 0xbe, 0xef,
+    0x58, 0x01, 0x12, 0x34, 0xa1, 0xb2, 0xc3, 0xd4,
+    0xb4, 0x74, 0x65, 0x6d, 0x70,
+};
+
+static const uint8_t _frame4[] = {
+    0x7b, 0x3b, 0x3a, 0x1a, 0x9b, 0x01, 0x00, 0x00,
+    0x00, 0xf0, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+};
+
+static const uint8_t _frame5[] = {
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x40,
+    0xfd, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0xfd, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xc0, 0x00, 0x16, 0x33, 0x00, 0x1c, 0xbe, 0xef,
+    0x58, 0x01, 0x12, 0x34, 0xa1, 0xb2, 0xc3, 0xd4,
+    0xb4, 0x74, 0x65, 0x6d, 0x70,
+};
+
+static const uint8_t _frame6[] = {
+    0x7f, 0x33, 0xe1, 0x06, 0x63, 0x04, 0x00, 0x1e,
+    0x00, 0x00, 0xf3, 0x12, 0xbe, 0xef, 0x58, 0x01,
+    0x12, 0x34, 0xa1, 0xb2, 0xc3, 0xd4, 0xb4, 0x74,
+    0x65, 0x6d, 0x70,
+};
+
+static const frame_t _frames[] = {
+    {
+        .src = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x02 },
+        .src_len = 8,
+        .dst = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01 },
+        .dst_len = 8,
+        .data = _frame0,
+        .len = sizeof(_frame0),
+    },
+    {
+        .src = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x02 },
+        .src_len = 8,
+        .dst = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01 },
+        .dst_len = 8,
+        .data = _frame1,
+        .len = sizeof(_frame1),
+    },
+    {
+        .src = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x02 },
+        .src_len = 8,
+        .dst = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01 },
+        .dst_len = 8,
+        .data = _frame2,
+        .len = sizeof(_frame2),
+    },
+    {
+        .src = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x02 },
+        .src_len = 8,
+        .dst = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01 },
+        .dst_len = 8,
+        .data = _frame3,
+        .len = sizeof(_frame3),
+    },
+    {
+        .src = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x02 },
+        .src_len = 8,
+        .dst = { 0xff, 0xff },
+        .dst_len = 2,
+        .data = _frame4,
+        .len = sizeof(_frame4),
+    },
+    {
+        .src = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x02 },
+        .src_len = 8,
+        .dst = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01 },
+        .dst_len = 8,
+        .data = _frame5,
+        .len = sizeof(_frame5),
+    },
+    {
+        .src = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x02 },
+        .src_len = 8,
+        .dst = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01 },
+        .dst_len = 8,
+        .data = _frame6,
+        .len = sizeof(_frame6),
+    },
+};
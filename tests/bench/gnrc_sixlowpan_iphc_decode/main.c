@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure IPHC decompression time per frame
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "msg.h"
+#include "net/gnrc.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/sixlowpan/ctx.h"
+#include "net/gnrc/sixlowpan/iphc.h"
+#include "net/netdev_test.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (10UL * 1000UL)
+#endif
+
+#define LOCAL_EUI64         { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01 }
+
+typedef struct {
+    uint8_t src[8];
+    uint8_t src_len;
+    uint8_t dst[8];
+    uint8_t dst_len;
+    const uint8_t *data;
+    size_t len;
+} frame_t;
+
+#include "frames.h"
+
+static const uint8_t _local_eui64[] = LOCAL_EUI64;
+static const ipv6_addr_t _ctx0_prefix = {{
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    }};
+static const ipv6_addr_t _ctx1_prefix = {{
+        0xfd, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    }};
+
+static gnrc_netif_t _netif;
+static netdev_test_t _mock_netdev;
+static char _mock_netif_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _msg_queue[2];
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_proto(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(gnrc_nettype_t));
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_SIXLOWPAN;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = IEEE802154_FRAME_LEN_MAX;
+    return sizeof(uint16_t);
+}
+
+static int _get_src_len(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = sizeof(_local_eui64);
+    return sizeof(uint16_t);
+}
+
+static int _get_address_long(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_local_eui64));
+    memcpy(value, _local_eui64, sizeof(_local_eui64));
+    return sizeof(_local_eui64);
+}
+
+static void _init_netif(void)
+{
+    netdev_test_setup(&_mock_netdev, 0);
+    netdev_test_set_get_cb(&_mock_netdev, NETOPT_DEVICE_TYPE,
+                           _get_device_type);
+    netdev_test_set_get_cb(&_mock_netdev, NETOPT_PROTO, _get_proto);
+    netdev_test_set_get_cb(&_mock_netdev, NETOPT_MAX_PDU_SIZE,
+                           _get_max_packet_size);
+    netdev_test_set_get_cb(&_mock_netdev, NETOPT_SRC_LEN, _get_src_len);
+    netdev_test_set_get_cb(&_mock_netdev, NETOPT_ADDRESS_LONG,
+                           _get_address_long);
+    expect(gnrc_netif_ieee802154_create(&_netif, _mock_netif_stack,
+                                        sizeof(_mock_netif_stack),
+                                        GNRC_NETIF_PRIO, "mockup_wpan",
+                                        &_mock_netdev.netdev.netdev) == 0);
+}
+
+static void _decode(const frame_t *frame)
+{
+    gnrc_pktsnip_t *netif, *sixlo;
+
+    netif = gnrc_netif_hdr_build(frame->src, frame->src_len,
+                                 frame->dst, frame->dst_len);
+    expect(netif != NULL);
+    gnrc_netif_hdr_set_netif(netif->data, &_netif);
+    sixlo = gnrc_pktbuf_add(netif, frame->data, frame->len,
+                            GNRC_NETTYPE_SIXLOWPAN);
+    expect(sixlo != NULL);
+    gnrc_sixlowpan_iphc_recv(sixlo, NULL, 0);
+}
+
+static void _check_frames(void)
+{
+    gnrc_netreg_entry_t entry = GNRC_NETREG_ENTRY_INIT_PID(
+            GNRC_NETREG_DEMUX_CTX_ALL, thread_getpid()
+        );
+
+    gnrc_netreg_register(GNRC_NETTYPE_IPV6, &entry);
+    for (unsigned i = 0; i < ARRAY_SIZE(_frames); i++) {
+        msg_t msg;
+
+        _decode(&_frames[i]);
+        /* if decompression failed, the packet was dropped */
+        expect(msg_try_receive(&msg) == 1);
+        expect(msg.type == GNRC_NETAPI_MSG_TYPE_RCV);
+        gnrc_pktbuf_release(msg.content.ptr);
+    }
+    gnrc_netreg_unregister(GNRC_NETTYPE_IPV6, &entry);
+}
+
+int main(void)
+{
+    msg_init_queue(_msg_queue, ARRAY_SIZE(_msg_queue));
+    _init_netif();
+    expect(gnrc_sixlowpan_ctx_update(0, &_ctx0_prefix, 64, UINT16_MAX,
+                                     true) != NULL);
+    expect(gnrc_sixlowpan_ctx_update(1, &_ctx1_prefix, 64, UINT16_MAX,
+                                     true) != NULL);
+    _check_frames();
+
+    printf("IPHC decompression of %u frames\n\n", (unsigned)ARRAY_SIZE(_frames));
+    for (unsigned n = 0; n < ARRAY_SIZE(_frames); n++) {
+        const frame_t *frame = &_frames[n];
+        char name[16];
+
+        snprintf(name, sizeof(name), "frame %u", n);
+        /* there is no receiver for IPv6, so the decompressed packet is
+         * released right away */
+        BENCHMARK_FUNC(name, BENCH_RUNS, _decode(frame));
+    }
+
+    puts("\n[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""
+Converts the IPHC encoded frames of an IEEE 802.15.4 packet capture to the
+C array definitions in frames.h, so they can be replayed by the benchmark.
+
+Fragmented and secured frames, and frames with another 6LoWPAN dispatch than
+IPHC are skipped.
+
+    ./pcap2frames.py capture.pcap > frames.h
+"""
+
+import argparse
+import struct
+import sys
+
+LINKTYPE_IEEE802_15_4_WITHFCS = 195
+LINKTYPE_IEEE802_15_4_NOFCS = 230
+
+FCF_TYPE_DATA = 0x1
+FCF_SECURITY = 0x8
+FCF_PAN_COMP = 0x40
+
+ADDR_LEN = {0: 0, 2: 2, 3: 8}
+
+IPHC_MASK = 0xe0
+IPHC_DISP = 0x60
+
+
+def _pcap_records(f):
+    magic = f.read(4)
+    if magic == b"\xd4\xc3\xb2\xa1":
+        endian = "<"
+    elif magic == b"\xa1\xb2\xc3\xd4":
+        endian = ">"
+    else:
+        raise ValueError("not a pcap file (pcapng is not supported)")
+    _, _, _, _, _, linktype = struct.unpack(endian + "HHiIII", f.read(20))
+    if linktype not in (LINKTYPE_IEEE802_15_4_WITHFCS,
+                        LINKTYPE_IEEE802_15_4_NOFCS):
+        raise ValueError("unsupported link type {}".format(linktype))
+    while True:
+        hdr = f.read(16)
+        if len(hdr) < 16:
+            return
+        _, _, incl_len, _ = struct.unpack(endian + "IIII", hdr)
+        frame = f.read(incl_len)
+        if linktype == LINKTYPE_IEEE802_15_4_WITHFCS:
+            frame = frame[:-2]
+        yield frame
+
+
+def _parse_mac(frame):
+    """Returns (src, dst, payload) with addresses in network byte order"""
+    fcf, = struct.unpack("<H", frame[:2])
+    if ((fcf & 0x7) != FCF_TYPE_DATA) or (fcf & FCF_SECURITY):
+        return None
+    dst_mode = (fcf >> 10) & 0x3
+    src_mode = (fcf >> 14) & 0x3
+    if (dst_mode not in ADDR_LEN) or (src_mode not in ADDR_LEN):
+        return None
+    offset = 3
+    dst = b""
+    src = b""
+    if dst_mode:
+        offset += 2
+        dst = frame[offset:offset + ADDR_LEN[dst_mode]][::-1]
+        offset += ADDR_LEN[dst_mode]
+    if src_mode:
+        if not (fcf & FCF_PAN_COMP):
+            offset += 2
+        src = frame[offset:offset + ADDR_LEN[src_mode]][::-1]
+        offset += ADDR_LEN[src_mode]
+    return src, dst, frame[offset:]
+
+
+def _c_bytes(data, indent):
+    lines = []
+    for i in range(0, len(data), 8):
+        lines.append(indent + ", ".join("0x{:02x}".format(b)
+                                        for b in data[i:i + 8]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().split("\n")[0])
+    parser.add_argument("pcap", type=argparse.FileType("rb"))
+    parser.add_argument("-n", "--max-frames", type=int, default=16,
+                        help="maximum number of frames to convert")
+    args = parser.parse_args()
+
+    frames = []
+    for frame in _pcap_records(args.pcap):
+        res = _parse_mac(frame)
+        if (res is None) or not res[2] or \
+           ((res[2][0] & IPHC_MASK) != IPHC_DISP):
+            continue
+        frames.append(res)
+        if len(frames) >= args.max_frames:
+            break
+    if not frames:
+        print("no IPHC frames found", file=sys.stderr)
+        return 1
+
+    print("/*\n"
+          " * This file is subject to the terms and conditions of the GNU Lesser\n"
+          " * General Public License v2.1. See the file LICENSE in the top level\n"
+          " * directory for more details.\n"
+          " */\n")
+    print("/* generated by pcap2frames.py, do not edit */\n")
+    for i, (_, _, payload) in enumerate(frames):
+        print("static const uint8_t _frame{}[] = {{".format(i))
+        print(_c_bytes(payload, "    "))
+        print("};\n")
+    print("static const frame_t _frames[] = {")
+    for i, (src, dst, _) in enumerate(frames):
+        print("    {")
+        print("        .src = {{ {} }},".format(
+              ", ".join("0x{:02x}".format(b) for b in src)))
+        print("        .src_len = {},".format(len(src)))
+        print("        .dst = {{ {} }},".format(
+              ", ".join("0x{:02x}".format(b) for b in dst)))
+        print("        .dst_len = {},".format(len(dst)))
+        print("        .data = _frame{0},\n        .len = sizeof(_frame{0}),"
+              .format(i))
+        print("    },")
+    print("};")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,205 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure IPHC compression time per flow
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/sixlowpan/ctx.h"
+#include "net/gnrc/sixlowpan/iphc.h"
+#include "net/gnrc/udp.h"
+#include "net/netdev_test.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (10UL * 1000UL)
+#endif
+
+#define LOCAL_EUI64         { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01 }
+#define REMOTE_EUI64        { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x02 }
+#define PAYLOAD_SIZE        (16U)
+
+typedef struct {
+    const char *name;
+    ipv6_addr_t src;
+    ipv6_addr_t dst;
+} flow_t;
+
+static const uint8_t _local_eui64[] = LOCAL_EUI64;
+static const uint8_t _remote_eui64[] = REMOTE_EUI64;
+static const ipv6_addr_t _ctx0_prefix = {{
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    }};
+
+static const flow_t _flows[] = {
+    {
+        .name = "link-local",
+        .src = {{ 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                  0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01 }},
+        .dst = {{ 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                  0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x02 }},
+    },
+    {
+        .name = "context",
+        .src = {{ 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+                  0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01 }},
+        .dst = {{ 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+                  0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x02 }},
+    },
+    {
+        .name = "inline",
+        .src = {{ 0xfd, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+                  0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01 }},
+        .dst = {{ 0xfd, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+                  0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x02 }},
+    },
+    {
+        .name = "multicast",
+        .src = {{ 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                  0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01 }},
+        .dst = {{ 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 }},
+    },
+};
+
+static gnrc_netif_t _netif;
+static netdev_test_t _mock_netdev;
+static char _mock_netif_stack[THREAD_STACKSIZE_DEFAULT];
+static uint8_t _payload[PAYLOAD_SIZE];
+static unsigned _sent;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_proto(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(gnrc_nettype_t));
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_SIXLOWPAN;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = IEEE802154_FRAME_LEN_MAX;
+    return sizeof(uint16_t);
+}
+
+static int _get_src_len(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = sizeof(_local_eui64);
+    return sizeof(uint16_t);
+}
+
+static int _get_address_long(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_local_eui64));
+    memcpy(value, _local_eui64, sizeof(_local_eui64));
+    return sizeof(_local_eui64);
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    (void)dev;
+    /* just drop the frame */
+    _sent++;
+    return iolist_size(iolist);
+}
+
+static void _init_netif(void)
+{
+    netdev_test_setup(&_mock_netdev, 0);
+    netdev_test_set_get_cb(&_mock_netdev, NETOPT_DEVICE_TYPE,
+                           _get_device_type);
+    netdev_test_set_get_cb(&_mock_netdev, NETOPT_PROTO, _get_proto);
+    netdev_test_set_get_cb(&_mock_netdev, NETOPT_MAX_PDU_SIZE,
+                           _get_max_packet_size);
+    netdev_test_set_get_cb(&_mock_netdev, NETOPT_SRC_LEN, _get_src_len);
+    netdev_test_set_get_cb(&_mock_netdev, NETOPT_ADDRESS_LONG,
+                           _get_address_long);
+    netdev_test_set_send_cb(&_mock_netdev, _send);
+    expect(gnrc_netif_ieee802154_create(&_netif, _mock_netif_stack,
+                                        sizeof(_mock_netif_stack),
+                                        GNRC_NETIF_PRIO, "mockup_wpan",
+                                        &_mock_netdev.netdev.netdev) == 0);
+}
+
+static void _compress(const flow_t *flow)
+{
+    gnrc_pktsnip_t *pkt;
+    ipv6_hdr_t *ipv6_hdr;
+
+    pkt = gnrc_pktbuf_add(NULL, _payload, sizeof(_payload),
+                          GNRC_NETTYPE_UNDEF);
+    expect(pkt != NULL);
+    pkt = gnrc_udp_hdr_build(pkt, 5683, 5683);
+    expect(pkt != NULL);
+    pkt = gnrc_ipv6_hdr_build(pkt, &flow->src, &flow->dst);
+    expect(pkt != NULL);
+    ipv6_hdr = pkt->data;
+    ipv6_hdr->nh = PROTNUM_UDP;
+    ipv6_hdr->hl = 64;
+    ipv6_hdr->len = byteorder_htons(gnrc_pkt_len(pkt->next));
+    if (ipv6_addr_is_multicast(&flow->dst)) {
+        pkt = gnrc_pkt_prepend(pkt, gnrc_netif_hdr_build(NULL, 0, NULL, 0));
+        ((gnrc_netif_hdr_t *)pkt->data)->flags |= GNRC_NETIF_HDR_FLAGS_MULTICAST;
+    }
+    else {
+        pkt = gnrc_pkt_prepend(pkt, gnrc_netif_hdr_build(NULL, 0,
+                                                         _remote_eui64,
+                                                         sizeof(_remote_eui64)));
+    }
+    expect(pkt->type == GNRC_NETTYPE_NETIF);
+    gnrc_netif_hdr_set_netif(pkt->data, &_netif);
+    /* the interface thread has a higher priority than main, so the frame was
+     * handed to the device when this returns */
+    gnrc_sixlowpan_iphc_send(pkt, NULL, 0);
+}
+
+int main(void)
+{
+    _init_netif();
+    expect(gnrc_sixlowpan_ctx_update(0, &_ctx0_prefix, 64, UINT16_MAX,
+                                     true) != NULL);
+
+    printf("IPHC compression of %u flows\n\n", (unsigned)ARRAY_SIZE(_flows));
+    for (unsigned n = 0; n < ARRAY_SIZE(_flows); n++) {
+        const flow_t *flow = &_flows[n];
+
+        _sent = 0;
+        BENCHMARK_FUNC(flow->name, BENCH_RUNS, _compress(flow));
+        expect(_sent == BENCH_RUNS);
+    }
+
+    puts("\n[SUCCESS]");
+    return 0;
+}
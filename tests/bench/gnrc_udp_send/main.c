@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure UDP datagrams sent per second through GNRC
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "net/ethernet.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/netdev_test.h"
+#include "net/sock/udp.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef TEST_DURATION_US
+#define TEST_DURATION_US    (1000000U)
+#endif
+
+#define PAYLOAD_SIZE        (16U)
+
+static const ipv6_addr_t _own_addr = {{
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+    }};
+static const ipv6_addr_t _router_addr = {{
+        0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+    }};
+static const uint8_t _router_l2addr[] = { 0xce, 0xab, 0xfe, 0xad, 0xf7, 0x27 };
+
+static gnrc_netif_t _netif;
+static netdev_test_t _mock_netdev;
+static char _mock_netif_stack[THREAD_STACKSIZE_DEFAULT];
+static uint8_t _payload[PAYLOAD_SIZE];
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    static const uint8_t addr[] = { 0xce, 0xab, 0xfe, 0xad, 0xf7, 0x26 };
+
+    (void)dev;
+    expect(max_len >= sizeof(addr));
+    memcpy(value, addr, sizeof(addr));
+    return sizeof(addr);
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    (void)dev;
+    /* just drop the frame */
+    return iolist_size(iolist);
+}
+
+static void _init_netif(void)
+{
+    netdev_test_setup(&_mock_netdev, 0);
+    netdev_test_set_get_cb(&_mock_netdev, NETOPT_DEVICE_TYPE,
+                           _get_device_type);
+    netdev_test_set_get_cb(&_mock_netdev, NETOPT_MAX_PDU_SIZE,
+                           _get_max_packet_size);
+    netdev_test_set_get_cb(&_mock_netdev, NETOPT_ADDRESS, _get_address);
+    netdev_test_set_send_cb(&_mock_netdev, _send);
+    expect(gnrc_netif_ethernet_create(&_netif, _mock_netif_stack,
+                                      sizeof(_mock_netif_stack),
+                                      GNRC_NETIF_PRIO, "mockup_eth",
+                                      &_mock_netdev.netdev.netdev) == 0);
+    expect(gnrc_netif_ipv6_addr_add(&_netif, &_own_addr, 64,
+                                    GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) > 0);
+    /* default route via a router with statically configured link-layer
+     * address, so no neighbor discovery is required */
+    expect(gnrc_ipv6_nib_nc_set(&_router_addr, _netif.pid, _router_l2addr,
+                                sizeof(_router_l2addr)) == 0);
+    expect(gnrc_ipv6_nib_ft_add(NULL, 0, &_router_addr, _netif.pid, 0) == 0);
+}
+
+int main(void)
+{
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = 5683 };
+    sock_udp_t sock;
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+    unsigned count = 0;
+    uint32_t start;
+
+    _init_netif();
+    ipv6_addr_from_str((ipv6_addr_t *)&remote.addr.ipv6, "2001:db8:1::1");
+    local.port = 5683;
+    expect(sock_udp_create(&sock, &local, NULL, 0) == 0);
+
+    start = ztimer_now(ZTIMER_USEC);
+    while ((ztimer_now(ZTIMER_USEC) - start) < TEST_DURATION_US) {
+        /* the IPv6 and the interface thread have a higher priority than
+         * main, so the datagram was handed to the device when this returns */
+        if (sock_udp_send(&sock, _payload, sizeof(_payload), &remote) < 0) {
+            puts("Error sending datagram");
+            return 1;
+        }
+        count++;
+    }
+
+#if CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF > 0
+    netstats_cache_t stats;
+
+    gnrc_ipv6_nib_route_cache_stats(&stats);
+    printf("route cache: %" PRIu32 " hits, %" PRIu32 " misses\n",
+           stats.hits, stats.misses);
+#endif
+    printf("{ \"result\" : %u }\n", count);
+    return 0;
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure the cache look-up of proxied CoAP requests
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "hashes/sha256.h"
+#include "net/nanocoap/cache.h"
+#include "test_utils/expect.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (100UL * 1000UL)
+#endif
+
+#define PROXY_URI           "coap://[2001:db8::1]:5683/sensors/temp/%u"
+
+static uint8_t _req_buf[128];
+static size_t _req_len;
+static uint8_t _resp_buf[CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE];
+static coap_pkt_t _pkt;
+static unsigned _checksum;
+
+static size_t _build_request(uint8_t *buf, size_t len, unsigned n)
+{
+    static const uint8_t token[] = { 0xde, 0xad, 0xbe, 0xef };
+    coap_block1_t block2 = { .blknum = 0, .szx = COAP_BLOCKSIZE_64 };
+    char uri[sizeof(PROXY_URI) + 8];
+    coap_pkt_t pkt;
+
+    ssize_t hdr_len = coap_build_hdr((coap_hdr_t *)buf, COAP_TYPE_CON, token,
+                                     sizeof(token), COAP_METHOD_GET, n);
+    coap_pkt_init(&pkt, buf, len, hdr_len);
+    snprintf(uri, sizeof(uri), PROXY_URI, n);
+    expect(coap_opt_add_accept(&pkt, COAP_FORMAT_CBOR) > 0);
+    expect(coap_opt_add_block2_control(&pkt, &block2) > 0);
+    expect(coap_opt_add_proxy_uri(&pkt, uri) > 0);
+    return coap_opt_finish(&pkt, COAP_OPT_FINISH_NONE);
+}
+
+static void _fill_cache(void)
+{
+    /* the request of the benchmark is the last one added */
+    for (unsigned n = CONFIG_NANOCOAP_CACHE_ENTRIES; n-- > 0;) {
+        uint8_t resp_buf[64];
+        coap_pkt_t req, resp;
+
+        _req_len = _build_request(_req_buf, sizeof(_req_buf), n);
+        expect(coap_parse(&req, _req_buf, _req_len) == 0);
+
+        ssize_t len = coap_build_hdr((coap_hdr_t *)resp_buf, COAP_TYPE_ACK,
+                                     coap_get_token(&req),
+                                     coap_get_token_len(&req),
+                                     COAP_CODE_CONTENT, n);
+        coap_pkt_init(&resp, resp_buf, sizeof(resp_buf), len);
+        expect(coap_opt_add_format(&resp, COAP_FORMAT_CBOR) > 0);
+        expect(coap_opt_add_uint(&resp, COAP_OPT_MAX_AGE, 3600) > 0);
+        len = coap_opt_finish(&resp, COAP_OPT_FINISH_PAYLOAD);
+        memset(resp.payload, n, 16);
+        expect(nanocoap_cache_add_by_req(&req, &resp, len + 16) != NULL);
+    }
+    expect(coap_parse(&_pkt, _req_buf, _req_len) == 0);
+}
+
+static void _key(void)
+{
+    uint8_t cache_key[SHA256_DIGEST_LENGTH];
+
+    nanocoap_cache_key_generate(&_pkt, cache_key);
+    _checksum += cache_key[0];
+}
+
+static void _lookup(void)
+{
+    uint8_t cache_key[SHA256_DIGEST_LENGTH];
+
+    nanocoap_cache_key_generate(&_pkt, cache_key);
+    expect(nanocoap_cache_key_lookup(cache_key) != NULL);
+}
+
+static void _request(void)
+{
+    const nanocoap_cache_entry_t *ce;
+
+    expect(coap_parse(&_pkt, _req_buf, _req_len) == 0);
+    ce = nanocoap_cache_request_lookup(&_pkt);
+    expect(ce != NULL);
+    memcpy(_resp_buf, ce->response_buf, ce->response_len);
+    _checksum += _resp_buf[ce->response_len - 1];
+}
+
+int main(void)
+{
+    nanocoap_cache_init();
+    _fill_cache();
+    printf("CoAP request of %u bytes, %u cached responses, %s cache keys\n\n",
+           (unsigned)_req_len, (unsigned)nanocoap_cache_used_count(),
+           IS_ACTIVE(CONFIG_NANOCOAP_CACHE_KEY_SIPHASH) ? "SipHash" : "SHA-256");
+
+    BENCHMARK_FUNC("key", BENCH_RUNS, _key());
+    BENCHMARK_FUNC("lookup", BENCH_RUNS, _lookup());
+    BENCHMARK_FUNC("request", BENCH_RUNS, _request());
+    expect(_checksum != 0);
+
+    puts("\n[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure parsing and option look-up of a CoAP request
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "net/nanocoap.h"
+#include "test_utils/expect.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (100UL * 1000UL)
+#endif
+
+static uint8_t _req_buf[128];
+static size_t _req_len;
+static uint8_t _resp_buf[128];
+static coap_pkt_t _pkt;
+static unsigned _checksum;
+
+static void _build_request(void)
+{
+    static const uint8_t token[] = { 0xde, 0xad, 0xbe, 0xef };
+    coap_block1_t block2 = { .blknum = 3, .szx = COAP_BLOCKSIZE_64 };
+    coap_pkt_t pkt;
+    ssize_t len;
+
+    len = coap_build_hdr((coap_hdr_t *)_req_buf, COAP_TYPE_CON, token,
+                         sizeof(token), COAP_METHOD_GET, 0x1234);
+    coap_pkt_init(&pkt, _req_buf, sizeof(_req_buf), len);
+    expect(coap_opt_add_uint(&pkt, COAP_OPT_OBSERVE, 0) > 0);
+    expect(coap_opt_add_uri_path(&pkt, "/sensors/temp/0") > 0);
+    expect(coap_opt_add_uri_query(&pkt, "unit", "c") > 0);
+    expect(coap_opt_add_uri_query(&pkt, "fmt", "full") > 0);
+    expect(coap_opt_add_accept(&pkt, COAP_FORMAT_CBOR) > 0);
+    expect(coap_opt_add_block2_control(&pkt, &block2) > 0);
+    _req_len = coap_opt_finish(&pkt, COAP_OPT_FINISH_NONE);
+}
+
+static void _parse(void)
+{
+    expect(coap_parse(&_pkt, _req_buf, _req_len) == 0);
+}
+
+static void _getters(void)
+{
+    uint8_t uri[CONFIG_NANOCOAP_URI_MAX];
+    coap_block1_t block2;
+    const char *value;
+    size_t value_len;
+    uint32_t tmp;
+    uint8_t *opaque;
+
+    expect(coap_get_uri_path(&_pkt, uri) > 0);
+    expect(coap_get_accept(&_pkt) == COAP_FORMAT_CBOR);
+    expect(coap_get_block2(&_pkt, &block2) == 1);
+    expect(coap_opt_get_uint(&_pkt, COAP_OPT_OBSERVE, &tmp) == 0);
+    expect(coap_find_uri_query(&_pkt, "fmt", &value, &value_len));
+    expect(coap_get_content_type(&_pkt) == COAP_FORMAT_NONE);
+    expect(coap_opt_get_opaque(&_pkt, COAP_OPT_ETAG, &opaque) == -ENOENT);
+    expect(coap_opt_get_opaque(&_pkt, COAP_OPT_IF_MATCH, &opaque) == -ENOENT);
+    expect(coap_opt_get_uint(&_pkt, COAP_OPT_NO_RESPONSE, &tmp) == -ENOENT);
+    _checksum += uri[1] + block2.blknum + value_len;
+}
+
+static void _request(void)
+{
+    void *payload;
+    size_t payload_len;
+
+    _parse();
+    _getters();
+    expect(coap_build_reply_header(&_pkt, COAP_CODE_CONTENT, _resp_buf,
+                                   sizeof(_resp_buf), COAP_FORMAT_CBOR,
+                                   &payload, &payload_len) > 0);
+}
+
+int main(void)
+{
+    _build_request();
+    printf("CoAP request of %u bytes\n\n", (unsigned)_req_len);
+
+    BENCHMARK_FUNC("parse", BENCH_RUNS, _parse());
+    BENCHMARK_FUNC("getters", BENCH_RUNS, _getters());
+    BENCHMARK_FUNC("request", BENCH_RUNS, _request());
+    expect(_checksum != 0);
+
+    puts("\n[SUCCESS]");
+    return 0;
+}
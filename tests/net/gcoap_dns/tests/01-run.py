@@ -147,7 +147,7 @@ class TestGCoAPDNS(PexpectTestCase):
             "Hostname example.org resolves to 2001:db8::1 (IPv6)"
         )
         self.spawn.sendline("query example.org inet")
-        self.spawn.expect_exact("Bad message")
+        self.spawn.expect_exact("No such device or address")
         self._set_resp(
             2,
             1,
@@ -174,7 +174,7 @@ class TestGCoAPDNS(PexpectTestCase):
             )
         else:
             self.spawn.sendline("query example.org inet6")
-            self.spawn.expect_exact("Bad message")
+            self.spawn.expect_exact("No such device or address")
 
     def _expect_od_dump_of(self, hexbytes):
         for i in range((len(hexbytes) // 32) + 1):
@@ -0,0 +1,237 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the hash indexes of gcoap memos
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "mutex.h"
+#include "net/gcoap.h"
+#include "net/ipv6/addr.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#define EXTRA_MEMOS     (60U)
+#define REQS_NUMOF      (CONFIG_GCOAP_REQ_WAITING_MAX + EXTRA_MEMOS)
+#define OBS_NUMOF       (8U)
+#define NOTIFY_ROUNDS   (3U)
+/* contexts of Observe requests, below are the request numbers */
+#define OBS_CONTEXT     (0x1000U)
+#define NO_LISTENER     (9999U)
+
+static gcoap_request_memo_t _extra_memos[EXTRA_MEMOS];
+static mutex_t _block_lock = MUTEX_INIT_LOCKED;
+
+static volatile unsigned _timeouts;
+static volatile unsigned _responses;
+static volatile unsigned _errors;
+static volatile unsigned _notifications[OBS_NUMOF];
+
+static ssize_t _echo_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                             coap_request_ctx_t *ctx)
+{
+    mutex_t *block = coap_request_ctx_get_context(ctx);
+    uint8_t id[2];
+
+    if (block) {
+        /* keep the gcoap thread from processing the following requests */
+        mutex_lock(block);
+        mutex_unlock(block);
+    }
+    if (pdu->payload_len != sizeof(id)) {
+        return gcoap_response(pdu, buf, len, COAP_CODE_BAD_REQUEST);
+    }
+    /* the response is built in the buffer of the request */
+    memcpy(id, pdu->payload, sizeof(id));
+    gcoap_resp_init(pdu, buf, len, COAP_CODE_CHANGED);
+    size_t resp_len = coap_opt_finish(pdu, COAP_OPT_FINISH_PAYLOAD);
+    memcpy(pdu->payload, id, sizeof(id));
+    return resp_len + sizeof(id);
+}
+
+static ssize_t _obs_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                            coap_request_ctx_t *ctx)
+{
+    const char *path = coap_request_ctx_get_path(ctx);
+
+    gcoap_resp_init(pdu, buf, len, COAP_CODE_CONTENT);
+    size_t resp_len = coap_opt_finish(pdu, COAP_OPT_FINISH_PAYLOAD);
+    /* "/obs/<n>" */
+    pdu->payload[0] = path[5] - '0';
+    return resp_len + 1;
+}
+
+static const coap_resource_t _resources[] = {
+    { "/block", COAP_POST, _echo_handler, &_block_lock },
+    { "/echo", COAP_POST, _echo_handler, NULL },
+    { "/obs/0", COAP_GET, _obs_handler, NULL },
+    { "/obs/1", COAP_GET, _obs_handler, NULL },
+    { "/obs/2", COAP_GET, _obs_handler, NULL },
+    { "/obs/3", COAP_GET, _obs_handler, NULL },
+    { "/obs/4", COAP_GET, _obs_handler, NULL },
+    { "/obs/5", COAP_GET, _obs_handler, NULL },
+    { "/obs/6", COAP_GET, _obs_handler, NULL },
+    { "/obs/7", COAP_GET, _obs_handler, NULL },
+};
+
+#define OBS_RESOURCES   (&_resources[2])
+
+static gcoap_listener_t _listener = {
+    .resources = _resources,
+    .resources_len = ARRAY_SIZE(_resources),
+};
+
+static void _resp_handler(const gcoap_request_memo_t *memo, coap_pkt_t *pdu,
+                          const sock_udp_ep_t *remote)
+{
+    unsigned context = (uintptr_t)memo->context;
+
+    (void)remote;
+    if (memo->state == GCOAP_MEMO_TIMEOUT) {
+        _timeouts++;
+    }
+    else if (memo->state != GCOAP_MEMO_RESP) {
+        _errors++;
+    }
+    else if (context >= OBS_CONTEXT) {
+        unsigned n = context - OBS_CONTEXT;
+
+        if ((n < OBS_NUMOF) && coap_has_observe(pdu) &&
+            (pdu->payload_len == 1) && (pdu->payload[0] == n)) {
+            _notifications[n]++;
+        }
+        else {
+            _errors++;
+        }
+    }
+    else if ((pdu->payload_len == 2) &&
+             (byteorder_bebuftohs(pdu->payload) == context)) {
+        _responses++;
+    }
+    else {
+        _errors++;
+    }
+}
+
+static ssize_t _send(const char *path, unsigned context, uint16_t port)
+{
+    static uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = port };
+    coap_pkt_t pdu;
+    ssize_t len;
+
+    memcpy(remote.addr.ipv6, &ipv6_addr_loopback, sizeof(remote.addr.ipv6));
+    if (context >= OBS_CONTEXT) {
+        expect(gcoap_req_init(&pdu, buf, sizeof(buf), COAP_METHOD_GET, NULL) == 0);
+        coap_opt_add_uint(&pdu, COAP_OPT_OBSERVE, COAP_OBS_REGISTER);
+        coap_opt_add_uri_path(&pdu, path);
+        len = coap_opt_finish(&pdu, COAP_OPT_FINISH_NONE);
+    }
+    else {
+        expect(gcoap_req_init(&pdu, buf, sizeof(buf), COAP_METHOD_POST, path) == 0);
+        len = coap_opt_finish(&pdu, COAP_OPT_FINISH_PAYLOAD);
+        byteorder_htobebufs(pdu.payload, context);
+        len += 2;
+    }
+    return gcoap_req_send(buf, len, &remote, NULL, _resp_handler,
+                          (void *)(uintptr_t)context, GCOAP_SOCKET_TYPE_UNDEF);
+}
+
+static void _wait_for(volatile unsigned *count, unsigned expected)
+{
+    for (unsigned i = 0; (*count < expected) && (i < 300); i++) {
+        ztimer_sleep(ZTIMER_MSEC, 10);
+    }
+}
+
+static void _test_in_flight(void)
+{
+    /* the first request blocks the gcoap thread until all are sent */
+    expect(_send("/block", 0, CONFIG_GCOAP_PORT) > 0);
+    for (unsigned i = 1; i < REQS_NUMOF; i++) {
+        expect(_send("/echo", i, CONFIG_GCOAP_PORT) > 0);
+    }
+    expect(gcoap_op_state() == REQS_NUMOF);
+    /* pool is exhausted */
+    expect(_send("/echo", REQS_NUMOF, CONFIG_GCOAP_PORT) == 0);
+
+    mutex_unlock(&_block_lock);
+    _wait_for(&_responses, REQS_NUMOF);
+    printf("%u responses matched\n", _responses);
+    expect(_responses == REQS_NUMOF);
+    expect(gcoap_op_state() == 0);
+}
+
+static void _test_timeout(void)
+{
+    for (unsigned i = 0; i < REQS_NUMOF; i++) {
+        expect(_send("/echo", i, NO_LISTENER) > 0);
+    }
+    _wait_for(&_timeouts, REQS_NUMOF);
+    printf("%u requests timed out\n", _timeouts);
+    expect(_timeouts == REQS_NUMOF);
+    expect(gcoap_op_state() == 0);
+}
+
+static void _test_observe(void)
+{
+    char path[] = "/obs/0";
+    unsigned total = 0;
+
+    for (unsigned i = 0; i < OBS_NUMOF; i++) {
+        path[5] = '0' + i;
+        expect(_send(path, OBS_CONTEXT + i, CONFIG_GCOAP_PORT) > 0);
+        /* the response to the registration is the first notification */
+        _wait_for(&_notifications[i], 1);
+        expect(_notifications[i] == 1);
+    }
+
+    for (unsigned round = 0; round < NOTIFY_ROUNDS; round++) {
+        /* notify in reverse order of registration */
+        for (unsigned i = OBS_NUMOF; i-- > 0;) {
+            uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+            coap_pkt_t pdu;
+
+            expect(gcoap_obs_init(&pdu, buf, sizeof(buf), &OBS_RESOURCES[i])
+                   == GCOAP_OBS_INIT_OK);
+            size_t len = coap_opt_finish(&pdu, COAP_OPT_FINISH_PAYLOAD);
+            pdu.payload[0] = i;
+            expect(gcoap_obs_send(buf, len + 1, &OBS_RESOURCES[i]) > 0);
+            _wait_for(&_notifications[i], round + 2);
+        }
+    }
+    for (unsigned i = 0; i < OBS_NUMOF; i++) {
+        expect(_notifications[i] == NOTIFY_ROUNDS + 1);
+        total += _notifications[i];
+    }
+    printf("%u notifications matched\n", total);
+}
+
+int main(void)
+{
+    gcoap_req_memo_pool_extend(_extra_memos, EXTRA_MEMOS);
+    gcoap_register_listener(&_listener);
+
+    _test_timeout();
+    _test_in_flight();
+    _test_observe();
+    expect(_errors == 0);
+
+    puts("SUCCESS");
+    return 0;
+}
@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for Observe notifications to many observers
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "net/gcoap.h"
+#include "net/ipv6/addr.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#define OBSERVER_PORT   (20000U)
+/* observers that open their socket to check the notifications */
+#define CHECKED_NUMOF   (4U)
+#define PAYLOAD_LEN     (64U)
+#define ROUNDS          (100U)
+
+static const unsigned _observers_numof[] = { 1, 32, 256 };
+
+static sock_udp_t _socks[CHECKED_NUMOF];
+static unsigned _registered;
+
+static ssize_t _obs_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                            coap_request_ctx_t *ctx)
+{
+    (void)ctx;
+    return gcoap_response(pdu, buf, len, COAP_CODE_CONTENT);
+}
+
+static const coap_resource_t _resources[] = {
+    { "/obs", COAP_GET, _obs_handler, NULL },
+};
+
+static gcoap_listener_t _listener = {
+    .resources = _resources,
+    .resources_len = ARRAY_SIZE(_resources),
+};
+
+static void _register(unsigned n)
+{
+    sock_udp_ep_t local = { .family = AF_INET6, .port = OBSERVER_PORT + n };
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = CONFIG_GCOAP_PORT };
+    sock_udp_t sock;
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE], token[4];
+    coap_pkt_t pdu;
+
+    byteorder_htobebufl(token, n);
+    ssize_t len = coap_build_hdr((coap_hdr_t *)buf, COAP_TYPE_NON, token,
+                                 sizeof(token), COAP_METHOD_GET, n);
+    coap_pkt_init(&pdu, buf, sizeof(buf), len);
+    coap_opt_add_uint(&pdu, COAP_OPT_OBSERVE, COAP_OBS_REGISTER);
+    coap_opt_add_uri_path(&pdu, "/obs");
+    len = coap_opt_finish(&pdu, COAP_OPT_FINISH_NONE);
+
+    memcpy(remote.addr.ipv6, &ipv6_addr_loopback, sizeof(remote.addr.ipv6));
+    expect(sock_udp_create(&sock, &local, NULL, 0) == 0);
+    expect(sock_udp_send(&sock, buf, len, &remote) == len);
+    /* closing the socket would not release a response still queued in it */
+    expect(sock_udp_recv(&sock, buf, sizeof(buf), 100 * US_PER_MS, NULL) > 0);
+    sock_udp_close(&sock);
+}
+
+static int _notify(uint8_t round)
+{
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    coap_pkt_t pdu;
+
+    if (gcoap_obs_init(&pdu, buf, sizeof(buf), &_resources[0]) != GCOAP_OBS_INIT_OK) {
+        return 0;
+    }
+    coap_opt_add_format(&pdu, COAP_FORMAT_TEXT);
+    coap_opt_add_uint(&pdu, COAP_OPT_MAX_AGE, 60);
+    size_t len = coap_opt_finish(&pdu, COAP_OPT_FINISH_PAYLOAD);
+    expect(pdu.payload_len >= PAYLOAD_LEN);
+    memset(pdu.payload, round, PAYLOAD_LEN);
+    return gcoap_obs_send_all(buf, len + PAYLOAD_LEN, &_resources[0]);
+}
+
+static void _check(unsigned observers, uint8_t round)
+{
+    unsigned checked = (observers < CHECKED_NUMOF) ? observers : CHECKED_NUMOF;
+    uint16_t msgids[CHECKED_NUMOF];
+
+    for (unsigned n = 0; n < checked; n++) {
+        sock_udp_ep_t local = { .family = AF_INET6, .port = OBSERVER_PORT + n };
+
+        expect(sock_udp_create(&_socks[n], &local, NULL, 0) == 0);
+    }
+    expect(_notify(round) == (int)observers);
+
+    for (unsigned n = 0; n < checked; n++) {
+        uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+        coap_pkt_t pdu;
+
+        ssize_t len = sock_udp_recv(&_socks[n], buf, sizeof(buf),
+                                    100 * US_PER_MS, NULL);
+        expect(len > 0);
+        expect(coap_parse(&pdu, buf, len) == 0);
+        expect(coap_get_type(&pdu) == COAP_TYPE_NON);
+        expect(coap_get_code_raw(&pdu) == COAP_CODE_CONTENT);
+        expect(coap_get_token_len(&pdu) == 4);
+        expect(byteorder_bebuftohl(coap_get_token(&pdu)) == n);
+        expect(coap_has_observe(&pdu));
+        expect(coap_get_content_type(&pdu) == COAP_FORMAT_TEXT);
+        expect(pdu.payload_len == PAYLOAD_LEN);
+        for (unsigned i = 0; i < PAYLOAD_LEN; i++) {
+            expect(pdu.payload[i] == round);
+        }
+        msgids[n] = coap_get_id(&pdu);
+        for (unsigned i = 0; i < n; i++) {
+            expect(msgids[i] != msgids[n]);
+        }
+        /* further notifications would be held in the socket */
+        sock_udp_close(&_socks[n]);
+    }
+}
+
+static void _test(unsigned numof)
+{
+    while (_registered < numof) {
+        _register(_registered++);
+    }
+    _check(numof, 0xa5);
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned round = 0; round < ROUNDS; round++) {
+        expect(_notify(round) == (int)numof);
+    }
+    uint32_t usec = (ztimer_now(ZTIMER_USEC) - start) / ROUNDS;
+
+    printf("%3u observers: %" PRIu32 " us per round, %" PRIu32 " us per observer\n",
+           numof, usec, usec / numof);
+}
+
+int main(void)
+{
+    gcoap_register_listener(&_listener);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_observers_numof); i++) {
+        _test(_observers_numof[i]);
+    }
+
+    puts("SUCCESS");
+    return 0;
+}
@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for observers in (1, 32, 256):
+        child.expect(r"{:3d} observers: (\d+) us per round".format(observers),
+                     timeout=30)
+    child.expect_exact("SUCCESS", timeout=30)
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
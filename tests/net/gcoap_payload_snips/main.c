@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for payload snips in gcoap resource handlers
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/gcoap.h"
+#include "net/ipv6/addr.h"
+#include "net/nanocoap_sock.h"
+#include "test_utils/expect.h"
+
+#define REP_SIZE        (1000U)
+
+static uint8_t _rep[REP_SIZE];
+static uint8_t _dl_buf[REP_SIZE];
+
+/* gcoap sends the snips after the handler returned */
+static iolist_t _snip;
+
+static ssize_t _rep_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                            coap_request_ctx_t *ctx)
+{
+    (void)ctx;
+    gcoap_resp_init(pdu, buf, len, COAP_CODE_CONTENT);
+    coap_opt_add_format(pdu, COAP_FORMAT_OCTET);
+    size_t resp_len = coap_opt_finish(pdu, COAP_OPT_FINISH_PAYLOAD);
+
+    _snip.iol_base = _rep;
+    _snip.iol_len = sizeof(_rep);
+    coap_payload_add_snip(pdu, &_snip);
+    return resp_len;
+}
+
+static ssize_t _block_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                              coap_request_ctx_t *ctx)
+{
+    coap_block_slicer_t slicer;
+
+    (void)ctx;
+    coap_block2_init(pdu, &slicer);
+    gcoap_resp_init(pdu, buf, len, COAP_CODE_CONTENT);
+    coap_opt_add_format(pdu, COAP_FORMAT_OCTET);
+    coap_opt_add_block2(pdu, &slicer, 1);
+    size_t resp_len = coap_opt_finish(pdu, COAP_OPT_FINISH_PAYLOAD);
+
+    coap_blockwise_put_snip(&slicer, pdu, &_snip, _rep, sizeof(_rep));
+    coap_block2_finish(&slicer);
+    return resp_len;
+}
+
+static ssize_t _fail_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                             coap_request_ctx_t *ctx)
+{
+    (void)_rep_handler(pdu, buf, len, ctx);
+    /* gcoap must not send the snip with its error response */
+    return -EINVAL;
+}
+
+static const coap_resource_t _resources[] = {
+    { "/block", COAP_GET, _block_handler, NULL },
+    { "/fail", COAP_GET, _fail_handler, NULL },
+    { "/rep", COAP_GET, _rep_handler, NULL },
+};
+
+static gcoap_listener_t _listener = {
+    .resources = _resources,
+    .resources_len = ARRAY_SIZE(_resources),
+};
+
+static void _test_single(nanocoap_sock_t *sock)
+{
+    memset(_dl_buf, 0, sizeof(_dl_buf));
+    ssize_t res = nanocoap_sock_get(sock, "/rep", _dl_buf, sizeof(_dl_buf));
+    expect(res == REP_SIZE);
+    expect(!memcmp(_dl_buf, _rep, sizeof(_rep)));
+    printf("single response: %" PRIdSIZE " bytes\n", res);
+}
+
+static void _test_blockwise(nanocoap_sock_t *sock, coap_blksize_t blksize)
+{
+    memset(_dl_buf, 0, sizeof(_dl_buf));
+    ssize_t res = nanocoap_get_blockwise_to_buf(sock, "/block", blksize,
+                                                _dl_buf, sizeof(_dl_buf));
+    expect(res == REP_SIZE);
+    expect(!memcmp(_dl_buf, _rep, sizeof(_rep)));
+    printf("block-wise, %u byte blocks: %" PRIdSIZE " bytes\n",
+           coap_szx2size(blksize), res);
+}
+
+static int _fail_cb(void *arg, coap_pkt_t *pkt)
+{
+    (void)arg;
+    expect(coap_get_code_raw(pkt) == COAP_CODE_INTERNAL_SERVER_ERROR);
+    expect(pkt->payload_len == 0);
+    return 0;
+}
+
+static void _test_fail(nanocoap_sock_t *sock)
+{
+    uint8_t buf[32];
+    coap_pkt_t pkt;
+
+    ssize_t len = coap_build_hdr((coap_hdr_t *)buf, COAP_TYPE_CON, NULL, 0,
+                                 COAP_METHOD_GET, nanocoap_sock_next_msg_id(sock));
+    coap_pkt_init(&pkt, buf, sizeof(buf), len);
+    coap_opt_add_uri_path(&pkt, "/fail");
+    coap_opt_finish(&pkt, COAP_OPT_FINISH_NONE);
+    pkt.payload_len = 0;
+    expect(nanocoap_sock_request_cb(sock, &pkt, _fail_cb, NULL) == 0);
+    puts("failed handler: error response without payload");
+}
+
+int main(void)
+{
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = CONFIG_GCOAP_PORT };
+    nanocoap_sock_t sock;
+
+    for (unsigned i = 0; i < sizeof(_rep); i++) {
+        _rep[i] = i * 7;
+    }
+    gcoap_register_listener(&_listener);
+
+    memcpy(remote.addr.ipv6, &ipv6_addr_loopback, sizeof(remote.addr.ipv6));
+    expect(nanocoap_sock_connect(&sock, NULL, &remote) == 0);
+
+    _test_single(&sock);
+    _test_blockwise(&sock, COAP_BLOCKSIZE_16);
+    _test_blockwise(&sock, COAP_BLOCKSIZE_64);
+    _test_blockwise(&sock, COAP_BLOCKSIZE_256);
+    _test_fail(&sock);
+
+    nanocoap_sock_close(&sock);
+    puts("SUCCESS");
+    return 0;
+}
@@ -423,6 +423,46 @@ static void test_rbuf_add__full_rbuf(void)
     _check_pktbuf(NULL);
 }
 
+static void test_rbuf_add__interleaved_datagrams(void)
+{
+    gnrc_sixlowpan_frag_rb_t *entries[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+    gnrc_pktsnip_t *pkt;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        _set_fragment_tag(_fragment2, TEST_TAG + i);
+        pkt = gnrc_pktbuf_add(NULL, _fragment2, sizeof(_fragment2),
+                              GNRC_NETTYPE_SIXLOWPAN);
+        TEST_ASSERT_NOT_NULL(pkt);
+        TEST_ASSERT_NOT_NULL((entries[i] = gnrc_sixlowpan_frag_rb_add(
+            &_test_netif_hdr.hdr, pkt, TEST_FRAGMENT2_OFFSET, TEST_PAGE
+        )));
+        for (unsigned j = 0; j < i; j++) {
+            TEST_ASSERT(entries[i] != entries[j]);
+        }
+    }
+    /* subsequent fragments of all datagrams are added to their entries */
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        _set_fragment_tag(_fragment3, TEST_TAG + i);
+        pkt = gnrc_pktbuf_add(NULL, _fragment3, sizeof(_fragment3),
+                              GNRC_NETTYPE_SIXLOWPAN);
+        TEST_ASSERT_NOT_NULL(pkt);
+        TEST_ASSERT(entries[i] == gnrc_sixlowpan_frag_rb_add(
+            &_test_netif_hdr.hdr, pkt, TEST_FRAGMENT3_OFFSET, TEST_PAGE
+        ));
+        TEST_ASSERT(entries[i] == gnrc_sixlowpan_frag_rb_get_by_datagram(
+            &_test_netif_hdr.hdr, TEST_TAG + i
+        ));
+        TEST_ASSERT_EQUAL_INT(TEST_FRAGMENT4_OFFSET - TEST_FRAGMENT2_OFFSET,
+                              entries[i]->super.current_size);
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        gnrc_sixlowpan_frag_rb_rm_by_datagram(&_test_netif_hdr.hdr,
+                                              TEST_TAG + i);
+    }
+    TEST_ASSERT_NULL(_first_non_empty_rbuf());
+    _check_pktbuf(NULL);
+}
+
 static void test_rbuf_add__too_big_fragment(void)
 {
     gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, _fragment1,
@@ -647,6 +687,7 @@ static void run_unittests(void)
         new_TestFixture(test_rbuf_add__success_duplicate_fragments),
         new_TestFixture(test_rbuf_add__success_complete),
         new_TestFixture(test_rbuf_add__full_rbuf),
+        new_TestFixture(test_rbuf_add__interleaved_datagrams),
         new_TestFixture(test_rbuf_add__too_big_fragment),
         new_TestFixture(test_rbuf_add__overlap_lhs),
         new_TestFixture(test_rbuf_add__overlap_rhs),
@@ -11,11 +11,14 @@
 
 #include "shell.h"
 #include "msg.h"
+#include "event/thread.h"
+#include "net/sock/async/event.h"
 #include "net/sock/tcp.h"
 #include "net/gnrc/tcp.h"
 
 #define MAIN_QUEUE_SIZE (8)
 #define SOCK_TCP_QUEUE_SIZE (1)
+#define SOCK_TCP_ASYNC_QUEUE_SIZE (4)
 #define BUFFER_SIZE (1024)
 
 static msg_t main_msg_queue[MAIN_QUEUE_SIZE];
@@ -23,6 +26,9 @@ static sock_tcp_t socks[SOCK_TCP_QUEUE_SIZE];
 static sock_tcp_t *sock = socks;
 static sock_tcp_queue_t sock_queue;
 static char buffer[BUFFER_SIZE];
+static sock_tcp_t async_socks[SOCK_TCP_ASYNC_QUEUE_SIZE];
+static sock_tcp_queue_t async_queue;
+static char async_buffer[BUFFER_SIZE];
 
 void dump_args(int argc, char **argv)
 {
@@ -192,6 +198,65 @@ int sock_tcp_get_remote_cmd(int argc, char **argv)
     return 0;
 }
 
+/* Echo server serving all connections of async_queue from the event thread */
+static void _async_sock_cb(sock_tcp_t *sock, sock_async_flags_t flags, void *arg)
+{
+    (void) arg;
+
+    if (flags & SOCK_ASYNC_MSG_RECV) {
+        ssize_t ret;
+
+        while ((ret = sock_tcp_read(sock, async_buffer, sizeof(async_buffer), 0)) > 0) {
+            printf("sock_tcp_serve_async: echo %d\n", (int) ret);
+            sock_tcp_write(sock, async_buffer, ret);
+        }
+        /* Reading zero bytes signals the end of the stream */
+        if (ret == 0) {
+            flags |= SOCK_ASYNC_CONN_FIN;
+        }
+    }
+    if (flags & SOCK_ASYNC_CONN_FIN) {
+        sock_tcp_event_close(sock);
+        printf("sock_tcp_serve_async: closed\n");
+    }
+}
+
+static void _async_queue_cb(sock_tcp_queue_t *queue, sock_async_flags_t flags, void *arg)
+{
+    (void) arg;
+    sock_tcp_t *sock = NULL;
+
+    if (flags & SOCK_ASYNC_CONN_RECV) {
+        while (sock_tcp_accept(queue, &sock, 0) == 0) {
+            printf("sock_tcp_serve_async: accepted\n");
+            sock_tcp_event_init(sock, EVENT_PRIO_MEDIUM, _async_sock_cb, NULL);
+        }
+    }
+}
+
+int sock_tcp_serve_async_cmd(int argc, char **argv)
+{
+    dump_args(argc, argv);
+    sock_tcp_ep_t ep = SOCK_IPV6_EP_ANY;
+    gnrc_tcp_ep_from_str((gnrc_tcp_ep_t *) &ep, argv[1]);
+    uint16_t flags = 0;
+
+    int err = sock_tcp_listen(&async_queue, &ep, async_socks, SOCK_TCP_ASYNC_QUEUE_SIZE, flags);
+    if (err == 0) {
+        sock_tcp_queue_event_init(&async_queue, EVENT_PRIO_MEDIUM, _async_queue_cb, NULL);
+    }
+    print_result(argv[0], err);
+    return 0;
+}
+
+int sock_tcp_stop_serve_async_cmd(int argc, char **argv)
+{
+    dump_args(argc, argv);
+    sock_tcp_stop_listen(&async_queue);
+    printf("%s: returns\n", argv[0]);
+    return 0;
+}
+
 /* Exporting GNRC SOCK TCP Api to for shell usage */
 static const shell_command_t shell_commands[] = {
     { "sock_tcp_connect", "connect", sock_tcp_connect_cmd },
@@ -204,6 +269,8 @@ static const shell_command_t shell_commands[] = {
     { "sock_tcp_get_local", "get_local", sock_tcp_get_local_cmd },
     { "sock_tcp_queue_get_local", "queue_get_local", sock_tcp_queue_get_local_cmd },
     { "sock_tcp_get_remote", "get_remote", sock_tcp_get_remote_cmd },
+    { "sock_tcp_serve_async", "echo server using sock_async", sock_tcp_serve_async_cmd },
+    { "sock_tcp_stop_serve_async", "stop echo server", sock_tcp_stop_serve_async_cmd },
     { NULL, NULL, NULL }
 };
 
@@ -10,8 +10,8 @@ import os
 import sys
 import random
 
-from helpers import Runner, SockTcpServer, SockTcpClient, HostTcpServer, HostTcpClient, \
-                    generate_port_number, sudo_guard
+from helpers import Runner, SockTcpServer, SockTcpAsyncServer, SockTcpClient, HostTcpServer, \
+                    HostTcpClient, generate_port_number, sudo_guard
 
 
 @Runner(timeout=5)
@@ -144,6 +144,32 @@ def test_connection_listen_accept_cycle(child, iterations=10):
                     sock_srv.disconnect()
 
 
+@Runner(timeout=10)
+def test_async_connections(child, clients=4):
+    """ This test verifies that a single thread serves multiple connections
+        using the asynchronous sock events
+    """
+    with SockTcpAsyncServer(child, generate_port_number()) as sock_srv:
+        host_clis = [HostTcpClient(sock_srv) for _ in range(clients)]
+
+        # Open all connections at once
+        for host_cli in host_clis:
+            host_cli.open()
+        for _ in host_clis:
+            child.expect_exact('sock_tcp_serve_async: accepted')
+
+        # Exchange data on each connection, in reverse order of opening
+        for i, host_cli in reversed(list(enumerate(host_clis))):
+            data = 'client {}'.format(i)
+            host_cli.send(data)
+            host_cli.receive(data)
+
+        # Close connections from the host side
+        for host_cli in host_clis:
+            host_cli.close()
+            child.expect_exact('sock_tcp_serve_async: closed')
+
+
 if __name__ == '__main__':
     sudo_guard()
 
@@ -205,6 +205,21 @@ class SockTcpServer(_SockTcpNode):
         self.child.expect_exact('sock_tcp_queue_get_local: returns 0')
 
 
+class SockTcpAsyncServer(SockTcpServer):
+    """ Echo server serving all connections from a single thread """
+    def listen(self):
+        self.child.sendline('sock_tcp_serve_async [{}]:{}'.format(
+            self.listen_addr, self.listen_port)
+        )
+        self.child.expect_exact('sock_tcp_serve_async: returns 0')
+        self.listening = True
+
+    def stop_listen(self):
+        self.child.sendline('sock_tcp_stop_serve_async')
+        self.child.expect_exact('sock_tcp_stop_serve_async: returns')
+        self.listening = False
+
+
 class SockTcpClient(_SockTcpNode):
     def __init__(self, child, target, local_port=0):
         super().__init__(child)
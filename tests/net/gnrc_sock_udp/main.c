@@ -22,7 +22,9 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 
+#include "container.h"
 #include "net/sock/udp.h"
 #include "test_utils/expect.h"
 #include "xtimer.h"
@@ -518,6 +520,41 @@ static void test_sock_udp_recv_buf__success(void)
     expect(_check_net());
 }
 
+static void test_sock_udp_recv_many__success(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    char bufs[3][sizeof("ABCD")];
+    sock_udp_ep_t results[3];
+    sock_udp_msg_t msgs[3];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(msgs); i++) {
+        msgs[i].data = bufs[i];
+        msgs[i].len = sizeof(bufs[i]);
+        msgs[i].remote = &results[i];
+    }
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                          _TEST_NETIF));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE + 1,
+                          _TEST_PORT_LOCAL, "EFG", sizeof("EFG"),
+                          _TEST_NETIF));
+    /* only the available messages are received */
+    expect(2 == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs),
+                                   SOCK_NO_TIMEOUT));
+    expect(sizeof("ABCD") == msgs[0].len);
+    expect(memcmp(bufs[0], "ABCD", sizeof("ABCD")) == 0);
+    expect(_TEST_PORT_REMOTE == results[0].port);
+    expect(sizeof("EFG") == msgs[1].len);
+    expect(memcmp(bufs[1], "EFG", sizeof("EFG")) == 0);
+    expect(_TEST_PORT_REMOTE + 1 == results[1].port);
+    expect(-EAGAIN == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs), 0));
+    expect(_check_net());
+}
+
 static void test_sock_udp_send__EAFNOSUPPORT(void)
 {
     static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
@@ -821,6 +858,71 @@ static void test_sock_udp_send__no_sock(void)
     expect(_check_net());
 }
 
+static void test_sock_udp_send_buf__EINVAL_port(void)
+{
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                          .family = AF_INET6 };
+    void *data, *ctx;
+
+    expect(0 == sock_udp_send_buf_alloc(&data, &ctx, sizeof("ABCD")));
+    memcpy(data, "ABCD", sizeof("ABCD"));
+    expect(-EINVAL == sock_udp_send_buf(NULL, ctx, sizeof("ABCD"), &remote));
+    expect(_check_net());
+}
+
+static void test_sock_udp_send_buf__free(void)
+{
+    void *data, *ctx;
+
+    expect(0 == sock_udp_send_buf_alloc(&data, &ctx, sizeof("ABCD")));
+    sock_udp_send_buf_free(ctx);
+    expect(_check_net());
+}
+
+static void test_sock_udp_send_buf__socketed(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const sock_udp_ep_t local = { .addr = { .ipv6 = _TEST_ADDR_LOCAL },
+                                         .family = AF_INET6,
+                                         .netif = _TEST_NETIF,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE };
+    void *data, *ctx;
+
+    expect(0 == sock_udp_create(&_sock, &local, &remote, SOCK_FLAGS_REUSE_EP));
+    expect(0 == sock_udp_send_buf_alloc(&data, &ctx, 32));
+    memcpy(data, "ABCD", sizeof("ABCD"));
+    expect(sizeof("ABCD") == sock_udp_send_buf(&_sock, ctx, sizeof("ABCD"),
+                                               NULL));
+    expect(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE, "ABCD", sizeof("ABCD"),
+                         _TEST_NETIF, false));
+    xtimer_usleep(1000);    /* let GNRC stack finish */
+    expect(_check_net());
+}
+
+static void test_sock_udp_send_buf__no_sock_no_netif(void)
+{
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE };
+    void *data, *ctx;
+
+    expect(0 == sock_udp_send_buf_alloc(&data, &ctx, sizeof("ABCD")));
+    memcpy(data, "ABCD", sizeof("ABCD"));
+    expect(sizeof("ABCD") == sock_udp_send_buf(NULL, ctx, sizeof("ABCD"),
+                                               &remote));
+    expect(_check_packet(&ipv6_addr_unspecified, &dst_addr, 0,
+                         _TEST_PORT_REMOTE, "ABCD", sizeof("ABCD"),
+                         SOCK_ADDR_ANY_NETIF, true));
+    xtimer_usleep(1000);    /* let GNRC stack finish */
+    expect(_check_net());
+}
+
 int main(void)
 {
     _net_init();
@@ -855,6 +957,7 @@ int main(void)
     CALL(test_sock_udp_recv__non_blocking());
     CALL(test_sock_udp_recv__aux());
     CALL(test_sock_udp_recv_buf__success());
+    CALL(test_sock_udp_recv_many__success());
     _prepare_send_checks();
     CALL(test_sock_udp_send__EAFNOSUPPORT());
     CALL(test_sock_udp_send__EINVAL_addr());
@@ -873,6 +976,10 @@ int main(void)
     CALL(test_sock_udp_send__unsocketed());
     CALL(test_sock_udp_send__no_sock_no_netif());
     CALL(test_sock_udp_send__no_sock());
+    CALL(test_sock_udp_send_buf__EINVAL_port());
+    CALL(test_sock_udp_send_buf__free());
+    CALL(test_sock_udp_send_buf__socketed());
+    CALL(test_sock_udp_send_buf__no_sock_no_netif());
 
     puts("ALL TESTS SUCCESSFUL");
 
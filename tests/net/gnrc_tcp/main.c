@@ -134,6 +134,33 @@ int gnrc_tcp_tcb_init_cmd(int argc, char **argv)
     return 0;
 }
 
+int gnrc_tcp_tcb_set_rcv_buf_size_cmd(int argc, char **argv)
+{
+    dump_args(argc, argv);
+
+    size_t size = atol(argv[1]);
+    int err = 0;
+
+    // Apply size to all given TCBs
+    for (int i = 0; i < TCB_QUEUE_SIZE && !err; ++i)
+    {
+        err = gnrc_tcp_tcb_set_rcv_buf_size(&(tcbs[i]), size);
+    }
+    switch (err) {
+        case -EINVAL:
+            printf("%s: returns -EINVAL\n", argv[0]);
+            break;
+
+        case -EISCONN:
+            printf("%s: returns -EISCONN\n", argv[0]);
+            break;
+
+        default:
+            printf("%s: returns %d\n", argv[0], err);
+    }
+    return err;
+}
+
 int gnrc_tcp_open_cmd(int argc, char **argv)
 {
     dump_args(argc, argv);
@@ -325,6 +352,52 @@ int gnrc_tcp_recv_cmd(int argc, char **argv)
     return 0;
 }
 
+int gnrc_tcp_recv_buf_cmd(int argc, char **argv)
+{
+    dump_args(argc, argv);
+
+    int timeout = atol(argv[1]);
+    size_t to_receive = atol(argv[2]);
+    size_t rcvd = 0;
+
+    do {
+        void *data = NULL;
+        int ret = gnrc_tcp_recv_buf(tcb, &data, to_receive - rcvd, timeout);
+        switch (ret) {
+            case 0:
+                printf("%s: returns 0\n", argv[0]);
+                return ret;
+
+            case -EAGAIN:
+                printf("%s: returns -EAGAIN\n", argv[0]);
+                continue;
+
+            case -ETIMEDOUT:
+                printf("%s: returns -ETIMEDOUT\n", argv[0]);
+                continue;
+
+            case -ENOTCONN:
+                printf("%s: returns -ENOTCONN\n", argv[0]);
+                return ret;
+
+            case -ECONNRESET:
+                printf("%s: returns -ECONNRESET\n", argv[0]);
+                return ret;
+
+            case -ECONNABORTED:
+                printf("%s: returns -ECONNABORTED\n", argv[0]);
+                return ret;
+        }
+        // Copy data for verification only, before releasing it
+        memcpy(buffer + rcvd, data, ret);
+        gnrc_tcp_recv_buf_consume(tcb, ret);
+        rcvd += ret;
+    } while (rcvd < to_receive);
+
+    printf("%s: received %" PRIuSIZE "\n", argv[0], rcvd);
+    return 0;
+}
+
 int gnrc_tcp_close_cmd(int argc, char **argv)
 {
     dump_args(argc, argv);
@@ -427,6 +500,8 @@ static const shell_command_t shell_commands[] = {
       gnrc_tcp_ep_from_str_cmd },
     { "gnrc_tcp_tcb_init", "gnrc_tcp: init tcb",
       gnrc_tcp_tcb_init_cmd },
+    { "gnrc_tcp_tcb_set_rcv_buf_size", "gnrc_tcp: set receive buffer size of tcbs",
+      gnrc_tcp_tcb_set_rcv_buf_size_cmd },
     { "gnrc_tcp_open", "gnrc_tcp: open connection",
       gnrc_tcp_open_cmd },
     { "gnrc_tcp_listen", "gnrc_tcp: listen for connection",
@@ -437,6 +512,8 @@ static const shell_command_t shell_commands[] = {
       gnrc_tcp_send_cmd },
     { "gnrc_tcp_recv", "gnrc_tcp: recv data from connected peer",
       gnrc_tcp_recv_cmd },
+    { "gnrc_tcp_recv_buf", "gnrc_tcp: recv data from connected peer in place",
+      gnrc_tcp_recv_buf_cmd },
     { "gnrc_tcp_close", "gnrc_tcp: close connection gracefully",
       gnrc_tcp_close_cmd },
     { "gnrc_tcp_abort", "gnrc_tcp: close connection forcefully",
@@ -83,6 +83,33 @@ def test_send_data_from_host_to_riot(child):
             riot_srv.close()
 
 
+@Runner(timeout=5)
+def test_send_data_from_host_to_riot_with_recv_buf(child):
+    """ Send Data from Host system to RIOT node, read it in place from a
+        receive buffer smaller than the data
+    """
+    # Setup RIOT as server with small receive buffers
+    riot_srv = RiotTcpServer(child, generate_port_number())
+    child.sendline('gnrc_tcp_tcb_set_rcv_buf_size 700')
+    child.expect_exact('gnrc_tcp_tcb_set_rcv_buf_size: returns 0')
+
+    with riot_srv:
+        # Setup Host as client
+        with HostTcpClient(riot_srv) as host_cli:
+            riot_srv.accept(timeout_ms=1000)
+
+            # Send Data from Host system to RIOT
+            data = '0123456789' * 200
+            host_cli.send(data)
+
+            assert riot_srv._setup_internal_buffer() >= len(data)
+            child.sendline('gnrc_tcp_recv_buf 1000 {}'.format(len(data)))
+            child.expect_exact('gnrc_tcp_recv_buf: received {}'.format(len(data)), timeout=20)
+            assert riot_srv._read_data_from_internal_buffer(len(data)) == data
+
+            riot_srv.close()
+
+
 @Runner(timeout=5)
 def test_gnrc_tcp_garbage_packets_short_payload(child):
     """ Receive unusually short payload with timeout. Verifies fix for
@@ -670,6 +697,31 @@ def test_connection_listen_accept_cycle(child, iterations=10):
                     riot_srv.abort()
 
 
+@Runner(timeout=10)
+def test_connection_burst_accept(child, clients=4):
+    """ This test verifies that a server with a single TCB accepts a burst of
+        simultaneous connection requests one after another
+    """
+    # Setup RIOT Node as server
+    with RiotTcpServer(child, generate_port_number()) as riot_srv:
+        # All clients complete their handshake while the TCB is busy
+        host_clis = [HostTcpClient(riot_srv) for _ in range(clients)]
+        for host_cli in host_clis:
+            host_cli.open()
+
+        # Serve clients in the order they connected
+        for i, host_cli in enumerate(host_clis):
+            print('\n    Accepting client {}'.format(i), end='')
+            riot_srv.accept(timeout_ms=1000)
+
+            data = 'client {}'.format(i)
+            host_cli.send(payload_to_send=data)
+            riot_srv.receive(timeout_ms=1000, sent_payload=data)
+
+            host_cli.close()
+            riot_srv.close()
+
+
 if __name__ == '__main__':
     sudo_guard(uses_scapy=True)
 
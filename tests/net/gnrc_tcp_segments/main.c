@@ -0,0 +1,596 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the segments exchanged by GNRC TCP
+ *
+ * The test plays the peer of the connections: it injects segments into GNRC
+ * TCP and captures the segments GNRC TCP hands to the IPv6 layer.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "congure/reno.h"
+#include "embUnit.h"
+#include "macros/utils.h"
+#include "msg.h"
+#include "net/af.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/tcp.h"
+#include "net/protnum.h"
+#include "net/tcp.h"
+#include "ztimer.h"
+
+#define TEST_PORT           (2500U)
+#define TEST_OTHER_PORT     (2501U)
+#define TEST_PEER_ISS       (0x10000000U)
+#define TEST_PEER_WND       (0xffffU)
+#define TEST_TIMEOUT_MS     (100U)
+
+#define CTL_FIN             (0x0001U)
+#define CTL_SYN             (0x0002U)
+#define CTL_RST             (0x0004U)
+#define CTL_PSH             (0x0008U)
+#define CTL_ACK             (0x0010U)
+#define CTL_MSK             (0x003fU)
+
+/* local address of GNRC TCP and address of the peer */
+#define TEST_LOCAL_ADDR     { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, \
+                              0, 0, 0, 0, 0, 0, 0, 0x01 }
+#define TEST_PEER_ADDR      { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, \
+                              0, 0, 0, 0, 0, 0, 0, 0x02 }
+
+/**
+ * @brief   A segment sent by GNRC TCP
+ */
+typedef struct {
+    uint32_t seq;
+    uint32_t ack;
+    uint16_t ctl;
+    uint16_t wnd;
+    uint8_t opts[TCP_HDR_OFFSET_MAX * 4 - sizeof(tcp_hdr_t)];
+    size_t opts_len;
+    size_t len;                         /**< length of the payload */
+} _seg_t;
+
+static msg_t _msg_queue[16];
+static gnrc_netreg_entry_t _ipv6 = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                              KERNEL_PID_UNDEF);
+static const ipv6_addr_t _local = { .u8 = TEST_LOCAL_ADDR };
+static const ipv6_addr_t _peer = { .u8 = TEST_PEER_ADDR };
+
+static gnrc_tcp_tcb_queue_t _queue;
+static gnrc_tcp_tcb_t _tcb;
+static gnrc_tcp_tcb_queue_t _other_queue;
+static gnrc_tcp_tcb_t _other_tcb;
+static uint8_t _data[CONFIG_GNRC_TCP_DEFAULT_WINDOW];
+
+/* connection state of the peer, every connection uses a new port */
+static uint16_t _peer_port = 49152U;
+static uint32_t _peer_nxt;
+static uint32_t _local_nxt;
+
+static void _inject_opts(uint16_t ctl, uint32_t seq, uint32_t ack, uint16_t wnd,
+                         const uint8_t *opts, size_t opts_len,
+                         const void *data, size_t len)
+{
+    size_t hdr_len = sizeof(tcp_hdr_t) + opts_len;
+    gnrc_pktsnip_t *tcp, *ip;
+    tcp_hdr_t *hdr;
+
+    /* a single snip for header and payload, GNRC TCP marks the header */
+    tcp = gnrc_pktbuf_add(NULL, NULL, hdr_len + len, GNRC_NETTYPE_TCP);
+    ip = gnrc_ipv6_hdr_build(NULL, &_peer, &_local);
+    TEST_ASSERT_NOT_NULL(tcp);
+    TEST_ASSERT_NOT_NULL(ip);
+
+    hdr = tcp->data;
+    memset(hdr, 0, sizeof(tcp_hdr_t));
+    hdr->src_port = byteorder_htons(_peer_port);
+    hdr->dst_port = byteorder_htons(TEST_PORT);
+    hdr->seq_num = byteorder_htonl(seq);
+    hdr->ack_num = byteorder_htonl(ack);
+    hdr->off_ctl = byteorder_htons(((hdr_len / 4) << 12) | ctl);
+    hdr->window = byteorder_htons(wnd);
+    memcpy(hdr + 1, opts, opts_len);
+    memcpy((uint8_t *)tcp->data + hdr_len, data, len);
+
+    ((ipv6_hdr_t *)ip->data)->nh = PROTNUM_TCP;
+    ((ipv6_hdr_t *)ip->data)->len = byteorder_htons(tcp->size);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_tcp_calc_csum(tcp, ip));
+    tcp->next = ip;
+
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netapi_dispatch_receive(GNRC_NETTYPE_TCP,
+                                                          GNRC_NETREG_DEMUX_CTX_ALL,
+                                                          tcp));
+}
+
+static void _inject(uint16_t ctl, uint32_t seq, uint32_t ack, uint16_t wnd,
+                    const void *data, size_t len)
+{
+    _inject_opts(ctl, seq, ack, wnd, NULL, 0, data, len);
+}
+
+/* the TCP thread has a higher priority, it already sent its replies */
+static gnrc_pktsnip_t *_capture_pkt(void)
+{
+    msg_t msg;
+
+    while (ztimer_msg_receive_timeout(ZTIMER_MSEC, &msg, TEST_TIMEOUT_MS) >= 0) {
+        if (msg.type == GNRC_NETAPI_MSG_TYPE_SND) {
+            return msg.content.ptr;
+        }
+    }
+    return NULL;
+}
+
+static void _parse(gnrc_pktsnip_t *pkt, _seg_t *seg)
+{
+    gnrc_pktsnip_t *tcp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
+    tcp_hdr_t *hdr = tcp->data;
+    uint16_t off_ctl = byteorder_ntohs(hdr->off_ctl);
+
+    seg->seq = byteorder_ntohl(hdr->seq_num);
+    seg->ack = byteorder_ntohl(hdr->ack_num);
+    seg->ctl = off_ctl & CTL_MSK;
+    seg->wnd = byteorder_ntohs(hdr->window);
+    seg->opts_len = tcp->size - sizeof(tcp_hdr_t);
+    memcpy(seg->opts, hdr + 1, seg->opts_len);
+    seg->len = gnrc_pkt_len(tcp->next);
+}
+
+static bool _capture(_seg_t *seg)
+{
+    gnrc_pktsnip_t *pkt = _capture_pkt();
+
+    if (pkt == NULL) {
+        return false;
+    }
+    _parse(pkt, seg);
+    gnrc_pktbuf_release(pkt);
+    return true;
+}
+
+static void _drain(void)
+{
+    _seg_t seg;
+
+    while (_capture(&seg)) {}
+}
+
+/* returns the option of kind in seg, NULL if seg carries none */
+static const uint8_t *_opt(const _seg_t *seg, uint8_t kind)
+{
+    for (size_t i = 0; i < seg->opts_len;) {
+        if (seg->opts[i] == TCP_OPTION_KIND_EOL) {
+            break;
+        }
+        if (seg->opts[i] == TCP_OPTION_KIND_NOP) {
+            i++;
+            continue;
+        }
+        if (seg->opts[i] == kind) {
+            return &seg->opts[i];
+        }
+        i += seg->opts[i + 1];
+    }
+    return NULL;
+}
+
+static void _listen(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t *tcb,
+                    uint16_t port, size_t rcv_buf_size)
+{
+    gnrc_tcp_ep_t local;
+
+    gnrc_tcp_tcb_queue_init(queue);
+    gnrc_tcp_tcb_init(tcb);
+    if (rcv_buf_size) {
+        TEST_ASSERT_EQUAL_INT(0, gnrc_tcp_tcb_set_rcv_buf_size(tcb, rcv_buf_size));
+    }
+    TEST_ASSERT_EQUAL_INT(0, gnrc_tcp_ep_init(&local, AF_INET6, NULL, 0, port, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_tcp_listen(queue, tcb, 1, &local));
+}
+
+/* handshake of a new connection to _tcb */
+static void _connect(_seg_t *syn_ack)
+{
+    gnrc_tcp_tcb_t *tcb = NULL;
+
+    _peer_port++;
+    _peer_nxt = TEST_PEER_ISS;
+    _inject(CTL_SYN, _peer_nxt++, 0, TEST_PEER_WND, NULL, 0);
+    TEST_ASSERT(_capture(syn_ack));
+    TEST_ASSERT_EQUAL_INT(CTL_SYN | CTL_ACK, syn_ack->ctl);
+    TEST_ASSERT_EQUAL_INT(_peer_nxt, syn_ack->ack);
+    _local_nxt = syn_ack->seq + 1;
+
+    _inject(CTL_ACK, _peer_nxt, _local_nxt, TEST_PEER_WND, NULL, 0);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_tcp_accept(&_queue, &tcb, 0));
+    TEST_ASSERT(tcb == &_tcb);
+}
+
+static uint32_t _get_u32(const uint8_t *ptr)
+{
+    return ((uint32_t)ptr[0] << 24) | ((uint32_t)ptr[1] << 16) |
+           ((uint32_t)ptr[2] << 8) | ptr[3];
+}
+
+/* writes a timestamps option, padded to a multiple of four bytes */
+static size_t _ts_opt(uint8_t *opt, uint32_t ts_val, uint32_t ts_ecr)
+{
+    opt[0] = TCP_OPTION_KIND_NOP;
+    opt[1] = TCP_OPTION_KIND_NOP;
+    opt[2] = TCP_OPTION_KIND_TS;
+    opt[3] = TCP_OPTION_LENGTH_TS;
+    for (unsigned i = 0; i < 4; i++) {
+        opt[4 + i] = ts_val >> (24 - 8 * i);
+        opt[8 + i] = ts_ecr >> (24 - 8 * i);
+    }
+    return 12;
+}
+
+/* handshake of a new connection to _tcb that negotiates timestamps */
+static void _connect_ts(uint32_t ts_val, _seg_t *syn_ack)
+{
+    gnrc_tcp_tcb_t *tcb = NULL;
+    const uint8_t *ts;
+    uint8_t opts[12];
+
+    _peer_port++;
+    _peer_nxt = TEST_PEER_ISS;
+    _inject_opts(CTL_SYN, _peer_nxt++, 0, TEST_PEER_WND,
+                 opts, _ts_opt(opts, ts_val, 0), NULL, 0);
+    TEST_ASSERT(_capture(syn_ack));
+    TEST_ASSERT_EQUAL_INT(CTL_SYN | CTL_ACK, syn_ack->ctl);
+    TEST_ASSERT_NOT_NULL((ts = _opt(syn_ack, TCP_OPTION_KIND_TS)));
+    TEST_ASSERT_EQUAL_INT(ts_val, _get_u32(&ts[6]));
+    _local_nxt = syn_ack->seq + 1;
+
+    _inject_opts(CTL_ACK, _peer_nxt, _local_nxt, TEST_PEER_WND,
+                 opts, _ts_opt(opts, ts_val, _get_u32(&ts[2])), NULL, 0);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_tcp_accept(&_queue, &tcb, 0));
+    TEST_ASSERT(tcb == &_tcb);
+}
+
+static void _tear_down(void)
+{
+    /* closing the connection would wait for the FIN of the peer */
+    gnrc_tcp_abort(&_tcb);
+    gnrc_tcp_stop_listen(&_queue);
+    _drain();
+}
+
+static void test_rcvbuf_shrink__full_window(void)
+{
+    _seg_t seg;
+    uint32_t edge;
+    size_t total = 0;
+    ssize_t res;
+
+    _listen(&_queue, &_tcb, TEST_PORT, 0);
+    _connect(&seg);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_TCP_DEFAULT_WINDOW, seg.wnd);
+    edge = _peer_nxt + seg.wnd;
+
+    /* a second connection runs the pool short, the idle connection must not
+     * take back the window it offered */
+    _listen(&_other_queue, &_other_tcb, TEST_OTHER_PORT, 0);
+    TEST_ASSERT(_other_tcb.rcv_buf.size < CONFIG_GNRC_TCP_DEFAULT_WINDOW);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_TCP_DEFAULT_WINDOW, _tcb.rcv_buf.size);
+
+    /* the peer uses up the whole window */
+    while (_peer_nxt != edge) {
+        size_t len = MIN(CONFIG_GNRC_TCP_MSS, edge - _peer_nxt);
+
+        _inject(CTL_ACK | CTL_PSH, _peer_nxt, _local_nxt, TEST_PEER_WND, _data, len);
+        _peer_nxt += len;
+        TEST_ASSERT(_capture(&seg));
+        TEST_ASSERT_EQUAL_INT(CTL_ACK, seg.ctl);
+        TEST_ASSERT_EQUAL_INT(_peer_nxt, seg.ack);
+        TEST_ASSERT_EQUAL_INT(edge, seg.ack + seg.wnd);
+    }
+
+    /* the buffer shrinks once the user read all data, the window reopens */
+    while ((res = gnrc_tcp_recv(&_tcb, _data, sizeof(_data), 0)) > 0) {
+        total += res;
+    }
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_TCP_DEFAULT_WINDOW, total);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_TCP_MSS, _tcb.rcv_buf.size);
+    TEST_ASSERT(_capture(&seg));
+    TEST_ASSERT_EQUAL_INT(_peer_nxt, seg.ack);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_TCP_MSS, seg.wnd);
+
+    gnrc_tcp_stop_listen(&_other_queue);
+}
+
+/* sends num full segments of the connection to _tcb and captures them */
+static void _send_segments(unsigned num, _seg_t *segs)
+{
+    TEST_ASSERT_EQUAL_INT(num * CONFIG_GNRC_TCP_MSS,
+                          gnrc_tcp_send(&_tcb, _data, num * CONFIG_GNRC_TCP_MSS, 0));
+    for (unsigned i = 0; i < num; i++) {
+        TEST_ASSERT(_capture(&segs[i]));
+        TEST_ASSERT_EQUAL_INT(_local_nxt, segs[i].seq);
+        TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_TCP_MSS, segs[i].len);
+        _local_nxt += segs[i].len;
+    }
+    TEST_ASSERT_EQUAL_INT(num, _tcb.rtx_len);
+}
+
+static void test_rtx__cumulative_ack(void)
+{
+    congure_snd_t *cong;
+    _seg_t segs[3];
+
+    _listen(&_queue, &_tcb, TEST_PORT, 0);
+    _connect(&segs[0]);
+    cong = _tcb.congure;
+    TEST_ASSERT_NOT_NULL(cong);
+
+    /* the initial window holds three segments */
+    TEST_ASSERT_EQUAL_INT(3 * CONFIG_GNRC_TCP_MSS, cong->cwnd);
+    _send_segments(3, segs);
+
+    /* one ACK releases all segments it covers, each new ACK grows the
+     * window by a segment during slow start */
+    _inject(CTL_ACK, _peer_nxt, segs[2].seq, TEST_PEER_WND, NULL, 0);
+    TEST_ASSERT_EQUAL_INT(1, _tcb.rtx_len);
+    TEST_ASSERT_EQUAL_INT(4 * CONFIG_GNRC_TCP_MSS, cong->cwnd);
+    _inject(CTL_ACK, _peer_nxt, _local_nxt, TEST_PEER_WND, NULL, 0);
+    TEST_ASSERT_EQUAL_INT(0, _tcb.rtx_len);
+    TEST_ASSERT_EQUAL_INT(5 * CONFIG_GNRC_TCP_MSS, cong->cwnd);
+}
+
+static void test_rtx__fast_retransmit_new_reno(void)
+{
+    congure_reno_snd_t *reno;
+    _seg_t segs[5];
+    _seg_t seg;
+
+    _listen(&_queue, &_tcb, TEST_PORT, 0);
+    _connect(&seg);
+    reno = (congure_reno_snd_t *)_tcb.congure;
+    TEST_ASSERT_NOT_NULL(reno);
+
+    /* open the window for five segments */
+    _send_segments(3, segs);
+    for (unsigned i = 0; i < 3; i++) {
+        _inject(CTL_ACK, _peer_nxt, segs[i].seq + segs[i].len, TEST_PEER_WND, NULL, 0);
+    }
+    TEST_ASSERT_EQUAL_INT(6 * CONFIG_GNRC_TCP_MSS, reno->super.cwnd);
+
+    /* segments 0 and 2 are lost, the peer acknowledges segment 0 again for
+     * segments 1, 3 and 4 */
+    _send_segments(5, segs);
+    for (unsigned i = 0; i < 3; i++) {
+        TEST_ASSERT(!_capture(&seg));
+        _inject(CTL_ACK, _peer_nxt, segs[0].seq, TEST_PEER_WND, NULL, 0);
+    }
+
+    /* the third duplicate ACK resends segment 0 and halves the window */
+    TEST_ASSERT(_capture(&seg));
+    TEST_ASSERT_EQUAL_INT(segs[0].seq, seg.seq);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_TCP_MSS, seg.len);
+    TEST_ASSERT_EQUAL_INT(3 * CONFIG_GNRC_TCP_MSS, reno->ssthresh);
+    TEST_ASSERT_EQUAL_INT(6 * CONFIG_GNRC_TCP_MSS, reno->super.cwnd);
+    TEST_ASSERT(!_capture(&seg));
+
+    /* the partial ACK up to segment 2 resends segment 2 right away */
+    _inject(CTL_ACK, _peer_nxt, segs[2].seq, TEST_PEER_WND, NULL, 0);
+    TEST_ASSERT_EQUAL_INT(3, _tcb.rtx_len);
+    TEST_ASSERT(_capture(&seg));
+    TEST_ASSERT_EQUAL_INT(segs[2].seq, seg.seq);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_TCP_MSS, seg.len);
+    TEST_ASSERT(!_capture(&seg));
+
+    /* the full ACK ends loss recovery in congestion avoidance */
+    _inject(CTL_ACK, _peer_nxt, _local_nxt, TEST_PEER_WND, NULL, 0);
+    TEST_ASSERT_EQUAL_INT(0, _tcb.rtx_len);
+    TEST_ASSERT_EQUAL_INT(3 * CONFIG_GNRC_TCP_MSS, reno->ssthresh);
+    TEST_ASSERT(reno->super.cwnd >= reno->ssthresh);
+}
+
+static void test_rtx__timestamps_copy(void)
+{
+    uint8_t hdr[TCP_HDR_OFFSET_MAX * 4];
+    gnrc_pktsnip_t *pkt, *tcp;
+    const uint8_t *ts;
+    uint8_t opts[12];
+    _seg_t first;
+    _seg_t seg;
+
+    _listen(&_queue, &_tcb, TEST_PORT, 0);
+    _connect_ts(1000, &seg);
+
+    /* keep the first transmission, as a network interface still sending it */
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_TCP_MSS,
+                          gnrc_tcp_send(&_tcb, _data, CONFIG_GNRC_TCP_MSS, 0));
+    TEST_ASSERT_NOT_NULL((pkt = _capture_pkt()));
+    _parse(pkt, &first);
+    tcp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
+    memcpy(hdr, tcp->data, tcp->size);
+    ztimer_sleep(ZTIMER_MSEC, 10);
+
+    /* the fast retransmit carries new timestamps ... */
+    for (unsigned i = 1; i <= 3; i++) {
+        _inject_opts(CTL_ACK, _peer_nxt, first.seq, TEST_PEER_WND,
+                     opts, _ts_opt(opts, 1000 + i, 0), NULL, 0);
+    }
+    TEST_ASSERT(_capture(&seg));
+    TEST_ASSERT_EQUAL_INT(first.seq, seg.seq);
+    TEST_ASSERT_NOT_NULL((ts = _opt(&seg, TCP_OPTION_KIND_TS)));
+    TEST_ASSERT(_get_u32(&ts[2]) > _get_u32(&_opt(&first, TCP_OPTION_KIND_TS)[2]));
+    TEST_ASSERT_EQUAL_INT(1003, _get_u32(&ts[6]));
+
+    /* ... in a copy of the headers */
+    TEST_ASSERT_EQUAL_INT(0, memcmp(hdr, tcp->data, tcp->size));
+    gnrc_pktbuf_release(pkt);
+}
+
+static void test_ts__paws(void)
+{
+    uint8_t opts[12];
+    uint8_t buf[8];
+    const uint8_t *ts;
+    _seg_t seg;
+
+    _listen(&_queue, &_tcb, TEST_PORT, 0);
+    _connect_ts(1000, &seg);
+
+    _inject_opts(CTL_ACK | CTL_PSH, _peer_nxt, _local_nxt, TEST_PEER_WND,
+                 opts, _ts_opt(opts, 1001, 0), _data, sizeof(buf));
+    _peer_nxt += sizeof(buf);
+    TEST_ASSERT(_capture(&seg));
+    TEST_ASSERT_EQUAL_INT(_peer_nxt, seg.ack);
+    TEST_ASSERT_NOT_NULL((ts = _opt(&seg, TCP_OPTION_KIND_TS)));
+    TEST_ASSERT_EQUAL_INT(1001, _get_u32(&ts[6]));
+    TEST_ASSERT_EQUAL_INT(sizeof(buf), gnrc_tcp_recv(&_tcb, buf, sizeof(buf), 0));
+
+    /* an older timestamp marks a segment of an earlier sequence number wrap
+     * around, it is answered with a pure ACK and dropped */
+    _inject_opts(CTL_ACK | CTL_PSH, _peer_nxt, _local_nxt, TEST_PEER_WND,
+                 opts, _ts_opt(opts, 900, 0), _data, sizeof(buf));
+    TEST_ASSERT(_capture(&seg));
+    TEST_ASSERT_EQUAL_INT(CTL_ACK, seg.ctl);
+    TEST_ASSERT_EQUAL_INT(0, seg.len);
+    TEST_ASSERT_EQUAL_INT(_peer_nxt, seg.ack);
+    TEST_ASSERT_NOT_NULL((ts = _opt(&seg, TCP_OPTION_KIND_TS)));
+    TEST_ASSERT_EQUAL_INT(1001, _get_u32(&ts[6]));
+    TEST_ASSERT_EQUAL_INT(-EAGAIN, gnrc_tcp_recv(&_tcb, buf, sizeof(buf), 0));
+}
+
+static void test_backlog__cookie_without_listener(void)
+{
+    _seg_t seg;
+
+    _listen(&_queue, &_tcb, TEST_PORT, 0);
+    _connect(&seg);
+
+    /* the only TCB is busy, the backlog fills up */
+    for (unsigned i = 0; i < CONFIG_GNRC_TCP_BACKLOG_SIZE; i++) {
+        _peer_port++;
+        _inject(CTL_SYN, TEST_PEER_ISS, 0, TEST_PEER_WND, NULL, 0);
+        TEST_ASSERT(_capture(&seg));
+        TEST_ASSERT_EQUAL_INT(CTL_SYN | CTL_ACK, seg.ctl);
+    }
+
+    /* the next connection request is answered with a SYN cookie, whose
+     * connection must be reset as no TCB can take it */
+    _peer_port++;
+    _inject(CTL_SYN, TEST_PEER_ISS, 0, TEST_PEER_WND, NULL, 0);
+    TEST_ASSERT(_capture(&seg));
+    TEST_ASSERT_EQUAL_INT(CTL_SYN | CTL_ACK, seg.ctl);
+    _inject(CTL_ACK, TEST_PEER_ISS + 1, seg.seq + 1, TEST_PEER_WND, NULL, 0);
+    TEST_ASSERT(_capture(&seg));
+    TEST_ASSERT(seg.ctl & CTL_RST);
+}
+
+static void test_backlog__syn_ack_wnd_scale(void)
+{
+    static const uint8_t opts[] = {
+        TCP_OPTION_KIND_NOP, TCP_OPTION_KIND_WS, TCP_OPTION_LENGTH_WS, 7
+    };
+    gnrc_tcp_tcb_t *tcb = NULL;
+    uint16_t port;
+    _seg_t seg;
+    uint32_t iss;
+
+    /* a buffer limit beyond 64 KiB needs a shift count of one */
+    _listen(&_queue, &_tcb, TEST_PORT, CONFIG_GNRC_TCP_RCV_BUF_POOL_SIZE);
+
+    port = ++_peer_port;
+    _inject_opts(CTL_SYN, TEST_PEER_ISS, 0, TEST_PEER_WND, opts, sizeof(opts), NULL, 0);
+    TEST_ASSERT(_capture(&seg));
+    TEST_ASSERT_NOT_NULL(_opt(&seg, TCP_OPTION_KIND_WS));
+    TEST_ASSERT_EQUAL_INT(1, _opt(&seg, TCP_OPTION_KIND_WS)[2]);
+    iss = seg.seq;
+
+    /* another connection request without window scaling in between */
+    _peer_port++;
+    _inject(CTL_SYN, TEST_PEER_ISS, 0, TEST_PEER_WND, NULL, 0);
+    TEST_ASSERT(_capture(&seg));
+    TEST_ASSERT_NULL(_opt(&seg, TCP_OPTION_KIND_WS));
+
+    /* the SYN+ACK answering a retransmitted SYN has the same shift count */
+    _peer_port = port;
+    _inject_opts(CTL_SYN, TEST_PEER_ISS, 0, TEST_PEER_WND, opts, sizeof(opts), NULL, 0);
+    TEST_ASSERT(_capture(&seg));
+    TEST_ASSERT_EQUAL_INT(iss, seg.seq);
+    TEST_ASSERT_NOT_NULL(_opt(&seg, TCP_OPTION_KIND_WS));
+    TEST_ASSERT_EQUAL_INT(1, _opt(&seg, TCP_OPTION_KIND_WS)[2]);
+
+    /* and the connection uses it */
+    _inject(CTL_ACK, TEST_PEER_ISS + 1, iss + 1, TEST_PEER_WND, NULL, 0);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_tcp_accept(&_queue, &tcb, 0));
+    TEST_ASSERT(tcb == &_tcb);
+    TEST_ASSERT_EQUAL_INT(1, _tcb.rcv_wnd_scale);
+}
+
+static void test_congure__more_connections_than_rcv_buffers(void)
+{
+    static gnrc_tcp_tcb_queue_t queues[CONFIG_GNRC_TCP_RCV_BUFFERS];
+    static gnrc_tcp_tcb_t tcbs[CONFIG_GNRC_TCP_RCV_BUFFERS];
+    _seg_t seg;
+
+    /* small receive buffers leave room in the pool for one more connection
+     * than there are default sized receive buffers */
+    for (unsigned i = 0; i < ARRAY_SIZE(tcbs); i++) {
+        _listen(&queues[i], &tcbs[i], TEST_OTHER_PORT + i, CONFIG_GNRC_TCP_MSS);
+        TEST_ASSERT_NOT_NULL(tcbs[i].congure);
+    }
+    _listen(&_queue, &_tcb, TEST_PORT, CONFIG_GNRC_TCP_MSS);
+    TEST_ASSERT_NOT_NULL(_tcb.congure);
+    _connect(&seg);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_TCP_MSS, seg.wnd);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(tcbs); i++) {
+        gnrc_tcp_stop_listen(&queues[i]);
+    }
+}
+
+static Test *tests_gnrc_tcp_segments(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_rcvbuf_shrink__full_window),
+        new_TestFixture(test_rtx__cumulative_ack),
+        new_TestFixture(test_rtx__fast_retransmit_new_reno),
+        new_TestFixture(test_rtx__timestamps_copy),
+        new_TestFixture(test_ts__paws),
+        new_TestFixture(test_backlog__cookie_without_listener),
+        new_TestFixture(test_backlog__syn_ack_wnd_scale),
+        new_TestFixture(test_congure__more_connections_than_rcv_buffers),
+    };
+
+    EMB_UNIT_TESTCALLER(gnrc_tcp_segments_tests, NULL, _tear_down, fixtures);
+
+    return (Test *)&gnrc_tcp_segments_tests;
+}
+
+int main(void)
+{
+    /* the segments of GNRC TCP are sent to this thread */
+    msg_init_queue(_msg_queue, ARRAY_SIZE(_msg_queue));
+    _ipv6.target.pid = thread_getpid();
+    gnrc_netreg_register(GNRC_NETTYPE_IPV6, &_ipv6);
+
+    TESTS_START();
+    TESTS_RUN(tests_gnrc_tcp_segments());
+    TESTS_END();
+    return 0;
+}
@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for pipelined block-wise GET of nanoCoAP
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "bitfield.h"
+#include "fs/constfs.h"
+#include "net/ipv6/addr.h"
+#include "net/nanocoap/fileserver.h"
+#include "net/nanocoap_sock.h"
+#include "test_utils/expect.h"
+#include "vfs.h"
+#include "ztimer.h"
+
+#define BLOB_SIZE       (2000U)
+#define BLOCKSIZE       COAP_BLOCKSIZE_64
+#define BLOCKS_MAX      ((BLOB_SIZE >> (BLOCKSIZE + 4)) + 1)
+#define DROP_NTH        (7U)
+
+typedef struct {
+    uint8_t *buf;
+    size_t len;
+    unsigned next_offset;
+    unsigned out_of_order;
+    BITFIELD(received, BLOCKS_MAX);
+} _dl_ctx_t;
+
+static uint8_t _blob[BLOB_SIZE];
+static uint8_t _dl_buf[BLOB_SIZE];
+
+static constfs_file_t _constfs_files[] = {
+    {
+        .path = "/blob.bin",
+        .size = BLOB_SIZE,
+        .data = _blob,
+    },
+    {
+        /* ends exactly on a block boundary */
+        .path = "/even.bin",
+        .size = 8 * 64,
+        .data = _blob,
+    },
+    {
+        .path = "/tiny.bin",
+        .size = 10,
+        .data = _blob,
+    },
+    {
+        .path = "/empty.bin",
+        .size = 0,
+        .data = _blob,
+    },
+};
+
+static constfs_t _constfs_desc = {
+    .nfiles = ARRAY_SIZE(_constfs_files),
+    .files = _constfs_files,
+};
+
+static vfs_mount_t _const_mount = {
+    .fs = &constfs_file_system,
+    .mount_point = "/const",
+    .private_data = &_constfs_desc,
+};
+
+static ssize_t _lossy_fileserver(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                                 coap_request_ctx_t *ctx)
+{
+    static unsigned count;
+
+    if ((++count % DROP_NTH) == 0) {
+        /* no response */
+        return 0;
+    }
+    return nanocoap_fileserver_handler(pdu, buf, len, ctx);
+}
+
+NANOCOAP_RESOURCE(const) {
+    .path = "/const",
+    .methods = COAP_GET | COAP_MATCH_SUBTREE,
+    .handler = _lossy_fileserver,
+    .context = "/const",
+};
+
+static int _dl_cb(void *arg, size_t offset, uint8_t *buf, size_t len, int more)
+{
+    _dl_ctx_t *ctx = arg;
+    unsigned blknum = offset >> (BLOCKSIZE + 4);
+
+    expect(blknum < BLOCKS_MAX);
+    /* every block must be delivered exactly once */
+    expect(!bf_isset(ctx->received, blknum));
+    bf_set(ctx->received, blknum);
+    if (offset != ctx->next_offset) {
+        ctx->out_of_order++;
+    }
+    ctx->next_offset = offset + len;
+    expect(offset + len <= sizeof(_dl_buf));
+    memcpy(ctx->buf + offset, buf, len);
+    if (!more) {
+        ctx->len = offset + len;
+    }
+    return 0;
+}
+
+static void _get(nanocoap_sock_t *sock, const char *path, size_t size,
+                 unsigned window)
+{
+    _dl_ctx_t ctx = { .buf = _dl_buf };
+
+    memset(_dl_buf, 0, sizeof(_dl_buf));
+    uint32_t start = ztimer_now(ZTIMER_MSEC);
+    int res = nanocoap_sock_get_blockwise_pipelined(sock, path, BLOCKSIZE,
+                                                    window, _dl_cb, &ctx);
+    uint32_t duration = ztimer_now(ZTIMER_MSEC) - start;
+
+    if (res < 0) {
+        printf("%s, window %u: error %d\n", path, window, res);
+    }
+    expect(res == 0);
+    expect(ctx.len == size);
+    expect(memcmp(_dl_buf, _blob, size) == 0);
+    if (size == BLOB_SIZE) {
+        printf("window %u: %u bytes in %" PRIu32 " ms (%u out of order)\n",
+               window, (unsigned)ctx.len, duration, ctx.out_of_order);
+    }
+}
+
+int main(void)
+{
+    static const unsigned windows[] = { 1, 2, 4, 8 };
+    static sock_udp_ep_t local = { .family = AF_INET6, .port = COAP_PORT };
+    sock_udp_ep_t remote = {
+        .family = AF_INET6,
+        .port = COAP_PORT,
+    };
+    nanocoap_sock_t sock;
+
+    memcpy(remote.addr.ipv6, &ipv6_addr_loopback, sizeof(remote.addr.ipv6));
+
+    for (unsigned i = 0; i < sizeof(_blob); i++) {
+        _blob[i] = i * 7;
+    }
+    expect(vfs_mount(&_const_mount) == 0);
+    expect(nanocoap_server_start(&local) > 0);
+    expect(nanocoap_sock_connect(&sock, NULL, &remote) == 0);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(windows); i++) {
+        _get(&sock, "/const/blob.bin", BLOB_SIZE, windows[i]);
+        _get(&sock, "/const/even.bin", 8 * 64, windows[i]);
+        _get(&sock, "/const/tiny.bin", 10, windows[i]);
+        _get(&sock, "/const/empty.bin", 0, windows[i]);
+    }
+    expect(nanocoap_sock_get_blockwise_pipelined(&sock, "/const/missing.bin",
+                                                 BLOCKSIZE, 4, _dl_cb,
+                                                 &(_dl_ctx_t){ 0 }) < 0);
+    nanocoap_sock_close(&sock);
+
+    puts("SUCCESS");
+    return 0;
+}
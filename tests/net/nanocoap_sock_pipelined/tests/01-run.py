@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for window in (1, 2, 4, 8):
+        child.expect(r"window {}: 2000 bytes in \d+ ms".format(window),
+                     timeout=30)
+    child.expect_exact("SUCCESS", timeout=30)
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
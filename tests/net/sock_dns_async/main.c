@@ -0,0 +1,351 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the asynchronous DNS resolver
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <netdb.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <arpa/inet.h>
+
+#include "byteorder.h"
+#include "net/dns.h"
+#include "net/dns/msg.h"
+#include "net/ipv4/addr.h"
+#include "net/ipv6/addr.h"
+#include "net/sock/dns_async.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "ztimer.h"
+
+#define DNS_SERVER_PORT     (5353U)
+/* the server collects queries for this long before it answers them */
+#define DNS_SERVER_DELAY_MS (20U)
+#define DNS_TTL             (60U)
+
+#define FLAG_DONE           (1U << 0)
+#define REQS_NUMOF          (4U)
+
+static const ipv6_addr_t _addr6 = {{ 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+                                     0, 0, 0, 0, 0, 0, 0, 1 }};
+static const ipv4_addr_t _addr4 = {{ 192, 0, 2, 1 }};
+
+static char _server_stack[THREAD_STACKSIZE_DEFAULT];
+static char _client_stack[THREAD_STACKSIZE_DEFAULT];
+static thread_t *_main;
+
+/* queries received by the server */
+static unsigned _queries_a;
+static unsigned _queries_aaaa;
+static unsigned _batch_max;
+
+typedef struct {
+    sock_udp_ep_t remote;
+    size_t len;
+    uint8_t buf[CONFIG_DNS_MSG_LEN];
+} _query_t;
+
+/* decodes the name of the question and returns the length of the question */
+static size_t _question(const uint8_t *buf, size_t len, char *name, uint16_t *type)
+{
+    size_t pos = sizeof(dns_hdr_t);
+
+    name[0] = '\0';
+    while ((pos < len) && buf[pos]) {
+        if (name[0]) {
+            strcat(name, ".");
+        }
+        strncat(name, (char *)&buf[pos + 1], buf[pos]);
+        pos += buf[pos] + 1;
+    }
+    pos++;
+    *type = byteorder_bebuftohs(&buf[pos]);
+    return pos + 4;
+}
+
+static size_t _reply(_query_t *q)
+{
+    dns_hdr_t *hdr = (dns_hdr_t *)q->buf;
+    char name[CONFIG_DNS_MSG_LEN];
+    uint16_t type;
+    size_t len = _question(q->buf, q->len, name, &type);
+    uint8_t *pos = &q->buf[len];
+
+    if (type == DNS_TYPE_A) {
+        _queries_a++;
+    }
+    else {
+        _queries_aaaa++;
+    }
+    if (!strcmp(name, "silent.example.org")) {
+        return 0;
+    }
+    if (!strcmp(name, "nx.example.org")) {
+        hdr->flags = htons(0x8180 | DNS_RCODE_NAME_ERROR);
+        return len;
+    }
+
+    hdr->flags = htons(0x8180);
+    hdr->ancount = htons(1);
+    byteorder_htobebufs(pos, 0xc000 | sizeof(dns_hdr_t));
+    byteorder_htobebufs(pos + 2, type);
+    byteorder_htobebufs(pos + 4, DNS_CLASS_IN);
+    byteorder_htobebufl(pos + 6, DNS_TTL);
+    if (type == DNS_TYPE_A) {
+        byteorder_htobebufs(pos + 10, sizeof(_addr4));
+        memcpy(pos + 12, &_addr4, sizeof(_addr4));
+        return len + 12 + sizeof(_addr4);
+    }
+    byteorder_htobebufs(pos + 10, sizeof(_addr6));
+    memcpy(pos + 12, &_addr6, sizeof(_addr6));
+    return len + 12 + sizeof(_addr6);
+}
+
+/* answers the queries received within DNS_SERVER_DELAY_MS at once */
+static void *_server(void *arg)
+{
+    sock_udp_ep_t local = { .family = AF_INET6, .port = DNS_SERVER_PORT };
+    static _query_t queries[2 * REQS_NUMOF];
+    sock_udp_t sock;
+
+    (void)arg;
+    expect(sock_udp_create(&sock, &local, NULL, 0) == 0);
+    while (1) {
+        uint32_t timeout = SOCK_NO_TIMEOUT;
+        unsigned numof = 0;
+        uint32_t due = 0;
+
+        while (numof < ARRAY_SIZE(queries)) {
+            _query_t *q = &queries[numof];
+            ssize_t res = sock_udp_recv(&sock, q->buf, sizeof(q->buf), timeout,
+                                        &q->remote);
+            if (res == -ETIMEDOUT) {
+                break;
+            }
+            expect(res > (ssize_t)sizeof(dns_hdr_t));
+            q->len = res;
+            if (numof++ == 0) {
+                due = ztimer_now(ZTIMER_MSEC) + DNS_SERVER_DELAY_MS;
+            }
+            int32_t left = due - ztimer_now(ZTIMER_MSEC);
+            if (left <= 0) {
+                break;
+            }
+            timeout = left * US_PER_MS;
+        }
+        _batch_max = (numof > _batch_max) ? numof : _batch_max;
+        for (unsigned i = 0; i < numof; i++) {
+            size_t len = _reply(&queries[i]);
+            if (len) {
+                sock_udp_send(&sock, queries[i].buf, len, &queries[i].remote);
+            }
+        }
+    }
+    return NULL;
+}
+
+typedef struct {
+    sock_dns_async_req_t req;
+    int res;
+    uint8_t addr[sizeof(ipv6_addr_t)];
+} _req_t;
+
+static _req_t _reqs[REQS_NUMOF];
+static volatile unsigned _done;
+
+static void _resolved(void *arg, int res, const void *addr)
+{
+    _req_t *req = arg;
+
+    req->res = res;
+    if (res > 0) {
+        memcpy(req->addr, addr, res);
+    }
+    _done++;
+    thread_flags_set(_main, FLAG_DONE);
+}
+
+static void _query(unsigned numof, const char *name, int family)
+{
+    _done = 0;
+    for (unsigned i = 0; i < numof; i++) {
+        memset(&_reqs[i], 0, sizeof(_reqs[i]));
+        expect(sock_dns_query_async(&_reqs[i].req, name, family, _resolved,
+                                    &_reqs[i]) == 0);
+    }
+    while (_done < numof) {
+        thread_flags_wait_any(FLAG_DONE);
+    }
+}
+
+static void _test_coalescing(void)
+{
+    unsigned queries = _queries_aaaa;
+
+    _query(REQS_NUMOF, "example.org", AF_INET6);
+    expect(_queries_aaaa == queries + 1);
+    for (unsigned i = 0; i < REQS_NUMOF; i++) {
+        expect(_reqs[i].res == sizeof(ipv6_addr_t));
+        expect(!memcmp(_reqs[i].addr, &_addr6, sizeof(_addr6)));
+    }
+    printf("%u requests, %u query\n", REQS_NUMOF, _queries_aaaa - queries);
+}
+
+static void _test_cache(void)
+{
+    unsigned queries = _queries_aaaa;
+
+    _done = 0;
+    expect(sock_dns_query_async(&_reqs[0].req, "example.org", AF_INET6,
+                                _resolved, &_reqs[0]) == 0);
+    /* the callback was called right away */
+    expect(_done == 1);
+    expect(_reqs[0].res == sizeof(ipv6_addr_t));
+    expect(_queries_aaaa == queries);
+    puts("cached: no query");
+}
+
+static void _test_pipelining(void)
+{
+    unsigned queries = _queries_a + _queries_aaaa;
+
+    _batch_max = 0;
+    _query(1, "dual.example.org", AF_UNSPEC);
+    expect(_reqs[0].res == sizeof(ipv6_addr_t));
+    expect(!memcmp(_reqs[0].addr, &_addr6, sizeof(_addr6)));
+    expect(_queries_a + _queries_aaaa == queries + 2);
+    /* the A and the AAAA query were in flight at the same time */
+    expect(_batch_max == 2);
+
+    /* the A record was cached on the way */
+    _query(1, "dual.example.org", AF_INET);
+    expect(_reqs[0].res == sizeof(ipv4_addr_t));
+    expect(!memcmp(_reqs[0].addr, &_addr4, sizeof(_addr4)));
+    expect(_queries_a + _queries_aaaa == queries + 2);
+    puts("AF_UNSPEC: A and AAAA in parallel");
+}
+
+static void _test_errors(void)
+{
+    unsigned queries = _queries_aaaa;
+
+    _query(1, "nx.example.org", AF_INET6);
+    expect(_reqs[0].res == -ENXIO);
+    puts("NXDOMAIN: -ENXIO");
+
+    _query(1, "silent.example.org", AF_INET6);
+    expect(_reqs[0].res == -ETIMEDOUT);
+    expect(_queries_aaaa == queries + 1 + SOCK_DNS_RETRIES);
+    puts("no reply: -ETIMEDOUT");
+}
+
+static void _test_cancel(void)
+{
+    sock_dns_async_req_t req;
+
+    _done = 0;
+    expect(sock_dns_query_async(&req, "cancel.example.org", AF_INET6,
+                                _resolved, &_reqs[0]) == 0);
+    sock_dns_async_cancel(&req);
+    ztimer_sleep(ZTIMER_MSEC, 2 * DNS_SERVER_DELAY_MS);
+    expect(_done == 0);
+    puts("cancelled: no callback");
+}
+
+static const struct addrinfo _hints = {
+    .ai_family = AF_UNSPEC,
+    .ai_socktype = SOCK_DGRAM,
+};
+
+static void _expect_addrinfo(struct addrinfo *ai)
+{
+    /* the IPv6 address comes first */
+    expect(ai && (ai->ai_family == AF_INET6) && (ai->ai_socktype == SOCK_DGRAM));
+    struct sockaddr_in6 *in6 = (struct sockaddr_in6 *)ai->ai_addr;
+    expect(ntohs(in6->sin6_port) == 5683);
+    expect(!memcmp(&in6->sin6_addr, &_addr6, sizeof(_addr6)));
+
+    ai = ai->ai_next;
+    expect(ai && (ai->ai_family == AF_INET));
+    struct sockaddr_in *in = (struct sockaddr_in *)ai->ai_addr;
+    expect(ntohs(in->sin_port) == 5683);
+    expect(!memcmp(&in->sin_addr, &_addr4, sizeof(_addr4)));
+    expect(ai->ai_next == NULL);
+}
+
+static void *_client(void *arg)
+{
+    struct addrinfo **ai = arg;
+
+    expect(getaddrinfo("posix.example.org", "5683", &_hints, ai) == 0);
+    thread_flags_set(_main, FLAG_DONE);
+    return NULL;
+}
+
+static void _test_getaddrinfo(void)
+{
+    unsigned queries = _queries_a + _queries_aaaa;
+    struct addrinfo *ai, *client_ai = NULL;
+
+    /* the client thread blocks in getaddrinfo() before this thread does */
+    thread_create(_client_stack, sizeof(_client_stack), THREAD_PRIORITY_MAIN - 1,
+                  0, _client, &client_ai, "client");
+    expect(getaddrinfo("posix.example.org", "5683", &_hints, &ai) == 0);
+    while (client_ai == NULL) {
+        thread_flags_wait_any(FLAG_DONE);
+    }
+    /* both share the same two queries */
+    expect(_queries_a + _queries_aaaa == queries + 2);
+    _expect_addrinfo(ai);
+    _expect_addrinfo(client_ai);
+    freeaddrinfo(ai);
+    freeaddrinfo(client_ai);
+    puts("getaddrinfo: 2 callers, 2 queries");
+
+    expect(getaddrinfo("::1", NULL, NULL, &ai) == 0);
+    expect((ai->ai_family == AF_INET6) && (ai->ai_next == NULL));
+    expect(_queries_a + _queries_aaaa == queries + 2);
+    freeaddrinfo(ai);
+    puts("getaddrinfo: numeric host");
+
+    expect(getaddrinfo("nx.example.org", NULL, &_hints, &ai) == EAI_NONAME);
+    printf("getaddrinfo: %s\n", gai_strerror(EAI_NONAME));
+}
+
+int main(void)
+{
+    _main = thread_get_active();
+    thread_create(_server_stack, sizeof(_server_stack), THREAD_PRIORITY_MAIN - 2,
+                  0, _server, NULL, "dns server");
+
+    sock_dns_server.family = AF_INET6;
+    sock_dns_server.port = DNS_SERVER_PORT;
+    memcpy(sock_dns_server.addr.ipv6, &ipv6_addr_loopback,
+           sizeof(sock_dns_server.addr.ipv6));
+
+    _test_coalescing();
+    _test_cache();
+    _test_pipelining();
+    _test_errors();
+    _test_cancel();
+    _test_getaddrinfo();
+
+    puts("SUCCESS");
+    return 0;
+}
@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("4 requests, 1 query")
+    child.expect_exact("cached: no query")
+    child.expect_exact("AF_UNSPEC: A and AAAA in parallel")
+    child.expect_exact("NXDOMAIN: -ENXIO")
+    child.expect_exact("no reply: -ETIMEDOUT")
+    child.expect_exact("cancelled: no callback")
+    child.expect_exact("getaddrinfo: 2 callers, 2 queries")
+    child.expect_exact("getaddrinfo: numeric host")
+    child.expect_exact("getaddrinfo: Name or service not known")
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -6,6 +6,7 @@
  * directory for more details.
  */
 
+#include <errno.h>
 #include <stdint.h>
 #include <string.h>
 #include "net/af.h"
@@ -51,11 +52,120 @@ static void test_dns_cache_add_ttl0(void)
     TEST_ASSERT_EQUAL_INT(0, dns_cache_query("example.com", &addr_out, AF_INET6));
 }
 
+static void test_dns_cache_negative(void)
+{
+    ipv6_addr_t addr_in = IPV6_ADDR_ALL_NODES_IF_LOCAL;
+    ipv6_addr_t addr_out;
+    dns_cache_stats_t before, after;
+
+    dns_cache_stats_get(&before);
+
+    /* the name does not exist */
+    dns_cache_add_negative("nx.example.com", AF_UNSPEC, 1);
+    TEST_ASSERT_EQUAL_INT(-ENXIO, dns_cache_query("nx.example.com", &addr_out, AF_INET6));
+    TEST_ASSERT_EQUAL_INT(-ENXIO, dns_cache_query("nx.example.com", &addr_out, AF_INET));
+    TEST_ASSERT_EQUAL_INT(-ENXIO, dns_cache_query("nx.example.com", &addr_out, AF_UNSPEC));
+
+    /* the name has no IPv6 address, but may have an IPv4 address */
+    dns_cache_add_negative("v4.example.com", AF_INET6, 1);
+    TEST_ASSERT_EQUAL_INT(-ENXIO, dns_cache_query("v4.example.com", &addr_out, AF_INET6));
+    TEST_ASSERT_EQUAL_INT(0, dns_cache_query("v4.example.com", &addr_out, AF_INET));
+    TEST_ASSERT_EQUAL_INT(0, dns_cache_query("v4.example.com", &addr_out, AF_UNSPEC));
+
+    /* an address replaces the negative entry */
+    dns_cache_add("v4.example.com", &addr_in, sizeof(addr_in), 1);
+    TEST_ASSERT_EQUAL_INT(sizeof(addr_out), dns_cache_query("v4.example.com", &addr_out, AF_INET6));
+
+    dns_cache_stats_get(&after);
+    TEST_ASSERT_EQUAL_INT(4, after.negative_hits - before.negative_hits);
+    TEST_ASSERT_EQUAL_INT(2, after.misses - before.misses);
+    TEST_ASSERT_EQUAL_INT(1, after.hits - before.hits);
+
+    dns_cache_add_negative("nx.example.com", AF_UNSPEC, 0);
+    dns_cache_add("v4.example.com", &addr_in, sizeof(addr_in), 0);
+    TEST_ASSERT_EQUAL_INT(0, dns_cache_query("nx.example.com", &addr_out, AF_INET6));
+    TEST_ASSERT_EQUAL_INT(0, dns_cache_used_count());
+}
+
+static void test_dns_cache_full(void)
+{
+    ipv6_addr_t addr_in = IPV6_ADDR_ALL_NODES_IF_LOCAL;
+    ipv6_addr_t addr_out;
+    dns_cache_stats_t before, after;
+    char name[] = "host0.example.com";
+
+    dns_cache_stats_get(&before);
+
+    /* the first entries to expire are evicted */
+    for (unsigned i = 0; i < CONFIG_DNS_CACHE_SIZE + 2; i++) {
+        name[4] = '0' + i;
+        addr_in.u8[15] = i;
+        dns_cache_add(name, &addr_in, sizeof(addr_in), 10 + i);
+    }
+    TEST_ASSERT_EQUAL_INT(CONFIG_DNS_CACHE_SIZE, dns_cache_used_count());
+    for (unsigned i = 0; i < CONFIG_DNS_CACHE_SIZE + 2; i++) {
+        name[4] = '0' + i;
+        if (i < 2) {
+            TEST_ASSERT_EQUAL_INT(0, dns_cache_query(name, &addr_out, AF_INET6));
+        }
+        else {
+            TEST_ASSERT_EQUAL_INT(sizeof(addr_out), dns_cache_query(name, &addr_out, AF_INET6));
+            TEST_ASSERT_EQUAL_INT(i, addr_out.u8[15]);
+        }
+    }
+    /* but not for an entry that expires first */
+    dns_cache_add("short.example.com", &addr_in, sizeof(addr_in), 1);
+    TEST_ASSERT_EQUAL_INT(0, dns_cache_query("short.example.com", &addr_out, AF_INET6));
+
+    dns_cache_stats_get(&after);
+    TEST_ASSERT_EQUAL_INT(2, after.evictions - before.evictions);
+
+    /* removing entries keeps the others reachable */
+    for (unsigned i = 2; i < CONFIG_DNS_CACHE_SIZE + 2; i++) {
+        name[4] = '0' + i;
+        dns_cache_add(name, &addr_in, sizeof(addr_in), 0);
+        for (unsigned j = i + 1; j < CONFIG_DNS_CACHE_SIZE + 2; j++) {
+            name[4] = '0' + j;
+            TEST_ASSERT_EQUAL_INT(sizeof(addr_out), dns_cache_query(name, &addr_out, AF_INET6));
+            TEST_ASSERT_EQUAL_INT(j, addr_out.u8[15]);
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(0, dns_cache_used_count());
+}
+
+static void test_dns_cache_stale(void)
+{
+    ipv6_addr_t addr_in = IPV6_ADDR_ALL_NODES_IF_LOCAL;
+    ipv6_addr_t addr_out;
+
+    dns_cache_add("example.com", &addr_in, sizeof(addr_in), 1);
+    dns_cache_add_negative("nx.example.com", AF_UNSPEC, 1);
+    TEST_ASSERT_EQUAL_INT(sizeof(addr_out), dns_cache_query_stale("example.com", &addr_out, AF_INET6));
+
+    ztimer_sleep(ZTIMER_USEC, 2000000);
+    TEST_ASSERT_EQUAL_INT(0, dns_cache_query("example.com", &addr_out, AF_INET6));
+    TEST_ASSERT_EQUAL_INT(sizeof(addr_out), dns_cache_query_stale("example.com", &addr_out, AF_INET6));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&addr_in, &addr_out, sizeof(addr_in)));
+    /* negative answers are not served stale */
+    TEST_ASSERT_EQUAL_INT(0, dns_cache_query("nx.example.com", &addr_out, AF_INET6));
+    TEST_ASSERT_EQUAL_INT(0, dns_cache_query_stale("nx.example.com", &addr_out, AF_INET6));
+
+    /* the expired negative entry is removed, the stale one is kept */
+    dns_cache_add("other.example.com", &addr_in, sizeof(addr_in), 1);
+    TEST_ASSERT_EQUAL_INT(2, dns_cache_used_count());
+    dns_cache_add("example.com", &addr_in, sizeof(addr_in), 0);
+    dns_cache_add("other.example.com", &addr_in, sizeof(addr_in), 0);
+    TEST_ASSERT_EQUAL_INT(0, dns_cache_used_count());
+}
+
 Test *tests_dns_cache_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_dns_cache_add),
         new_TestFixture(test_dns_cache_add_ttl0),
+        new_TestFixture(test_dns_cache_negative),
+        new_TestFixture(test_dns_cache_full),
+        new_TestFixture(test_dns_cache_stale),
     };
 
     EMB_UNIT_TESTCALLER(dns_cache_tests, NULL, NULL, fixtures);
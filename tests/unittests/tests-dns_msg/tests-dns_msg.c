@@ -6,6 +6,7 @@
  * directory for more details.
  */
 
+#include <errno.h>
 #include <stdint.h>
 #include <string.h>
 #include "net/af.h"
@@ -140,12 +141,82 @@ static void test_dns_msg_valid_dns64_w_long_cnames(void)
     TEST_ASSERT_EQUAL_INT(0, memcmp(addr, addr_out, sizeof(addr)));
 }
 
+static void test_dns_msg_nxdomain(void)
+{
+    uint8_t dns_msg[] = {
+        /* in scapy notation:
+         * <DNS  id=0 qr=1 opcode=QUERY aa=0 tc=0 rd=1 ra=1 z=0 ad=0 cd=0 rcode=name-error
+         *       qdcount=1 ancount=0 nscount=1 arcount=0
+         *       qd=<DNSQR  qname='nx.example.org.' qtype=AAAA qclass=IN |>
+         *       an=None
+         *       ns=<DNSRRSOA  rrname='\\xc0\x0f' type=SOA rclass=IN ttl=3600
+         *                     mname='ns\\xc0\x0f' rname='hostmaster\\xc0\x0f'
+         *                     serial=2026101801 refresh=7200 retry=3600
+         *                     expire=1209600 minimum=300 |>
+         *       ar=None |> */
+        0x00, 0x00, 0x81, 0x83, 0x00, 0x01, 0x00, 0x00,
+        0x00, 0x01, 0x00, 0x00, 0x02, 0x6e, 0x78, 0x07,
+        0x65, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x03,
+        0x6f, 0x72, 0x67, 0x00, 0x00, 0x1c, 0x00, 0x01,
+        0xc0, 0x0f, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00,
+        0x0e, 0x10, 0x00, 0x26, 0x02, 0x6e, 0x73, 0xc0,
+        0x0f, 0x0a, 0x68, 0x6f, 0x73, 0x74, 0x6d, 0x61,
+        0x73, 0x74, 0x65, 0x72, 0xc0, 0x0f, 0x78, 0xc3,
+        0xdc, 0x29, 0x00, 0x00, 0x1c, 0x20, 0x00, 0x00,
+        0x0e, 0x10, 0x00, 0x12, 0x75, 0x00, 0x00, 0x00,
+        0x01, 0x2c,
+    };
+    /* the lesser of the SOA TTL and its MINIMUM field */
+    const uint32_t ttl = 300;
+
+    uint8_t addr_out[16];
+    uint32_t ttl_out;
+    int res = dns_msg_parse_reply(dns_msg, sizeof(dns_msg), AF_INET6, &addr_out, &ttl_out);
+    TEST_ASSERT_EQUAL_INT(-ENXIO, res);
+    TEST_ASSERT_EQUAL_INT(ttl, ttl_out);
+
+    /* a truncated reply may have lost the answer */
+    dns_msg[2] |= 0x02;
+    res = dns_msg_parse_reply(dns_msg, sizeof(dns_msg), AF_INET6, &addr_out, &ttl_out);
+    TEST_ASSERT_EQUAL_INT(-EBADMSG, res);
+    dns_msg[2] &= ~0x02;
+
+    /* server failure */
+    dns_msg[3] = 0x82;
+    res = dns_msg_parse_reply(dns_msg, sizeof(dns_msg), AF_INET6, &addr_out, &ttl_out);
+    TEST_ASSERT_EQUAL_INT(-EBADMSG, res);
+}
+
+static void test_dns_msg_nodata_wo_soa(void)
+{
+    const uint8_t dns_msg[] = {
+        /* in scapy notation:
+         * <DNS  id=0 qr=1 opcode=QUERY aa=0 tc=0 rd=1 ra=1 z=0 ad=0 cd=0 rcode=ok
+         *       qdcount=1 ancount=0 nscount=0 arcount=0
+         *       qd=<DNSQR  qname='example.org.' qtype=A qclass=IN |>
+         *       an=None ns=None ar=None |> */
+        0x00, 0x00, 0x81, 0x80, 0x00, 0x01, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x07, 0x65, 0x78, 0x61,
+        0x6d, 0x70, 0x6c, 0x65, 0x03, 0x6f, 0x72, 0x67,
+        0x00, 0x00, 0x01, 0x00, 0x01,
+    };
+
+    uint8_t addr_out[4];
+    uint32_t ttl_out = 1;
+    int res = dns_msg_parse_reply(dns_msg, sizeof(dns_msg), AF_INET, &addr_out, &ttl_out);
+    TEST_ASSERT_EQUAL_INT(-ENXIO, res);
+    /* must not be cached */
+    TEST_ASSERT_EQUAL_INT(0, ttl_out);
+}
+
 Test *tests_dns_msg_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_dns_msg_valid_AAAA),
         new_TestFixture(test_dns_msg_valid_dns64),
         new_TestFixture(test_dns_msg_valid_dns64_w_long_cnames),
+        new_TestFixture(test_dns_msg_nxdomain),
+        new_TestFixture(test_dns_msg_nodata_wo_soa),
     };
 
     EMB_UNIT_TESTCALLER(dns_msg_tests, NULL, NULL, fixtures);
@@ -0,0 +1,253 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "net/fib.h"
+#include "universal_address.h"
+
+#include "tests-fib_trie.h"
+
+#define TEST_FIB_TABLE_SIZE     (16)
+#define TEST_ADDR_SIZE          (16)
+#define TEST_IFACE              (42)
+#define TEST_RANDOM_ROUNDS      (32)
+#define TEST_RANDOM_LOOKUPS     (64)
+
+static fib_entry_t _trie_entries[TEST_FIB_TABLE_SIZE];
+static fib_trie_node_t _trie_nodes[FIB_TRIE_NODES_NUMOF(TEST_FIB_TABLE_SIZE)];
+static fib_table_t _trie_table = { .data.entries = _trie_entries,
+                                   .table_type = FIB_TABLE_TYPE_SH,
+                                   .size = TEST_FIB_TABLE_SIZE,
+                                   .mtx_access = MUTEX_INIT,
+                                   .trie = _trie_nodes };
+
+static fib_entry_t _linear_entries[TEST_FIB_TABLE_SIZE];
+static fib_table_t _linear_table = { .data.entries = _linear_entries,
+                                     .table_type = FIB_TABLE_TYPE_SH,
+                                     .size = TEST_FIB_TABLE_SIZE,
+                                     .mtx_access = MUTEX_INIT };
+
+static uint32_t _rand_state;
+
+/* deterministic pseudo random numbers, so failures are reproducible */
+static uint32_t _rand(void)
+{
+    _rand_state = (_rand_state * 1103515245U) + 12345U;
+    return _rand_state >> 16;
+}
+
+static void _set_addr(uint8_t *addr, uint16_t w0, uint16_t w1, uint16_t w2,
+                      uint16_t w7)
+{
+    memset(addr, 0, TEST_ADDR_SIZE);
+    addr[0] = w0 >> 8;
+    addr[1] = w0 & 0xff;
+    addr[2] = w1 >> 8;
+    addr[3] = w1 & 0xff;
+    addr[4] = w2 >> 8;
+    addr[5] = w2 & 0xff;
+    addr[14] = w7 >> 8;
+    addr[15] = w7 & 0xff;
+}
+
+static void _add(fib_table_t *table, uint8_t *dst, unsigned prefix_len,
+                 uint8_t nh)
+{
+    uint8_t next_hop[TEST_ADDR_SIZE] = { 0xfe, 0x80 };
+    uint32_t flags = (prefix_len < (TEST_ADDR_SIZE * 8))
+                   ? (prefix_len << FIB_FLAG_NET_PREFIX_SHIFT) : 0;
+
+    next_hop[15] = nh;
+    TEST_ASSERT_EQUAL_INT(0, fib_add_entry(table, TEST_IFACE, dst,
+                                           TEST_ADDR_SIZE, flags, next_hop,
+                                           TEST_ADDR_SIZE, 0,
+                                           (uint32_t)FIB_LIFETIME_NO_EXPIRE));
+}
+
+/* returns the last byte of the next hop or a negative errno */
+static int _lookup(fib_table_t *table, uint8_t *dst)
+{
+    uint8_t next_hop[TEST_ADDR_SIZE];
+    size_t next_hop_size = sizeof(next_hop);
+    kernel_pid_t iface = KERNEL_PID_UNDEF;
+    uint32_t next_hop_flags;
+    int res = fib_get_next_hop(table, &iface, next_hop, &next_hop_size,
+                               &next_hop_flags, dst, TEST_ADDR_SIZE, 0);
+
+    if (res < 0) {
+        return res;
+    }
+    if ((iface != TEST_IFACE) || (next_hop_size != TEST_ADDR_SIZE)) {
+        return -EINVAL;
+    }
+    return next_hop[15];
+}
+
+static void set_up(void)
+{
+    fib_init(&_trie_table);
+    fib_init(&_linear_table);
+}
+
+static void tear_down(void)
+{
+    fib_deinit(&_trie_table);
+    fib_deinit(&_linear_table);
+}
+
+static void test_fib_trie_01_exact_and_prefix_match(void)
+{
+    uint8_t addr[TEST_ADDR_SIZE];
+
+    _set_addr(addr, 0x2001, 0x0db8, 0, 0);
+    _add(&_trie_table, addr, 32, 1);
+    _set_addr(addr, 0x2001, 0x0db8, 1, 0);
+    _add(&_trie_table, addr, 48, 2);
+    _set_addr(addr, 0x2001, 0x0db8, 1, 1);
+    _add(&_trie_table, addr, 128, 3);
+    _set_addr(addr, 0x2001, 0x0db8, 0x8000, 0);
+    _add(&_trie_table, addr, 33, 4);
+    TEST_ASSERT_EQUAL_INT(4, fib_get_num_used_entries(&_trie_table));
+
+    _set_addr(addr, 0x2001, 0x0db8, 1, 1);
+    TEST_ASSERT_EQUAL_INT(3, _lookup(&_trie_table, addr));
+    _set_addr(addr, 0x2001, 0x0db8, 1, 2);
+    TEST_ASSERT_EQUAL_INT(2, _lookup(&_trie_table, addr));
+    _set_addr(addr, 0x2001, 0x0db8, 2, 1);
+    TEST_ASSERT_EQUAL_INT(1, _lookup(&_trie_table, addr));
+    _set_addr(addr, 0x2001, 0x0db8, 0x8001, 1);
+    TEST_ASSERT_EQUAL_INT(4, _lookup(&_trie_table, addr));
+    /* exact look-up of the prefix address itself */
+    _set_addr(addr, 0x2001, 0x0db8, 0, 0);
+    TEST_ASSERT_EQUAL_INT(1, _lookup(&_trie_table, addr));
+    _set_addr(addr, 0x2001, 0x0db9, 1, 1);
+    TEST_ASSERT_EQUAL_INT(-EHOSTUNREACH, _lookup(&_trie_table, addr));
+}
+
+static void test_fib_trie_02_default_gateway(void)
+{
+    uint8_t addr[TEST_ADDR_SIZE];
+
+    _set_addr(addr, 0, 0, 0, 0);
+    _add(&_trie_table, addr, 0, 1);
+    _set_addr(addr, 0x2001, 0x0db8, 0, 0);
+    _add(&_trie_table, addr, 32, 2);
+
+    _set_addr(addr, 0x2001, 0x0db8, 1, 1);
+    TEST_ASSERT_EQUAL_INT(2, _lookup(&_trie_table, addr));
+    _set_addr(addr, 0x2001, 0x0db9, 1, 1);
+    TEST_ASSERT_EQUAL_INT(1, _lookup(&_trie_table, addr));
+    _set_addr(addr, 0, 0, 0, 0);
+    TEST_ASSERT_EQUAL_INT(1, _lookup(&_trie_table, addr));
+}
+
+static void test_fib_trie_03_remove(void)
+{
+    uint8_t addr[TEST_ADDR_SIZE];
+
+    _set_addr(addr, 0, 0, 0, 0);
+    _add(&_trie_table, addr, 0, 1);
+    _set_addr(addr, 0x2001, 0x0db8, 0, 0);
+    _add(&_trie_table, addr, 32, 2);
+    _set_addr(addr, 0x2001, 0x0db8, 1, 0);
+    _add(&_trie_table, addr, 48, 3);
+    _set_addr(addr, 0x2001, 0x0db8, 2, 0);
+    _add(&_trie_table, addr, 48, 4);
+
+    /* remove an inner node with two children */
+    _set_addr(addr, 0x2001, 0x0db8, 0, 0);
+    fib_remove_entry(&_trie_table, addr, TEST_ADDR_SIZE);
+    _set_addr(addr, 0x2001, 0x0db8, 1, 1);
+    TEST_ASSERT_EQUAL_INT(3, _lookup(&_trie_table, addr));
+    _set_addr(addr, 0x2001, 0x0db8, 2, 1);
+    TEST_ASSERT_EQUAL_INT(4, _lookup(&_trie_table, addr));
+    _set_addr(addr, 0x2001, 0x0db8, 3, 1);
+    TEST_ASSERT_EQUAL_INT(1, _lookup(&_trie_table, addr));
+
+    /* remove leaves */
+    _set_addr(addr, 0x2001, 0x0db8, 1, 0);
+    fib_remove_entry(&_trie_table, addr, TEST_ADDR_SIZE);
+    _set_addr(addr, 0x2001, 0x0db8, 2, 0);
+    fib_remove_entry(&_trie_table, addr, TEST_ADDR_SIZE);
+    _set_addr(addr, 0x2001, 0x0db8, 2, 1);
+    TEST_ASSERT_EQUAL_INT(1, _lookup(&_trie_table, addr));
+
+    _set_addr(addr, 0, 0, 0, 0);
+    fib_remove_entry(&_trie_table, addr, TEST_ADDR_SIZE);
+    TEST_ASSERT_EQUAL_INT(0, fib_get_num_used_entries(&_trie_table));
+    TEST_ASSERT_NULL(_trie_table.trie_root);
+    _set_addr(addr, 0x2001, 0x0db8, 2, 1);
+    TEST_ASSERT_EQUAL_INT(-EHOSTUNREACH, _lookup(&_trie_table, addr));
+}
+
+/*
+ * Adds and removes the same random byte-aligned routes to a prefix tree
+ * indexed table and a linearly searched table.
+ * Expected result: both tables return the same next hops for random
+ * destinations
+ */
+static void test_fib_trie_04_compare_linear(void)
+{
+    static const uint8_t prefix_lens[] = { 0, 16, 32, 40, 48, 128 };
+    uint8_t addr[TEST_ADDR_SIZE];
+
+    _rand_state = 0x1234;
+    for (unsigned round = 0; round < TEST_RANDOM_ROUNDS; round++) {
+        fib_flush(&_trie_table, KERNEL_PID_UNDEF);
+        fib_flush(&_linear_table, KERNEL_PID_UNDEF);
+        for (unsigned i = 0; i < TEST_FIB_TABLE_SIZE; i++) {
+            unsigned prefix_len = prefix_lens[_rand() % sizeof(prefix_lens)];
+            uint8_t nh = _rand() % 4;
+
+            _set_addr(addr, 0x2001, 0x0db8 + (_rand() % 2), _rand() % 3,
+                      _rand() % 3);
+            /* mask the address to the prefix */
+            for (unsigned j = prefix_len / 8; j < TEST_ADDR_SIZE; j++) {
+                addr[j] = 0;
+            }
+            if ((_rand() % 4) == 0) {
+                fib_remove_entry(&_trie_table, addr, TEST_ADDR_SIZE);
+                fib_remove_entry(&_linear_table, addr, TEST_ADDR_SIZE);
+            }
+            else {
+                _add(&_trie_table, addr, prefix_len, nh);
+                _add(&_linear_table, addr, prefix_len, nh);
+            }
+        }
+        TEST_ASSERT_EQUAL_INT(fib_get_num_used_entries(&_linear_table),
+                              fib_get_num_used_entries(&_trie_table));
+        for (unsigned i = 0; i < TEST_RANDOM_LOOKUPS; i++) {
+            _set_addr(addr, 0x2001, 0x0db8 + (_rand() % 3), _rand() % 4,
+                      _rand() % 4);
+            TEST_ASSERT_EQUAL_INT(_lookup(&_linear_table, addr),
+                                  _lookup(&_trie_table, addr));
+        }
+    }
+}
+
+static Test *tests_fib_trie_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_fib_trie_01_exact_and_prefix_match),
+        new_TestFixture(test_fib_trie_02_default_gateway),
+        new_TestFixture(test_fib_trie_03_remove),
+        new_TestFixture(test_fib_trie_04_compare_linear),
+    };
+
+    EMB_UNIT_TESTCALLER(fib_trie_tests, set_up, tear_down, fixtures);
+
+    return (Test *)&fib_trie_tests;
+}
+
+void tests_fib_trie(void)
+{
+    TESTS_RUN(tests_fib_trie_tests());
+}
@@ -32,6 +32,7 @@
 #define GLOBAL_PREFIX       { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0 }
 #define GLOBAL_PREFIX_LEN   (30)
 #define IFACE               (6)
+#define L2ADDR              { 0x90, 0xd5, 0x8e, 0x8c, 0x92, 0x43, 0x73, 0x5c }
 
 static void set_up(void)
 {
@@ -2002,6 +2003,94 @@ static void test_nib_abr_iter__three_elem_middle_removed(void)
 }
 #endif
 
+#if CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF > 0
+/*
+ * Looks up a destination in an empty route cache.
+ * Expected result: should return NULL
+ */
+static void test_nib_rc_get__empty(void)
+{
+    static const ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                            { .u64 = TEST_UINT64 } } };
+
+    _nib_acquire_ro();
+    TEST_ASSERT_NULL(_nib_rc_get(&dst, IFACE));
+    _nib_release();
+}
+
+/*
+ * Adds a next hop to the route cache and looks it up again, both with the
+ * same and with a different interface.
+ * Expected result: only the look-up with the same interface returns the entry
+ */
+static void test_nib_rc_get__success(void)
+{
+    static const ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                            { .u64 = TEST_UINT64 } } };
+    gnrc_ipv6_nib_nc_t nce = { .l2addr = L2ADDR, .l2addr_len = sizeof(nce.l2addr),
+                               .info = (IFACE << GNRC_IPV6_NIB_NC_INFO_IFACE_POS) };
+    _nib_rc_entry_t *entry;
+
+    _nib_acquire();
+    _nib_rc_add(&dst, IFACE, &nce, NULL);
+    _nib_release();
+    _nib_acquire_ro();
+    TEST_ASSERT_NOT_NULL((entry = _nib_rc_get(&dst, IFACE)));
+    TEST_ASSERT(ipv6_addr_equal(&dst, &entry->dst));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&nce, &entry->nce, sizeof(nce)));
+    TEST_ASSERT_NULL(_nib_rc_get(&dst, 0));
+    _nib_release();
+}
+
+/*
+ * Adds a next hop to the route cache and acquires the NIB for a potential
+ * change afterwards.
+ * Expected result: the entry is not returned anymore
+ */
+static void test_nib_rc_get__invalidated(void)
+{
+    static const ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                            { .u64 = TEST_UINT64 } } };
+    gnrc_ipv6_nib_nc_t nce = { .l2addr = L2ADDR, .l2addr_len = sizeof(nce.l2addr),
+                               .info = (IFACE << GNRC_IPV6_NIB_NC_INFO_IFACE_POS) };
+
+    _nib_acquire();
+    _nib_rc_add(&dst, IFACE, &nce, NULL);
+    _nib_release();
+    _nib_acquire();
+    TEST_ASSERT_NULL(_nib_rc_get(&dst, IFACE));
+    _nib_release();
+}
+
+/*
+ * Adds CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF + 1 destinations to the route
+ * cache.
+ * Expected result: the first entry was replaced, the others are still cached
+ */
+static void test_nib_rc_add__replace(void)
+{
+    ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                 { .u64 = TEST_UINT64 } } };
+    gnrc_ipv6_nib_nc_t nce = { .l2addr = L2ADDR, .l2addr_len = sizeof(nce.l2addr),
+                               .info = (IFACE << GNRC_IPV6_NIB_NC_INFO_IFACE_POS) };
+
+    _nib_acquire();
+    for (unsigned i = 0; i <= CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF; i++) {
+        _nib_rc_add(&dst, IFACE, &nce, NULL);
+        dst.u64[1].u64++;
+    }
+    _nib_release();
+    _nib_acquire_ro();
+    dst.u64[1].u64 = TEST_UINT64;
+    TEST_ASSERT_NULL(_nib_rc_get(&dst, IFACE));
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF; i++) {
+        dst.u64[1].u64++;
+        TEST_ASSERT_NOT_NULL(_nib_rc_get(&dst, IFACE));
+    }
+    _nib_release();
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF > 0 */
+
 static void test_retrans_exp_backoff(void)
 {
     TEST_ASSERT_EQUAL_INT(0,
@@ -2153,6 +2242,12 @@ Test *tests_gnrc_ipv6_nib_internal_tests(void)
         new_TestFixture(test_nib_abr_iter__one_elem),
         new_TestFixture(test_nib_abr_iter__three_elem),
         new_TestFixture(test_nib_abr_iter__three_elem_middle_removed),
+#endif
+#if CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF > 0
+        new_TestFixture(test_nib_rc_get__empty),
+        new_TestFixture(test_nib_rc_get__success),
+        new_TestFixture(test_nib_rc_get__invalidated),
+        new_TestFixture(test_nib_rc_add__replace),
 #endif
         new_TestFixture(test_retrans_exp_backoff),
     };
@@ -0,0 +1,294 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "byteorder.h"
+#include "container.h"
+#include "net/tcp.h"
+#include "net/gnrc/tcp/tcb.h"
+
+#include "gnrc_tcp_common.h"
+#include "gnrc_tcp_fsm.h"
+#include "gnrc_tcp_option.h"
+
+#include "tests-gnrc_tcp_option.h"
+
+static gnrc_tcp_tcb_t _tcb;
+static union {
+    tcp_hdr_t hdr;
+    uint8_t raw[TCP_HDR_OFFSET_MAX * 4];
+} _seg;
+
+static tcp_hdr_t *_hdr(uint16_t ctl, const uint8_t *opts, size_t opts_len)
+{
+    /* the padding is zeroed, i.e. EOL */
+    memset(&_seg, 0, sizeof(_seg));
+    memcpy(&_seg.raw[sizeof(tcp_hdr_t)], opts, opts_len);
+    _seg.hdr.off_ctl = byteorder_htons(
+        ((TCP_HDR_OFFSET_MIN + (opts_len + 3) / 4) << 12) | ctl);
+    return &_seg.hdr;
+}
+
+static uint32_t _u32(const uint8_t *ptr)
+{
+    return ((uint32_t)ptr[0] << 24) | ((uint32_t)ptr[1] << 16) |
+           ((uint32_t)ptr[2] << 8) | ptr[3];
+}
+
+static void set_up(void)
+{
+    memset(&_tcb, 0, sizeof(_tcb));
+    _tcb.state = FSM_STATE_LISTEN;
+}
+
+static void test_gnrc_tcp_option_parse__syn(void)
+{
+    static const uint8_t opts[] = {
+        TCP_OPTION_KIND_MSS, TCP_OPTION_LENGTH_MSS, 0x02, 0x18,
+        TCP_OPTION_KIND_NOP, TCP_OPTION_KIND_WS, TCP_OPTION_LENGTH_WS, 7,
+        TCP_OPTION_KIND_NOP, TCP_OPTION_KIND_NOP,
+        TCP_OPTION_KIND_SACK_PERM, TCP_OPTION_LENGTH_SACK_PERM,
+        TCP_OPTION_KIND_NOP, TCP_OPTION_KIND_NOP,
+        TCP_OPTION_KIND_TS, TCP_OPTION_LENGTH_TS,
+        0x01, 0x02, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00,
+    };
+    _gnrc_tcp_option_seg_t seg;
+
+    _tcb.rcv_buf_limit = 0x40000;
+    TEST_ASSERT_EQUAL_INT(0, _gnrc_tcp_option_parse(&_tcb, _hdr(MSK_SYN, opts, sizeof(opts)),
+                                                    &seg));
+    TEST_ASSERT_EQUAL_INT(536, _tcb.mss);
+    TEST_ASSERT_EQUAL_INT(OPTION_WS | OPTION_SACK_PERM | OPTION_TS, _tcb.options);
+    TEST_ASSERT_EQUAL_INT(7, _tcb.snd_wnd_scale);
+    /* smallest shift count that fits 256 KiB into 16 bit */
+    TEST_ASSERT_EQUAL_INT(3, _tcb.rcv_wnd_scale);
+    TEST_ASSERT_EQUAL_INT(0x01020304, _tcb.ts_recent);
+    TEST_ASSERT(seg.has_ts);
+    TEST_ASSERT_EQUAL_INT(0x01020304, seg.ts_val);
+    TEST_ASSERT_EQUAL_INT(0, seg.ts_ecr);
+    TEST_ASSERT_EQUAL_INT(0, seg.sack_num);
+}
+
+static void test_gnrc_tcp_option_parse__syn_wnd_scale_max(void)
+{
+    static const uint8_t opts[] = {
+        TCP_OPTION_KIND_WS, TCP_OPTION_LENGTH_WS, WND_SCALE_MAX + 1,
+    };
+    _gnrc_tcp_option_seg_t seg;
+
+    TEST_ASSERT_EQUAL_INT(0, _gnrc_tcp_option_parse(&_tcb, _hdr(MSK_SYN, opts, sizeof(opts)),
+                                                    &seg));
+    TEST_ASSERT_EQUAL_INT(OPTION_WS, _tcb.options);
+    TEST_ASSERT_EQUAL_INT(WND_SCALE_MAX, _tcb.snd_wnd_scale);
+}
+
+static void test_gnrc_tcp_option_parse__established(void)
+{
+    static const uint8_t opts[] = {
+        TCP_OPTION_KIND_NOP, TCP_OPTION_KIND_NOP,
+        TCP_OPTION_KIND_TS, TCP_OPTION_LENGTH_TS,
+        0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x17,
+        TCP_OPTION_KIND_NOP, TCP_OPTION_KIND_NOP,
+        TCP_OPTION_KIND_SACK, TCP_OPTION_LENGTH_MIN + 2 * TCP_OPTION_LENGTH_SACK_BLOCK,
+        0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00,
+        0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x40, 0x00,
+    };
+    _gnrc_tcp_option_seg_t seg;
+
+    _tcb.state = FSM_STATE_ESTABLISHED;
+    _tcb.options = OPTION_SACK_PERM | OPTION_TS;
+    _tcb.ts_recent = 0x11;
+    TEST_ASSERT_EQUAL_INT(0, _gnrc_tcp_option_parse(&_tcb, _hdr(MSK_ACK, opts, sizeof(opts)),
+                                                    &seg));
+    /* the negotiated options are not touched after the handshake */
+    TEST_ASSERT_EQUAL_INT(OPTION_SACK_PERM | OPTION_TS, _tcb.options);
+    TEST_ASSERT_EQUAL_INT(0x11, _tcb.ts_recent);
+    TEST_ASSERT(seg.has_ts);
+    TEST_ASSERT_EQUAL_INT(0x2a, seg.ts_val);
+    TEST_ASSERT_EQUAL_INT(0x17, seg.ts_ecr);
+    TEST_ASSERT_EQUAL_INT(2, seg.sack_num);
+    TEST_ASSERT_EQUAL_INT(0x1000, seg.sack_left[0]);
+    TEST_ASSERT_EQUAL_INT(0x2000, seg.sack_right[0]);
+    TEST_ASSERT_EQUAL_INT(0x3000, seg.sack_left[1]);
+    TEST_ASSERT_EQUAL_INT(0x4000, seg.sack_right[1]);
+}
+
+static void test_gnrc_tcp_option_parse__eol(void)
+{
+    /* nothing after EOL is parsed, not even a malformed option */
+    static const uint8_t opts[] = {
+        TCP_OPTION_KIND_EOL, TCP_OPTION_KIND_MSS, 0x03, 0x00,
+    };
+    _gnrc_tcp_option_seg_t seg;
+
+    TEST_ASSERT_EQUAL_INT(0, _gnrc_tcp_option_parse(&_tcb, _hdr(MSK_SYN, opts, sizeof(opts)),
+                                                    &seg));
+    TEST_ASSERT_EQUAL_INT(0, _tcb.options);
+}
+
+static void test_gnrc_tcp_option_parse__malformed(void)
+{
+    static const struct {
+        uint8_t len;
+        uint8_t opts[12];
+    } malformed[] = {
+        { 4, { TCP_OPTION_KIND_MSS, 0x03, 0x02, 0x18 } },
+        { 4, { TCP_OPTION_KIND_WS, 0x04, 0x07, 0x00 } },
+        { 4, { TCP_OPTION_KIND_SACK_PERM, 0x03, 0x00, 0x00 } },
+        { 4, { TCP_OPTION_KIND_SACK, 0x02, 0x00, 0x00 } },
+        { 12, { TCP_OPTION_KIND_SACK, 0x0b } },
+        { 12, { TCP_OPTION_KIND_TS, 0x08 } },
+        /* length exceeds the option field */
+        { 4, { TCP_OPTION_KIND_NOP, TCP_OPTION_KIND_MSS, 0x04, 0x02 } },
+        { 4, { 0x1e, 0x08, 0x00, 0x00 } },
+        /* length smaller than kind and length */
+        { 4, { 0x1e, 0x01, 0x00, 0x00 } },
+        { 4, { 0x1e, 0x00, 0x00, 0x00 } },
+        /* no room for the length */
+        { 4, { TCP_OPTION_KIND_NOP, TCP_OPTION_KIND_NOP, TCP_OPTION_KIND_NOP, 0x1e } },
+    };
+
+    for (unsigned i = 0; i < ARRAY_SIZE(malformed); i++) {
+        _gnrc_tcp_option_seg_t seg;
+        tcp_hdr_t *hdr = _hdr(MSK_SYN, malformed[i].opts, malformed[i].len);
+
+        set_up();
+        TEST_ASSERT_EQUAL_INT(-1, _gnrc_tcp_option_parse(&_tcb, hdr, &seg));
+    }
+}
+
+static void test_gnrc_tcp_option_build__rst(void)
+{
+    uint8_t buf[TCP_HDR_OFFSET_MAX * 4];
+
+    _tcb.options = OPTION_WS | OPTION_SACK_PERM | OPTION_TS;
+    TEST_ASSERT_EQUAL_INT(0, _gnrc_tcp_option_build(&_tcb, NULL, MSK_RST));
+    TEST_ASSERT_EQUAL_INT(0, _gnrc_tcp_option_build(&_tcb, buf, MSK_RST_ACK));
+}
+
+static void test_gnrc_tcp_option_build__syn(void)
+{
+    static const uint8_t exp[] = {
+        TCP_OPTION_KIND_MSS, TCP_OPTION_LENGTH_MSS,
+        CONFIG_GNRC_TCP_MSS >> 8, CONFIG_GNRC_TCP_MSS & 0xff,
+        TCP_OPTION_KIND_NOP, TCP_OPTION_KIND_WS, TCP_OPTION_LENGTH_WS, 3,
+        TCP_OPTION_KIND_NOP, TCP_OPTION_KIND_NOP,
+        TCP_OPTION_KIND_SACK_PERM, TCP_OPTION_LENGTH_SACK_PERM,
+        TCP_OPTION_KIND_NOP, TCP_OPTION_KIND_NOP,
+        TCP_OPTION_KIND_TS, TCP_OPTION_LENGTH_TS,
+    };
+    uint8_t buf[TCP_HDR_OFFSET_MAX * 4];
+
+    /* an initial SYN offers all options, regardless of the TCB */
+    _tcb.state = FSM_STATE_CLOSED;
+    _tcb.rcv_buf_limit = 0x40000;
+    _tcb.ts_recent = 0x11223344;
+    TEST_ASSERT_EQUAL_INT(sizeof(exp) + 8, _gnrc_tcp_option_build(&_tcb, NULL, MSK_SYN));
+    TEST_ASSERT_EQUAL_INT(sizeof(exp) + 8, _gnrc_tcp_option_build(&_tcb, buf, MSK_SYN));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(exp, buf, sizeof(exp)));
+    /* no echo reply without ACK */
+    TEST_ASSERT_EQUAL_INT(0, _u32(&buf[sizeof(exp) + 4]));
+}
+
+static void test_gnrc_tcp_option_build__syn_ack(void)
+{
+    static const uint8_t exp[] = {
+        TCP_OPTION_KIND_MSS, TCP_OPTION_LENGTH_MSS,
+        CONFIG_GNRC_TCP_MSS >> 8, CONFIG_GNRC_TCP_MSS & 0xff,
+        TCP_OPTION_KIND_NOP, TCP_OPTION_KIND_WS, TCP_OPTION_LENGTH_WS, 2,
+        TCP_OPTION_KIND_NOP, TCP_OPTION_KIND_NOP,
+        TCP_OPTION_KIND_TS, TCP_OPTION_LENGTH_TS,
+    };
+    uint8_t buf[TCP_HDR_OFFSET_MAX * 4];
+
+    /* a SYN+ACK accepts the negotiated options with the chosen shift count */
+    _tcb.state = FSM_STATE_SYN_RCVD;
+    _tcb.options = OPTION_WS | OPTION_TS;
+    _tcb.rcv_buf_limit = 0x40000;
+    _tcb.rcv_wnd_scale = 2;
+    _tcb.ts_recent = 0x11223344;
+    TEST_ASSERT_EQUAL_INT(sizeof(exp) + 8, _gnrc_tcp_option_build(&_tcb, buf, MSK_SYN_ACK));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(exp, buf, sizeof(exp)));
+    TEST_ASSERT_EQUAL_INT(0x11223344, _u32(&buf[sizeof(exp) + 4]));
+}
+
+static void test_gnrc_tcp_option_build__ack(void)
+{
+    static const uint8_t exp[] = {
+        TCP_OPTION_KIND_NOP, TCP_OPTION_KIND_NOP,
+        TCP_OPTION_KIND_TS, TCP_OPTION_LENGTH_TS,
+    };
+    uint8_t buf[TCP_HDR_OFFSET_MAX * 4];
+
+    /* only timestamps are sent after the handshake */
+    _tcb.state = FSM_STATE_ESTABLISHED;
+    _tcb.options = OPTION_WS | OPTION_SACK_PERM | OPTION_TS;
+    _tcb.ts_recent = 0x11223344;
+    TEST_ASSERT_EQUAL_INT(sizeof(exp) + 8, _gnrc_tcp_option_build(&_tcb, buf, MSK_ACK));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(exp, buf, sizeof(exp)));
+    TEST_ASSERT_EQUAL_INT(0x11223344, _u32(&buf[sizeof(exp) + 4]));
+
+    _tcb.options = OPTION_WS | OPTION_SACK_PERM;
+    TEST_ASSERT_EQUAL_INT(0, _gnrc_tcp_option_build(&_tcb, buf, MSK_ACK));
+}
+
+static void test_gnrc_tcp_option_update_ts(void)
+{
+    static const uint8_t opts[] = {
+        TCP_OPTION_KIND_NOP, TCP_OPTION_KIND_NOP,
+        TCP_OPTION_KIND_TS, TCP_OPTION_LENGTH_TS,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    };
+    tcp_hdr_t *hdr = _hdr(MSK_ACK, opts, sizeof(opts));
+    uint8_t *ts = &_seg.raw[sizeof(tcp_hdr_t) + 4];
+
+    _tcb.state = FSM_STATE_ESTABLISHED;
+    _tcb.options = OPTION_TS;
+    _tcb.ts_recent = 0x11223344;
+    _gnrc_tcp_option_update_ts(&_tcb, hdr);
+    TEST_ASSERT_EQUAL_INT(0x11223344, _u32(&ts[4]));
+    /* and the options are still valid */
+    _gnrc_tcp_option_seg_t seg;
+    TEST_ASSERT_EQUAL_INT(0, _gnrc_tcp_option_parse(&_tcb, hdr, &seg));
+    TEST_ASSERT(seg.has_ts);
+    TEST_ASSERT_EQUAL_INT(_u32(ts), seg.ts_val);
+}
+
+Test *tests_gnrc_tcp_option_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_gnrc_tcp_option_parse__syn),
+        new_TestFixture(test_gnrc_tcp_option_parse__syn_wnd_scale_max),
+        new_TestFixture(test_gnrc_tcp_option_parse__established),
+        new_TestFixture(test_gnrc_tcp_option_parse__eol),
+        new_TestFixture(test_gnrc_tcp_option_parse__malformed),
+        new_TestFixture(test_gnrc_tcp_option_build__rst),
+        new_TestFixture(test_gnrc_tcp_option_build__syn),
+        new_TestFixture(test_gnrc_tcp_option_build__syn_ack),
+        new_TestFixture(test_gnrc_tcp_option_build__ack),
+        new_TestFixture(test_gnrc_tcp_option_update_ts),
+    };
+
+    EMB_UNIT_TESTCALLER(gnrc_tcp_option_tests, set_up, NULL, fixtures);
+
+    return (Test *)&gnrc_tcp_option_tests;
+}
+
+void tests_gnrc_tcp_option(void)
+{
+    TESTS_RUN(tests_gnrc_tcp_option_tests());
+}
+/** @} */
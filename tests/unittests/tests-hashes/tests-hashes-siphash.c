@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     unittests
+ * @{
+ *
+ * @file
+ * @brief       Test cases for the SipHash-2-4 implementation
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "container.h"
+#include "embUnit/embUnit.h"
+#include "hashes/siphash.h"
+
+#include "tests-hashes.h"
+
+/* test vectors of the reference implementation: the key is 00 01 .. 0f, the
+ * message of length n is 00 01 .. (n - 1) */
+static const struct {
+    uint8_t len;
+    uint8_t digest[SIPHASH_DIGEST_LENGTH];
+} _vectors[] = {
+    { 0, { 0x31, 0x0e, 0x0e, 0xdd, 0x47, 0xdb, 0x6f, 0x72 } },
+    { 1, { 0xfd, 0x67, 0xdc, 0x93, 0xc5, 0x39, 0xf8, 0x74 } },
+    { 7, { 0x37, 0xd1, 0x01, 0x8b, 0xf5, 0x00, 0x02, 0xab } },
+    { 8, { 0x62, 0x24, 0x93, 0x9a, 0x79, 0xf5, 0xf5, 0x93 } },
+    { 15, { 0xe5, 0x45, 0xbe, 0x49, 0x61, 0xca, 0x29, 0xa1 } },
+    { 63, { 0x72, 0x45, 0x06, 0xeb, 0x4c, 0x32, 0x8a, 0x95 } },
+};
+
+static uint8_t _key[SIPHASH_KEY_LENGTH];
+static uint8_t _msg[64];
+
+static void set_up(void)
+{
+    for (unsigned i = 0; i < sizeof(_key); i++) {
+        _key[i] = i;
+    }
+    for (unsigned i = 0; i < sizeof(_msg); i++) {
+        _msg[i] = i;
+    }
+}
+
+static void test_hashes_siphash_vectors(void)
+{
+    uint8_t digest[SIPHASH_DIGEST_LENGTH];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_vectors); i++) {
+        siphash(digest, _key, _msg, _vectors[i].len);
+        TEST_ASSERT(memcmp(digest, _vectors[i].digest, sizeof(digest)) == 0);
+    }
+}
+
+static void test_hashes_siphash_incremental(void)
+{
+    uint8_t digest[SIPHASH_DIGEST_LENGTH];
+    const uint8_t *exp = _vectors[ARRAY_SIZE(_vectors) - 1].digest;
+
+    /* feed the longest message in chunks of every size */
+    for (unsigned chunk = 1; chunk <= 17; chunk++) {
+        siphash_context_t ctx;
+        unsigned pos = 0;
+
+        siphash_init(&ctx, _key);
+        while (pos < 63) {
+            unsigned len = (63 - pos < chunk) ? 63 - pos : chunk;
+
+            siphash_update(&ctx, &_msg[pos], len);
+            pos += len;
+        }
+        siphash_final(&ctx, digest);
+        TEST_ASSERT(memcmp(digest, exp, sizeof(digest)) == 0);
+    }
+}
+
+Test *tests_hashes_siphash_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_hashes_siphash_vectors),
+        new_TestFixture(test_hashes_siphash_incremental),
+    };
+
+    EMB_UNIT_TESTCALLER(hashes_siphash_tests, set_up, NULL, fixtures);
+
+    return (Test *)&hashes_siphash_tests;
+}
@@ -1285,6 +1285,50 @@ static void test_nanocoap__out_of_bounds_option(void)
     TEST_ASSERT_EQUAL_INT(-EBADMSG, coap_parse(&pkt, invalid_msg, sizeof(invalid_msg)));
 }
 
+/*
+ * Attaches only the parts of the data within the second 16 byte block as
+ * payload snips.
+ */
+static void test_nanocoap__blockwise_put_snip(void)
+{
+    static const char data[] = "0123456789abcdefghijklmnopqrstuvwxyz0123";
+    uint8_t buf[_BUF_SIZE];
+    iolist_t snips[4];
+    coap_block_slicer_t slicer;
+    coap_pkt_t pkt;
+
+    coap_pkt_init(&pkt, buf, sizeof(buf), 8);
+    coap_block_slicer_init(&slicer, 1, 16);
+
+    /* before the block */
+    TEST_ASSERT_EQUAL_INT(0, coap_blockwise_put_snip(&slicer, &pkt, &snips[0], data, 10));
+    TEST_ASSERT_NULL(pkt.snips);
+    /* overlaps the start of the block */
+    TEST_ASSERT_EQUAL_INT(14, coap_blockwise_put_snip(&slicer, &pkt, &snips[1],
+                                                      data + 10, 20));
+    /* overlaps the end of the block */
+    TEST_ASSERT_EQUAL_INT(2, coap_blockwise_put_snip(&slicer, &pkt, &snips[2],
+                                                     data + 30, 10));
+    /* beyond the block */
+    TEST_ASSERT_EQUAL_INT(0, coap_blockwise_put_snip(&slicer, &pkt, &snips[3],
+                                                     data, 1));
+    TEST_ASSERT_EQUAL_INT(41, slicer.cur);
+
+    TEST_ASSERT(pkt.snips == &snips[1]);
+    TEST_ASSERT(snips[1].iol_next == &snips[2]);
+    TEST_ASSERT_NULL(snips[2].iol_next);
+    TEST_ASSERT_EQUAL_INT(16, iolist_size(pkt.snips));
+    TEST_ASSERT(snips[1].iol_base == data + 16);
+    TEST_ASSERT(snips[2].iol_base == data + 30);
+
+    /* further snips are appended */
+    snips[0].iol_base = (void *)data;
+    snips[0].iol_len = 10;
+    coap_payload_add_snip(&pkt, &snips[0]);
+    TEST_ASSERT(snips[2].iol_next == &snips[0]);
+    TEST_ASSERT_EQUAL_INT(26, iolist_size(pkt.snips));
+}
+
 Test *tests_nanocoap_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -1325,6 +1369,7 @@ Test *tests_nanocoap_tests(void)
         new_TestFixture(test_nanocoap__token_length_ext_269),
         new_TestFixture(test_nanocoap___rst_message),
         new_TestFixture(test_nanocoap__out_of_bounds_option),
+        new_TestFixture(test_nanocoap__blockwise_put_snip),
     };
 
     EMB_UNIT_TESTCALLER(nanocoap_tests, NULL, NULL, fixtures);
@@ -18,6 +18,7 @@
 
 #include "embUnit.h"
 
+#include "macros/utils.h"
 #include "net/nanocoap/cache.h"
 #include "ztimer.h"
 #include "hashes/sha256.h"
@@ -25,6 +26,9 @@
 #include "unittests-constants.h"
 #include "tests-nanocoap_cache.h"
 #define _BUF_SIZE (128U)
+/* number of entries with a response of the maximum size */
+#define _CAPACITY MIN(CONFIG_NANOCOAP_CACHE_ENTRIES, \
+                      CONFIG_NANOCOAP_CACHE_SIZE / CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE)
 
 static void test_nanocoap_cache__cachekey(void)
 {
@@ -69,10 +73,17 @@ static void test_nanocoap_cache__cachekey(void)
 
     nanocoap_cache_key_generate((const coap_pkt_t *) &pkt2, digest2);
 
+#if IS_ACTIVE(CONFIG_NANOCOAP_CACHE_KEY_SIPHASH)
+    /* the order of keyed digests depends on the random key */
+    TEST_ASSERT(nanocoap_cache_key_compare(digest1, digest2) != 0);
+    TEST_ASSERT((nanocoap_cache_key_compare(digest1, digest2) < 0) ==
+                (nanocoap_cache_key_compare(digest2, digest1) > 0));
+#else
     /* compare 1. and 3. packet */
     TEST_ASSERT(nanocoap_cache_key_compare(digest1, digest2) < 0);
     /* compare 3. and 1. packet */
     TEST_ASSERT(nanocoap_cache_key_compare(digest2, digest1) > 0);
+#endif
 }
 
 static void test_nanocoap_cache__cachekey_blockwise(void)
@@ -144,16 +155,16 @@ static void test_nanocoap_cache__add(void)
     nanocoap_cache_init();
 
     /* add more entries to test LRU replacement */
-    for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES + 4; i++) {
-        if (i < CONFIG_NANOCOAP_CACHE_ENTRIES) {
+    for (unsigned i = 0; i < _CAPACITY + 4; i++) {
+        if (i < _CAPACITY) {
             TEST_ASSERT_EQUAL_INT(CONFIG_NANOCOAP_CACHE_ENTRIES - i,
                                   nanocoap_cache_free_count());
             TEST_ASSERT_EQUAL_INT(i, nanocoap_cache_used_count());
         }
         else {
-            TEST_ASSERT_EQUAL_INT(0, nanocoap_cache_free_count());
-            TEST_ASSERT_EQUAL_INT(CONFIG_NANOCOAP_CACHE_ENTRIES,
-                                  nanocoap_cache_used_count());
+            TEST_ASSERT_EQUAL_INT(CONFIG_NANOCOAP_CACHE_ENTRIES - _CAPACITY,
+                                  nanocoap_cache_free_count());
+            TEST_ASSERT_EQUAL_INT(_CAPACITY, nanocoap_cache_used_count());
         }
 
         snprintf(path, sizeof(path), "/path_%u", i);
@@ -185,7 +196,7 @@ static void test_nanocoap_cache__add(void)
                    CONFIG_NANOCOAP_CACHE_KEY_LENGTH);
         }
 
-        if (i == CONFIG_NANOCOAP_CACHE_ENTRIES-1) {
+        if (i == _CAPACITY - 1) {
             /* lookup the first entry to update its list position */
             nanocoap_cache_key_lookup(temp_cache_key);
         }
@@ -310,6 +321,110 @@ static void test_nanocoap_cache__max_age(void)
     TEST_ASSERT(nanocoap_cache_entry_is_stale(c, 20));
 }
 
+static nanocoap_cache_entry_t *_add(unsigned n, uint32_t max_age, bool etag,
+                                    size_t resp_len, uint8_t *rbuf)
+{
+    uint8_t buf[_BUF_SIZE];
+    coap_pkt_t req, resp;
+    uint8_t token[2] = {0xDA, 0xEC};
+    char path[16];
+    size_t len;
+
+    snprintf(path, sizeof(path), "/path_%u", n);
+    len = coap_build_hdr((coap_hdr_t *)&buf[0], COAP_TYPE_NON,
+                         &token[0], 2, COAP_METHOD_GET, n);
+    coap_pkt_init(&req, &buf[0], sizeof(buf), len);
+    coap_opt_add_string(&req, COAP_OPT_URI_PATH, &path[0], '/');
+    coap_opt_finish(&req, COAP_OPT_FINISH_NONE);
+
+    len = coap_build_hdr((coap_hdr_t *)&rbuf[0], COAP_TYPE_NON,
+                         &token[0], 2, COAP_CODE_205, n);
+    coap_pkt_init(&resp, &rbuf[0], _BUF_SIZE, len);
+    if (etag) {
+        coap_opt_add_opaque(&resp, COAP_OPT_ETAG, &n, 1);
+    }
+    coap_opt_add_uint(&resp, COAP_OPT_MAX_AGE, max_age);
+    len = coap_opt_finish(&resp, COAP_OPT_FINISH_PAYLOAD);
+    /* payload identifies the response */
+    memset(resp.payload, n, resp_len - len);
+
+    return nanocoap_cache_add_by_req(&req, &resp, resp_len);
+}
+
+static void test_nanocoap_cache__size(void)
+{
+    uint8_t rbufs[_CAPACITY + 1][_BUF_SIZE];
+    nanocoap_cache_entry_t *ces[_CAPACITY + 1];
+    nanocoap_cache_stats_t stats;
+    uint8_t lru_key[CONFIG_NANOCOAP_CACHE_KEY_LENGTH];
+    size_t size = CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE;
+
+    nanocoap_cache_init();
+    for (unsigned i = 0; i < _CAPACITY; i++) {
+        ces[i] = _add(i, 60, false, size, rbufs[i]);
+        TEST_ASSERT_NOT_NULL(ces[i]);
+    }
+    memcpy(lru_key, ces[0]->cache_key, sizeof(lru_key));
+    TEST_ASSERT_EQUAL_INT(_CAPACITY * size, nanocoap_cache_used_bytes());
+
+    /* there are unused entries, but no space for the response: the least
+     * recently used entry is replaced */
+    ces[_CAPACITY] = _add(_CAPACITY, 60, false, size, rbufs[_CAPACITY]);
+    TEST_ASSERT_NOT_NULL(ces[_CAPACITY]);
+    TEST_ASSERT_EQUAL_INT(_CAPACITY, nanocoap_cache_used_count());
+    TEST_ASSERT_EQUAL_INT(_CAPACITY * size, nanocoap_cache_used_bytes());
+    TEST_ASSERT_NULL(nanocoap_cache_key_lookup(lru_key));
+
+    nanocoap_cache_stats_get(&stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.evictions);
+    TEST_ASSERT_EQUAL_INT(0, stats.hits);
+    TEST_ASSERT_EQUAL_INT(1, stats.misses);
+
+    /* removing an entry in the middle moves the following responses */
+    TEST_ASSERT_EQUAL_INT(0, nanocoap_cache_del(ces[2]));
+    TEST_ASSERT_EQUAL_INT(-1, nanocoap_cache_del(ces[2]));
+    TEST_ASSERT_EQUAL_INT((_CAPACITY - 1) * size, nanocoap_cache_used_bytes());
+    for (unsigned i = 1; i <= _CAPACITY; i++) {
+        if (i == 2) {
+            continue;
+        }
+        TEST_ASSERT(nanocoap_cache_key_lookup(ces[i]->cache_key) == ces[i]);
+        TEST_ASSERT_EQUAL_INT(size, ces[i]->response_len);
+        TEST_ASSERT(memcmp(ces[i]->response_buf, rbufs[i], size) == 0);
+        TEST_ASSERT(ces[i]->response_pkt.payload[0] == i);
+        TEST_ASSERT_EQUAL_INT(i, coap_get_id(&ces[i]->response_pkt));
+    }
+}
+
+static void test_nanocoap_cache__expiry(void)
+{
+    uint8_t rbuf[_BUF_SIZE];
+    nanocoap_cache_entry_t *c;
+    nanocoap_cache_stats_t stats;
+    uint8_t etag_key[CONFIG_NANOCOAP_CACHE_KEY_LENGTH];
+
+    nanocoap_cache_init();
+    TEST_ASSERT_NOT_NULL(_add(0, 0, false, 32, rbuf));
+    TEST_ASSERT_NOT_NULL(c = _add(1, 0, true, 32, rbuf));
+    memcpy(etag_key, c->cache_key, sizeof(etag_key));
+    TEST_ASSERT_NOT_NULL(_add(2, 60, false, 32, rbuf));
+    TEST_ASSERT_EQUAL_INT(3, nanocoap_cache_used_count());
+
+    /* Max-Age 0 passes with the next second */
+    ztimer_sleep(ZTIMER_SEC, 2);
+
+    /* the stale entry with an ETag is kept for validation */
+    TEST_ASSERT_EQUAL_INT(2, nanocoap_cache_used_count());
+    TEST_ASSERT_EQUAL_INT(64, nanocoap_cache_used_bytes());
+    c = nanocoap_cache_key_lookup(etag_key);
+    TEST_ASSERT_NOT_NULL(c);
+    TEST_ASSERT(nanocoap_cache_entry_is_stale(c, ztimer_now(ZTIMER_SEC)));
+
+    nanocoap_cache_stats_get(&stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.expirations);
+    TEST_ASSERT_EQUAL_INT(0, stats.evictions);
+}
+
 Test *tests_nanocoap_cache_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -318,6 +433,8 @@ Test *tests_nanocoap_cache_tests(void)
         new_TestFixture(test_nanocoap_cache__cachekey),
         new_TestFixture(test_nanocoap_cache__cachekey_blockwise),
         new_TestFixture(test_nanocoap_cache__max_age),
+        new_TestFixture(test_nanocoap_cache__size),
+        new_TestFixture(test_nanocoap_cache__expiry),
     };
 
     EMB_UNIT_TESTCALLER(nanocoap_cache_entry_tests, NULL, NULL, fixtures);
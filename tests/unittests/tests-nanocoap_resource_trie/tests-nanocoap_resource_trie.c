@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "net/nanocoap/resource_trie.h"
+
+#include "tests-nanocoap_resource_trie.h"
+
+static ssize_t _handler(coap_pkt_t *pkt, uint8_t *buf, size_t len,
+                        coap_request_ctx_t *ctx)
+{
+    (void)pkt;
+    (void)buf;
+    (void)len;
+    (void)ctx;
+    return 0;
+}
+
+/* deliberately not sorted */
+static const coap_resource_t _resources[] = {
+    { "/sensor/temp", COAP_GET, _handler, NULL },
+    { "/sensor", COAP_GET | COAP_MATCH_SUBTREE, _handler, NULL },
+    { "/sensor/temp", COAP_PUT, _handler, NULL },
+    { "/config/", COAP_GET | COAP_PUT | COAP_MATCH_SUBTREE, _handler, NULL },
+    { "/a", COAP_GET, _handler, NULL },
+    { "/ab", COAP_POST | COAP_MATCH_SUBTREE, _handler, NULL },
+    { "/abc", COAP_GET, _handler, NULL },
+    { "/.well-known/core", COAP_GET, _handler, NULL },
+    { "/sensor/temp", COAP_POST | COAP_MATCH_SUBTREE, _handler, NULL },
+};
+
+static const coap_resource_t _unindexed[] = {
+    { "/", COAP_GET, _handler, NULL },
+};
+
+static const char *_uris[] = {
+    "/sensor/temp", "/sensor/temperature", "/sensor/temp/", "/sensor",
+    "/sensors", "/sens", "/config", "/config/", "/config/x/y", "/a", "/ab",
+    "/abc", "/abcd", "/b", "/", "", "/.well-known/core", "/.well-known/cor",
+};
+
+/* what the linear search of coap_tree_handler() and gcoap finds */
+static int _find_linear(const char *uri, coap_method_flags_t method_flag,
+                        const coap_resource_t **resource)
+{
+    int res = -ENOENT;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_resources); i++) {
+        if (coap_match_path(&_resources[i], (const uint8_t *)uri) != 0) {
+            continue;
+        }
+        if (!(_resources[i].methods & method_flag)) {
+            res = -ENOTSUP;
+            continue;
+        }
+        *resource = &_resources[i];
+        return 0;
+    }
+    return res;
+}
+
+static void test_nanocoap_resource_trie__not_indexed(void)
+{
+    const coap_resource_t *resource;
+
+    TEST_ASSERT_EQUAL_INT(-ENXIO,
+                          coap_resource_trie_find(_unindexed,
+                                                  ARRAY_SIZE(_unindexed), "/",
+                                                  COAP_GET, &resource));
+}
+
+static void test_nanocoap_resource_trie__add(void)
+{
+    const coap_resource_t *resource = NULL;
+
+    TEST_ASSERT_EQUAL_INT(0, coap_resource_trie_add(_resources,
+                                                    ARRAY_SIZE(_resources)));
+    /* adding again is a no-op */
+    TEST_ASSERT_EQUAL_INT(0, coap_resource_trie_add(_resources,
+                                                    ARRAY_SIZE(_resources)));
+    TEST_ASSERT_EQUAL_INT(0, coap_resource_trie_find(_resources,
+                                                     ARRAY_SIZE(_resources),
+                                                     "/sensor/temp", COAP_PUT,
+                                                     &resource));
+    TEST_ASSERT(resource == &_resources[2]);
+}
+
+static void test_nanocoap_resource_trie__find_as_linear(void)
+{
+    static const coap_method_flags_t methods[] = {
+        COAP_GET, COAP_POST, COAP_PUT, COAP_DELETE,
+    };
+
+    TEST_ASSERT_EQUAL_INT(0, coap_resource_trie_add(_resources,
+                                                    ARRAY_SIZE(_resources)));
+    for (unsigned i = 0; i < ARRAY_SIZE(_uris); i++) {
+        for (unsigned j = 0; j < ARRAY_SIZE(methods); j++) {
+            const coap_resource_t *exp = NULL, *res = NULL;
+            int exp_ret = _find_linear(_uris[i], methods[j], &exp);
+
+            TEST_ASSERT_EQUAL_INT(exp_ret,
+                                  coap_resource_trie_find(_resources,
+                                                          ARRAY_SIZE(_resources),
+                                                          _uris[i], methods[j],
+                                                          &res));
+            TEST_ASSERT(exp == res);
+        }
+    }
+}
+
+Test *tests_nanocoap_resource_trie_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_nanocoap_resource_trie__not_indexed),
+        new_TestFixture(test_nanocoap_resource_trie__add),
+        new_TestFixture(test_nanocoap_resource_trie__find_as_linear),
+    };
+
+    EMB_UNIT_TESTCALLER(nanocoap_resource_trie_tests, NULL, NULL, fixtures);
+
+    return (Test *)&nanocoap_resource_trie_tests;
+}
+
+void tests_nanocoap_resource_trie(void)
+{
+    TESTS_RUN(tests_nanocoap_resource_trie_tests());
+}
+/** @} */
@@ -13,6 +13,7 @@
  */
 #include <errno.h>
 
+#include "container.h"
 #include "embUnit.h"
 
 #include "net/gnrc/netreg.h"
@@ -185,6 +186,50 @@ void test_netreg_getnext__2_entries(void)
     gnrc_netreg_release_shared();
 }
 
+void test_netreg_lookup__many_demux_ctx(void)
+{
+    static gnrc_netreg_entry_t many[16];
+    gnrc_netreg_entry_t *res = NULL;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(many); i++) {
+        gnrc_netreg_entry_init_pid(&many[i], TEST_UINT16 + i, TEST_UINT8);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &many[i]));
+    }
+    /* second entry for the last context */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &entries[0]));
+    entries[1].demux_ctx = GNRC_NETREG_DEMUX_CTX_ALL;
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &entries[1]));
+
+    gnrc_netreg_acquire_shared();
+    for (unsigned i = 1; i < ARRAY_SIZE(many); i++) {
+        TEST_ASSERT_NOT_NULL((res = gnrc_netreg_lookup(GNRC_NETTYPE_TEST,
+                                                       TEST_UINT16 + i)));
+        TEST_ASSERT(&many[i] == res);
+        TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+    }
+    TEST_ASSERT_NOT_NULL((res = gnrc_netreg_lookup(GNRC_NETTYPE_TEST,
+                                                   TEST_UINT16)));
+    TEST_ASSERT(&entries[0] == res);
+    TEST_ASSERT_NOT_NULL((res = gnrc_netreg_getnext(res)));
+    TEST_ASSERT(&many[0] == res);
+    TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+    TEST_ASSERT(&entries[1] == gnrc_netreg_lookup(GNRC_NETTYPE_TEST,
+                                                  GNRC_NETREG_DEMUX_CTX_ALL));
+    TEST_ASSERT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_TEST,
+                                        TEST_UINT16 + ARRAY_SIZE(many)));
+    gnrc_netreg_release_shared();
+
+    TEST_ASSERT_EQUAL_INT(2, gnrc_netreg_num(GNRC_NETTYPE_TEST, TEST_UINT16));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netreg_num(GNRC_NETTYPE_TEST, TEST_UINT16 + 1));
+
+    gnrc_netreg_unregister(GNRC_NETTYPE_TEST, &many[0]);
+    gnrc_netreg_unregister(GNRC_NETTYPE_TEST, &entries[1]);
+    entries[1].demux_ctx = TEST_UINT16;
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netreg_num(GNRC_NETTYPE_TEST, TEST_UINT16));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_num(GNRC_NETTYPE_TEST,
+                                             GNRC_NETREG_DEMUX_CTX_ALL));
+}
+
 Test *tests_netreg_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -201,6 +246,7 @@ Test *tests_netreg_tests(void)
         new_TestFixture(test_netreg_num__2_entries),
         new_TestFixture(test_netreg_getnext__NULL),
         new_TestFixture(test_netreg_getnext__2_entries),
+        new_TestFixture(test_netreg_lookup__many_demux_ctx),
     };
 
     EMB_UNIT_TESTCALLER(netreg_tests, set_up, NULL, fixtures);
@@ -282,6 +282,54 @@ static void test_pktbuf_add__0_sized_release(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
+static void test_pktbuf_add_snips__success(void)
+{
+    static const size_t sizes[] = { 40, 8, 0, 13 };
+    static const gnrc_nettype_t types[] = {
+        GNRC_NETTYPE_TEST, GNRC_NETTYPE_UNDEF, GNRC_NETTYPE_TEST, GNRC_NETTYPE_UNDEF
+    };
+    gnrc_pktsnip_t *next = gnrc_pktbuf_add(NULL, TEST_STRING8, sizeof(TEST_STRING8),
+                                           GNRC_NETTYPE_TEST);
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add_snips(next, sizes, types,
+                                                ARRAY_SIZE(sizes));
+    gnrc_pktsnip_t *snip = pkt;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    for (unsigned i = 0; i < ARRAY_SIZE(sizes); i++) {
+        TEST_ASSERT_NOT_NULL(snip);
+        TEST_ASSERT_EQUAL_INT(sizes[i], snip->size);
+        TEST_ASSERT_EQUAL_INT(types[i], snip->type);
+        TEST_ASSERT_EQUAL_INT(1, snip->users);
+        if (sizes[i] == 0) {
+            TEST_ASSERT_NULL(snip->data);
+        }
+        else {
+            TEST_ASSERT_NOT_NULL(snip->data);
+            memset(snip->data, i, sizes[i]);
+        }
+        snip = snip->next;
+    }
+    TEST_ASSERT(snip == next);
+    TEST_ASSERT_EQUAL_INT(61 + sizeof(TEST_STRING8), gnrc_pkt_len(pkt));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    /* snips can be freed on their own */
+    pkt = gnrc_pktbuf_remove_snip(pkt, pkt->next);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+#ifndef MODULE_GNRC_PKTBUF_MALLOC
+static void test_pktbuf_add_snips__memfull(void)
+{
+    const size_t sizes[] = { 8, CONFIG_GNRC_PKTBUF_SIZE };
+    const gnrc_nettype_t types[] = { GNRC_NETTYPE_TEST, GNRC_NETTYPE_TEST };
+
+    TEST_ASSERT_NULL(gnrc_pktbuf_add_snips(NULL, sizes, types, ARRAY_SIZE(sizes)));
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+#endif
+
 static void test_pktbuf_mark__pkt_NULL__size_0(void)
 {
     TEST_ASSERT_NULL(gnrc_pktbuf_mark(NULL, 0, GNRC_NETTYPE_TEST));
@@ -880,6 +928,10 @@ Test *tests_pktbuf_tests(void)
         new_TestFixture(test_pktbuf_add__unaligned_in_aligned_hole),
 #endif
         new_TestFixture(test_pktbuf_add__0_sized_release),
+        new_TestFixture(test_pktbuf_add_snips__success),
+#ifndef MODULE_GNRC_PKTBUF_MALLOC
+        new_TestFixture(test_pktbuf_add_snips__memfull),
+#endif
         new_TestFixture(test_pktbuf_mark__pkt_NULL__size_0),
         new_TestFixture(test_pktbuf_mark__pkt_NULL__size_not_0),
         new_TestFixture(test_pktbuf_mark__pkt_NOT_NULL__size_0),
@@ -182,6 +182,29 @@ static void test_sixlowpan_ctx_lookup_id__success(void)
     TEST_ASSERT(DEFAULT_TEST_PREFIX_LEN <= ipv6_addr_match_prefix(&addr, &ctx->prefix));
 }
 
+static void test_sixlowpan_ctx_lookup_id_decomp__wrong_id(void)
+{
+    /* add context DEFAULT_TEST_PREFIX to DEFAULT_TEST_ID */
+    test_sixlowpan_ctx_update__success();
+    TEST_ASSERT_NULL(gnrc_sixlowpan_ctx_lookup_id_decomp(OTHER_TEST_ID));
+    TEST_ASSERT_NULL(gnrc_sixlowpan_ctx_lookup_id_decomp(GNRC_SIXLOWPAN_CTX_SIZE));
+}
+
+static void test_sixlowpan_ctx_lookup_id_decomp__ltime0(void)
+{
+    ipv6_addr_t addr = DEFAULT_TEST_PREFIX;
+    const gnrc_sixlowpan_ctx_t *ctx;
+
+    /* context with expired lifetime is still used for decompression */
+    test_sixlowpan_ctx_update__ltime0();
+    TEST_ASSERT_NOT_NULL((ctx = gnrc_sixlowpan_ctx_lookup_id_decomp(DEFAULT_TEST_ID)));
+    TEST_ASSERT_EQUAL_INT(DEFAULT_TEST_ID, ctx->flags_id);
+    TEST_ASSERT_EQUAL_INT(DEFAULT_TEST_PREFIX_LEN, ctx->prefix_len);
+    TEST_ASSERT(DEFAULT_TEST_PREFIX_LEN <= ipv6_addr_match_prefix(&addr, &ctx->prefix));
+    gnrc_sixlowpan_ctx_remove(DEFAULT_TEST_ID);
+    TEST_ASSERT_NULL(gnrc_sixlowpan_ctx_lookup_id_decomp(DEFAULT_TEST_ID));
+}
+
 static void test_sixlowpan_ctx_remove(void)
 {
     ipv6_addr_t addr = DEFAULT_TEST_PREFIX;
@@ -210,6 +233,8 @@ Test *tests_sixlowpan_ctx_tests(void)
         new_TestFixture(test_sixlowpan_ctx_lookup_id__empty),
         new_TestFixture(test_sixlowpan_ctx_lookup_id__wrong_id),
         new_TestFixture(test_sixlowpan_ctx_lookup_id__success),
+        new_TestFixture(test_sixlowpan_ctx_lookup_id_decomp__wrong_id),
+        new_TestFixture(test_sixlowpan_ctx_lookup_id_decomp__ltime0),
         new_TestFixture(test_sixlowpan_ctx_remove),
     };
 
@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "net/ipv6/addr.h"
+#include "net/ipv6/hdr.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/sixlowpan/ctx.h"
+#include "net/gnrc/sixlowpan/iphc.h"
+#include "net/protnum.h"
+
+#include "tests-sixlowpan_iphc.h"
+
+#define TEST_CTX_ID         (0)
+#define TEST_CTX_PREFIX     { { \
+            0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00, \
+        } \
+    }
+#define TEST_SRC            0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+                            0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01
+#define TEST_L2_SRC         { 0x00, 0x01 }
+#define TEST_L2_DST         { 0xff, 0xff }
+#define TEST_PAYLOAD        0xde, 0xad, 0xbe, 0xef
+
+/* TF and HLIM elided, next header in-line, source address in-line */
+#define TEST_IPHC1          (0x7b)
+#define TEST_IPHC2_SRC      (0x00)
+
+static void _recv(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx);
+
+static gnrc_netreg_entry_cbd_t _cbd = { .cb = _recv };
+static gnrc_netreg_entry_t _entry = GNRC_NETREG_ENTRY_INIT_CB(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                              &_cbd);
+static ipv6_hdr_t _ipv6_hdr;
+static unsigned _received;
+
+static void _recv(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    (void)ctx;
+    if (cmd == GNRC_NETAPI_MSG_TYPE_RCV) {
+        gnrc_pktsnip_t *ipv6 = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_IPV6);
+
+        memcpy(&_ipv6_hdr, ipv6->data, sizeof(_ipv6_hdr));
+        _received++;
+    }
+    gnrc_pktbuf_release(pkt);
+}
+
+static void _decode(const uint8_t *data, size_t len)
+{
+    static const uint8_t l2_src[] = TEST_L2_SRC;
+    static const uint8_t l2_dst[] = TEST_L2_DST;
+    gnrc_pktsnip_t *netif, *sixlo;
+
+    netif = gnrc_netif_hdr_build(l2_src, sizeof(l2_src), l2_dst, sizeof(l2_dst));
+    TEST_ASSERT_NOT_NULL(netif);
+    sixlo = gnrc_pktbuf_add(netif, data, len, GNRC_NETTYPE_SIXLOWPAN);
+    TEST_ASSERT_NOT_NULL(sixlo);
+    gnrc_sixlowpan_iphc_recv(sixlo, NULL, 0);
+}
+
+static void set_up(void)
+{
+    ipv6_addr_t prefix = TEST_CTX_PREFIX;
+
+    gnrc_pktbuf_init();
+    memset(&_ipv6_hdr, 0, sizeof(_ipv6_hdr));
+    _received = 0;
+    gnrc_netreg_register(GNRC_NETTYPE_IPV6, &_entry);
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_ctx_update(TEST_CTX_ID, &prefix, 64,
+                                                   UINT16_MAX, true));
+}
+
+static void tear_down(void)
+{
+    gnrc_netreg_unregister(GNRC_NETTYPE_IPV6, &_entry);
+    gnrc_sixlowpan_ctx_reset();
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_sixlowpan_iphc_recv__mcast_uc_prefix(void)
+{
+    /* M=1, DAC=1, DAM=00: ffXX:XXLL:PPPP:PPPP:PPPP:PPPP:XXXX:XXXX */
+    static const uint8_t data[] = {
+        TEST_IPHC1, TEST_IPHC2_SRC | 0x0c, PROTNUM_IPV6_NONXT, TEST_SRC,
+        0x3e, 0x00, 0x12, 0x34, 0x56, 0x78, TEST_PAYLOAD,
+    };
+    static const ipv6_addr_t exp = { {
+            0xff, 0x3e, 0x00, 0x40, 0x20, 0x01, 0x0d, 0xb8,
+            0x00, 0x00, 0x00, 0x00, 0x12, 0x34, 0x56, 0x78,
+        } };
+
+    _decode(data, sizeof(data));
+    TEST_ASSERT_EQUAL_INT(1, _received);
+    TEST_ASSERT(ipv6_addr_equal(&exp, &_ipv6_hdr.dst));
+    TEST_ASSERT_EQUAL_INT(4, byteorder_ntohs(_ipv6_hdr.len));
+}
+
+static void test_sixlowpan_iphc_recv__ucast_dac_reserved(void)
+{
+    /* M=0, DAC=1, DAM=00 would be the unspecified address */
+    static const uint8_t data[] = {
+        TEST_IPHC1, TEST_IPHC2_SRC | 0x04, PROTNUM_IPV6_NONXT, TEST_SRC,
+        TEST_PAYLOAD,
+    };
+
+    _decode(data, sizeof(data));
+    TEST_ASSERT_EQUAL_INT(0, _received);
+}
+
+static void test_sixlowpan_iphc_recv__mcast_dac_reserved(void)
+{
+    /* M=1, DAC=1, DAM=01 */
+    static const uint8_t data[] = {
+        TEST_IPHC1, TEST_IPHC2_SRC | 0x0d, PROTNUM_IPV6_NONXT, TEST_SRC,
+        0x3e, 0x00, 0x12, 0x34, 0x56, 0x78, TEST_PAYLOAD,
+    };
+
+    _decode(data, sizeof(data));
+    TEST_ASSERT_EQUAL_INT(0, _received);
+}
+
+Test *tests_sixlowpan_iphc_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_sixlowpan_iphc_recv__mcast_uc_prefix),
+        new_TestFixture(test_sixlowpan_iphc_recv__ucast_dac_reserved),
+        new_TestFixture(test_sixlowpan_iphc_recv__mcast_dac_reserved),
+    };
+
+    EMB_UNIT_TESTCALLER(sixlowpan_iphc_tests, set_up, tear_down, fixtures);
+
+    return (Test *)&sixlowpan_iphc_tests;
+}
+
+void tests_sixlowpan_iphc(void)
+{
+    TESTS_RUN(tests_sixlowpan_iphc_tests());
+}
+/** @} */